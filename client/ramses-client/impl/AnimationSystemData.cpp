@@ -123,7 +123,9 @@ namespace ramses
         for (uint32_t i = 0u; i < typesCount; ++i)
         {
             uint32_t count = 0u;
-            const ERamsesObjectType type = SerializationHelper::DeserializeObjectTypeAndCount(inStream, count);
+            // animation objects are read sequentially as part of their animation system, block size is not needed
+            uint32_t blockSize = 0u;
+            const ERamsesObjectType type = SerializationHelper::DeserializeObjectTypeAndCount(inStream, count, blockSize);
             assert(m_objectRegistry.getNumberOfObjects(type) == 0u);
             m_objectRegistry.reserveAdditionalObjectCapacity(type, count);
 
@@ -10,6 +10,7 @@
 #include "Components/IResourceProviderComponent.h"
 #include "Components/ISceneGraphProviderComponent.h"
 #include "Components/ResourceTableOfContents.h"
+#include "Components/ResourceAvailabilityEvent.h"
 #include "Scene/ClientScene.h"
 #include "RamsesFrameworkImpl.h"
 #include "Utils/LogMacros.h"
@@ -87,10 +88,10 @@ namespace ramses_internal
         m_sceneReferenceEventVec.push_back(event);
     }
 
-    ramses_internal::ManagedResource ClientApplicationLogic::addResource(const IResource* resource)
+    ramses_internal::ManagedResource ClientApplicationLogic::addResource(const IResource* resource, bool deletionAllowed)
     {
         PlatformGuard guard(m_frameworkLock);
-        return m_resourceComponent->manageResource(*resource);
+        return m_resourceComponent->manageResource(*resource, deletionAllowed);
     }
 
     ramses_internal::ManagedResource ClientApplicationLogic::getResource(ResourceContentHash hash) const
@@ -142,9 +143,10 @@ namespace ramses_internal
         return ret;
     }
 
-    void ClientApplicationLogic::handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& /*event*/, const Guid& /*rendererId*/)
+    void ClientApplicationLogic::handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& event, const Guid& rendererId)
     {
-        LOG_WARN(CONTEXT_FRAMEWORK, "ClientApplicationLogic::handleResourceAvailabilityEvent: is not implemented yet.");
+        // available resources are taken into account by scene logic when sending scene to renderer, nothing to do here
+        LOG_DEBUG(CONTEXT_CLIENT, "ClientApplicationLogic::handleResourceAvailabilityEvent: " << event.availableResources.size() << " resources of scene " << event.sceneid << " available at " << rendererId);
     }
 
     ManagedResource ClientApplicationLogic::loadResource(const ResourceContentHash& hash) const
@@ -57,7 +57,7 @@ namespace ramses_internal
         virtual void handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& event, const Guid& rendererId) override;
 
         // Resource handling
-        ManagedResource         addResource(const IResource* resource);
+        ManagedResource         addResource(const IResource* resource, bool deletionAllowed = false);
         ManagedResource         getResource(ResourceContentHash hash) const;
         ManagedResource         loadResource(const ResourceContentHash& hash) const;
         ResourceHashUsage       getHashUsage(const ResourceContentHash& hash) const;
@@ -0,0 +1,212 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "EffectCompilationCache.h"
+#include "Resource/EffectResource.h"
+#include "Utils/StatisticCollection.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/RawBinaryInputStream.h"
+#include "Utils/LogMacros.h"
+#include "ramses-sdk-build-config.h"
+#include "city.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // must be increased whenever layout of a cache entry changes
+        constexpr UInt32 EntryFormatVersion = 2u;
+    }
+
+    EffectCompilationCache::EffectCompilationCache(String directory, StatisticCollectionFramework& statistics)
+        : m_directory(std::move(directory))
+        , m_statistics(statistics)
+        , m_tempFileInstanceId(std::random_device{}())
+    {
+        File dir(m_directory);
+        if (!dir.exists() && !dir.createDirectory())
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache: could not create cache directory '" << m_directory << "', effects will be compiled without caching");
+        else
+            LOG_INFO(CONTEXT_CLIENT, "EffectCompilationCache: using cache directory '" << m_directory << "'");
+    }
+
+    EffectCompilationCache::~EffectCompilationCache()
+    {
+        const UInt32 hits = m_numHits;
+        const UInt32 misses = m_numMisses;
+        if (hits + misses > 0u)
+        {
+            LOG_INFO(CONTEXT_CLIENT, "EffectCompilationCache: " << hits << " hits, " << misses << " misses, hit rate "
+                << (100u * hits) / (hits + misses) << "%");
+        }
+    }
+
+    ResourceContentHash EffectCompilationCache::CreateKey(const String& vertexShader, const String& fragmentShader, const String& geometryShader,
+        const std::vector<String>& compilerDefines, const HashMap<String, EFixedSemantics>& semanticInputs)
+    {
+        // semantic inputs are unordered, sort by name to get deterministic key
+        std::vector<std::pair<String, EFixedSemantics>> semantics;
+        semantics.reserve(semanticInputs.size());
+        for (const auto& semantic : semanticInputs)
+            semantics.emplace_back(semantic.key, semantic.value);
+        std::sort(semantics.begin(), semantics.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        BinaryOutputStream keyStream(vertexShader.size() + fragmentShader.size() + geometryShader.size() + 1024u);
+        keyStream << String(ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING) << String(ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH) << EntryFormatVersion;
+        keyStream << vertexShader << fragmentShader << geometryShader;
+        keyStream << static_cast<UInt32>(compilerDefines.size());
+        for (const auto& define : compilerDefines)
+            keyStream << define;
+        keyStream << static_cast<UInt32>(semantics.size());
+        for (const auto& semantic : semantics)
+            keyStream << semantic.first << static_cast<UInt32>(semantic.second);
+
+        const cityhash::uint128 hash = cityhash::CityHash128(reinterpret_cast<const char*>(keyStream.getData()), keyStream.getSize());
+        return ResourceContentHash(cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash));
+    }
+
+    EffectResource* EffectCompilationCache::load(const ResourceContentHash& key, const String& name, ResourceCacheFlag cacheFlag)
+    {
+        EffectResource* effect = readEntry(key, name, cacheFlag);
+        if (effect)
+        {
+            ++m_numHits;
+            m_statistics.statEffectCompilationCacheHits.incCounter(1);
+        }
+        else
+        {
+            ++m_numMisses;
+            m_statistics.statEffectCompilationCacheMisses.incCounter(1);
+        }
+        return effect;
+    }
+
+    EffectResource* EffectCompilationCache::readEntry(const ResourceContentHash& key, const String& name, ResourceCacheFlag cacheFlag) const
+    {
+        File file(getEntryPath(key));
+        if (!file.exists())
+            return nullptr;
+
+        size_t fileSize = 0u;
+        if (!file.getSizeInBytes(fileSize) || !file.open(File::Mode::ReadOnlyBinary))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: could not open cache entry '" << file.getPath() << "'");
+            return nullptr;
+        }
+
+        std::vector<Byte> entryData(fileSize);
+        size_t numBytesRead = 0u;
+        const EStatus readStatus = file.read(entryData.data(), fileSize, numBytesRead);
+        file.close();
+        if (readStatus != EStatus::Ok || numBytesRead != fileSize)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: could not read cache entry '" << file.getPath() << "'");
+            return nullptr;
+        }
+
+        RawBinaryInputStream headerStream(entryData.data(), entryData.size());
+        UInt32 formatVersion = 0u;
+        ResourceContentHash entryKey;
+        ResourceContentHash effectHash;
+        UInt32 payloadSize = 0u;
+        UInt64 payloadChecksum = 0u;
+        headerStream >> formatVersion >> entryKey >> effectHash >> payloadSize >> payloadChecksum;
+        if (headerStream.getState() != EStatus::Ok || formatVersion != EntryFormatVersion || entryKey != key)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: ignoring cache entry '" << file.getPath() << "' with unexpected header");
+            return nullptr;
+        }
+
+        // validate whole payload before parsing it, metadata parsing does not cope with truncated or corrupted input
+        const Byte* payload = entryData.data() + headerStream.getBytesRead();
+        if (payloadSize != entryData.size() - headerStream.getBytesRead() ||
+            cityhash::CityHash64(reinterpret_cast<const char*>(payload), payloadSize) != payloadChecksum)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: ignoring truncated or corrupted cache entry '" << file.getPath() << "'");
+            return nullptr;
+        }
+
+        RawBinaryInputStream entryStream(payload, payloadSize);
+        std::unique_ptr<IResource> resource(EffectResource::CreateResourceFromMetadataStream(entryStream, cacheFlag, name));
+        UInt32 blobSize = 0u;
+        entryStream >> blobSize;
+        if (entryStream.getState() != EStatus::Ok || blobSize > payloadSize - entryStream.getBytesRead())
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: ignoring truncated cache entry '" << file.getPath() << "'");
+            return nullptr;
+        }
+
+        ResourceBlob blob(blobSize);
+        entryStream.read(blob.data(), blobSize);
+        resource->setResourceData(std::move(blob));
+        if (resource->getHash() != effectHash)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::load: ignoring corrupted cache entry '" << file.getPath() << "'");
+            return nullptr;
+        }
+
+        return resource.release()->convertTo<EffectResource>();
+    }
+
+    bool EffectCompilationCache::store(const ResourceContentHash& key, const EffectResource& effect)
+    {
+        const ResourceBlob& blob = effect.getResourceData();
+        BinaryOutputStream payloadStream(blob.size() + 1024u);
+        effect.serializeResourceMetadataToStream(payloadStream);
+        payloadStream << static_cast<UInt32>(blob.size());
+        payloadStream.write(blob.data(), blob.size());
+
+        BinaryOutputStream entryStream(payloadStream.getSize() + 64u);
+        entryStream << EntryFormatVersion << key << effect.getHash() << static_cast<UInt32>(payloadStream.getSize())
+            << static_cast<UInt64>(cityhash::CityHash64(reinterpret_cast<const char*>(payloadStream.getData()), payloadStream.getSize()));
+        entryStream.write(payloadStream.getData(), payloadStream.getSize());
+
+        // write to temporary file and rename, so that concurrent readers never see a partially written entry
+        const String entryPath = getEntryPath(key);
+        File tempFile(entryPath + fmt::format(".tmp{:08X}_{}", m_tempFileInstanceId, m_nextTempFileIdx++));
+        bool written = false;
+        {
+            BinaryFileOutputStream tempStream(tempFile);
+            tempStream.write(entryStream.getData(), entryStream.getSize());
+            written = (tempStream.getState() == EStatus::Ok);
+        }
+
+        // rename does not replace existing files on all platforms, so retry after removing outdated entry
+        const auto renameToEntry = [&]() { return std::rename(tempFile.getPath().c_str(), entryPath.c_str()) == 0; };
+        if (!written || (!renameToEntry() && !(File(entryPath).remove() && renameToEntry())))
+        {
+            tempFile.remove();
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::store: could not write cache entry '" << entryPath << "'");
+            return false;
+        }
+
+        return true;
+    }
+
+    UInt32 EffectCompilationCache::getNumberOfHits() const
+    {
+        return m_numHits;
+    }
+
+    UInt32 EffectCompilationCache::getNumberOfMisses() const
+    {
+        return m_numMisses;
+    }
+
+    String EffectCompilationCache::getEntryPath(const ResourceContentHash& key) const
+    {
+        return m_directory + fmt::format("/{:016X}{:016X}.effect", key.highPart, key.lowPart);
+    }
+}
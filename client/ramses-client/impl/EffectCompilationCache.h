@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_EFFECTCOMPILATIONCACHE_H
+#define RAMSES_EFFECTCOMPILATIONCACHE_H
+
+#include "Collections/String.h"
+#include "Collections/HashMap.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "SceneAPI/EFixedSemantics.h"
+#include "Resource/IResource.h"
+#include <vector>
+#include <atomic>
+
+namespace ramses_internal
+{
+    class EffectResource;
+    class StatisticCollectionFramework;
+
+    // Persists effects compiled from GLSL in a directory, one file per effect named by its key. The key is a hash
+    // of everything influencing compilation result (shader sources, compiler defines, semantic inputs and SDK version),
+    // so effects compiled in a previous run can be recreated without parsing and linking shaders again.
+    // Entries are validated by payload checksum before parsing and by content hash of the effect when loaded,
+    // invalid entries count as cache misses.
+    class EffectCompilationCache
+    {
+    public:
+        EffectCompilationCache(String directory, StatisticCollectionFramework& statistics);
+        ~EffectCompilationCache();
+
+        EffectCompilationCache(const EffectCompilationCache&) = delete;
+        EffectCompilationCache& operator=(const EffectCompilationCache&) = delete;
+
+        static ResourceContentHash CreateKey(const String& vertexShader, const String& fragmentShader, const String& geometryShader,
+            const std::vector<String>& compilerDefines, const HashMap<String, EFixedSemantics>& semanticInputs);
+
+        // returns nullptr on cache miss, name and cache flag are not part of the key and are set on returned effect
+        EffectResource* load(const ResourceContentHash& key, const String& name, ResourceCacheFlag cacheFlag);
+        bool store(const ResourceContentHash& key, const EffectResource& effect);
+
+        UInt32 getNumberOfHits() const;
+        UInt32 getNumberOfMisses() const;
+
+    private:
+        String getEntryPath(const ResourceContentHash& key) const;
+        EffectResource* readEntry(const ResourceContentHash& key, const String& name, ResourceCacheFlag cacheFlag) const;
+
+        const String m_directory;
+        StatisticCollectionFramework& m_statistics;
+        std::atomic<UInt32> m_numHits{ 0u };
+        std::atomic<UInt32> m_numMisses{ 0u };
+        // random per instance, so that temporary files of concurrent processes sharing the directory do not collide
+        const UInt32 m_tempFileInstanceId;
+        std::atomic<UInt32> m_nextTempFileIdx{ 0u };
+    };
+}
+
+#endif
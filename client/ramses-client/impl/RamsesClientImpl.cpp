@@ -52,15 +52,19 @@
 #include "Ramsh/Ramsh.h"
 #include "DataTypeUtils.h"
 #include "ResourceDataPoolImpl.h"
+#include "ResourcePrefetcher.h"
+#include "SceneUtils/ResourceUtils.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
 #include "Resource/TextureResource.h"
 #include "glslEffectBlock/GlslEffect.h"
+#include "EffectCompilationCache.h"
 #include "EffectDescriptionImpl.h"
 #include "TextureUtils.h"
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include <array>
+#include <algorithm>
 
 namespace ramses
 {
@@ -91,10 +95,14 @@ namespace ramses
         framework.getRamsh().add(*m_cmdDumpSceneToFile);
         framework.getRamsh().add(*m_cmdLogResourceMemoryUsage);
         m_framework.getPeriodicLogger().registerPeriodicLogSupplier(&m_framework.getScenegraphComponent());
+
+        if (!framework.getEffectCompilationCacheDirectory().empty())
+            m_effectCompilationCache = std::make_unique<ramses_internal::EffectCompilationCache>(ramses_internal::String(framework.getEffectCompilationCacheDirectory()), framework.getStatisticCollection());
     }
 
     RamsesClientImpl::~RamsesClientImpl()
     {
+        stopResourcePrefetch();
         m_deleteSceneQueue.disableAcceptingTasksAfterExecutingCurrentQueue();
         m_loadFromFileTaskQueue.disableAcceptingTasksAfterExecutingCurrentQueue();
 
@@ -287,7 +295,7 @@ namespace ramses
         return new Scene(pimpl);
     }
 
-    Scene* RamsesClientImpl::prepareSceneFromFile(const char* caller, std::string const& sceneFilename, bool localOnly)
+    Scene* RamsesClientImpl::prepareSceneFromFile(const char* caller, std::string const& sceneFilename, bool localOnly, bool prefetchResources)
     {
         // this file contains scene data AND resource data and will be handed over to and held open by resource component as resource stream
         ramses_internal::ResourceFileInputStreamSPtr sceneAndResourceFileStream(new ramses_internal::ResourceFileInputStream(sceneFilename.c_str()));
@@ -310,20 +318,81 @@ namespace ramses
         inputStream >> llResourceStart;
 
         Scene* scene = prepareSceneFromInputStream(caller, sceneFilename, inputStream, localOnly);
+        if (!scene)
+            return nullptr;
 
         // calls on m_appLogic are thread safe
         if (!m_appLogic.hasResourceFile(sceneFilename.c_str()))
         {
             // register resource file for on-demand loading (LL-Resources)
             ramses_internal::ResourceTableOfContents loadedTOC;
-            loadedTOC.readTOCPosAndTOCFromStream(inputStream);
+            if (!loadedTOC.readTOCPosAndTOCFromStream(inputStream))
+            {
+                LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::" << caller << ": failed to read resources from file");
+                // scene is already known to framework, release it the same way as a loaded scene
+                finalizeLoadedScene(scene);
+                destroy(*scene);
+                return nullptr;
+            }
             m_appLogic.addResourceFile(sceneAndResourceFileStream, loadedTOC);
             scene->impl.setSceneFileName(sceneFilename);
+
+            if (prefetchResources)
+                startResourcePrefetch(*scene, sceneAndResourceFileStream, sceneFilename, loadedTOC);
         }
 
         return scene;
     }
 
+    void RamsesClientImpl::startResourcePrefetch(Scene& scene, const ramses_internal::ResourceFileInputStreamSPtr& resourceFile, std::string const& filename, const ramses_internal::ResourceTableOfContents& toc)
+    {
+        ramses_internal::ResourceContentHashVector sceneResources;
+        ramses_internal::ResourceUtils::GetAllResourcesFromScene(sceneResources, scene.impl.getIScene());
+
+        std::vector<ramses_internal::ResourceFileEntry> entries;
+        entries.reserve(sceneResources.size());
+        for (const auto& hash : sceneResources)
+        {
+            if (toc.containsResource(hash))
+                entries.push_back(toc.getEntryForHash(hash));
+        }
+        if (entries.empty())
+            return;
+
+        // read file front to back
+        std::sort(entries.begin(), entries.end(), [](const auto& e1, const auto& e2) { return e1.offsetInBytes < e2.offsetInBytes; });
+
+        auto prefetcher = std::make_shared<ramses_internal::ResourcePrefetcher>(m_appLogic, resourceFile, filename, std::move(entries));
+        {
+            ramses_internal::PlatformGuard g(m_clientLock);
+            if (m_resourcePrefetchStopped)
+                return;
+            m_resourcePrefetchers.erase(std::remove_if(m_resourcePrefetchers.begin(), m_resourcePrefetchers.end(), [](const auto& p) { return p.expired(); }), m_resourcePrefetchers.end());
+            m_resourcePrefetchers.push_back(prefetcher);
+        }
+        prefetcher->start(m_loadFromFileTaskQueue, NumResourcePrefetchTasks);
+        scene.impl.setResourcePrefetcher(std::move(prefetcher));
+    }
+
+    void RamsesClientImpl::stopResourcePrefetch()
+    {
+        std::vector<std::shared_ptr<ramses_internal::ResourcePrefetcher>> prefetchers;
+        {
+            ramses_internal::PlatformGuard g(m_clientLock);
+            m_resourcePrefetchStopped = true;
+            for (const auto& prefetcher : m_resourcePrefetchers)
+            {
+                if (auto runningPrefetcher = prefetcher.lock())
+                    prefetchers.push_back(std::move(runningPrefetcher));
+            }
+            m_resourcePrefetchers.clear();
+        }
+
+        // stop outside of client lock, releasing prefetched resources locks resource storage
+        for (const auto& prefetcher : prefetchers)
+            prefetcher->stop();
+    }
+
     Scene* RamsesClientImpl::loadSceneFromFile(const char* fileName, bool localOnly)
     {
         const ramses_internal::UInt64 start = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
@@ -369,6 +438,13 @@ namespace ramses
             LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "SDK version of loader: [" << ::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING << "]; GitHash: [" << ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH << "]");
             return false;
         }
+
+        if (readVersion.fileFormatVersion != ramses_internal::RamsesVersion::FileFormatVersion)
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::ReadRamsesVersionAndPrintWarningOnMismatch: File format version " << readVersion.fileFormatVersion << " of file " << verboseFileName
+                << " does not match file format version " << ramses_internal::RamsesVersion::FileFormatVersion << " of this build. File has to be exported again.");
+            return false;
+        }
         return true;
     }
 
@@ -471,7 +547,7 @@ namespace ramses
     void RamsesClientImpl::LoadSceneRunnable::execute()
     {
         const ramses_internal::UInt64 start = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
-        Scene* scene = m_client.prepareSceneFromFile("loadSceneFromFileAsync", m_sceneFilename, m_localOnly);
+        Scene* scene = m_client.prepareSceneFromFile("loadSceneFromFileAsync", m_sceneFilename, m_localOnly, true);
         const ramses_internal::UInt64 end = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
 
         if (scene)
@@ -650,11 +726,23 @@ namespace ramses
 
     ramses_internal::ManagedResource RamsesClientImpl::createManagedEffect(const EffectDescription& effectDesc, resourceCacheFlag_t cacheFlag, const char* name, std::string& errorMessages)
     {
-        //create effect using vertex and fragment shaders
         ramses_internal::String effectName(name);
+        errorMessages.clear();
+
+        // reuse effect compiled in a previous run if possible, only successfully compiled effects are cached
+        ramses_internal::ResourceContentHash cacheKey;
+        if (m_effectCompilationCache)
+        {
+            cacheKey = ramses_internal::EffectCompilationCache::CreateKey(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.getGeometryShader(),
+                effectDesc.impl.getCompilerDefines(), effectDesc.impl.getSemanticsMap());
+            ramses_internal::EffectResource* cachedEffectResource = m_effectCompilationCache->load(cacheKey, effectName, ramses_internal::ResourceCacheFlag(cacheFlag.getValue()));
+            if (cachedEffectResource)
+                return manageResource(cachedEffectResource);
+        }
+
+        //create effect using vertex and fragment shaders
         ramses_internal::GlslEffect effectBlock(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.getGeometryShader(), effectDesc.impl.getCompilerDefines(),
             effectDesc.impl.getSemanticsMap(), effectName);
-        errorMessages.clear();
         ramses_internal::EffectResource* effectResource = effectBlock.createEffectResource(ramses_internal::ResourceCacheFlag(cacheFlag.getValue()));
         if (!effectResource)
         {
@@ -662,6 +750,9 @@ namespace ramses
             LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createEffect  Failed to create effect resource (name: '" << effectName << "') :\n    " << effectBlock.getEffectErrorMessages());
             return {};
         }
+
+        if (m_effectCompilationCache)
+            m_effectCompilationCache->store(cacheKey, *effectResource);
         return manageResource(effectResource);
     }
 }
@@ -51,6 +51,9 @@ namespace ramses_internal
     class BinaryFileOutputStream;
     class BinaryFileInputStream;
     class ClientScene;
+    class ResourceTableOfContents;
+    class EffectCompilationCache;
+    class ResourcePrefetcher;
 }
 
 namespace ramses
@@ -173,10 +176,16 @@ namespace ramses
 
         friend class LoadSceneRunnable;
 
+        // same as number of framework task executor threads
+        static constexpr uint32_t NumResourcePrefetchTasks = 3u;
+
         ramses_internal::ManagedResource manageResource(const ramses_internal::IResource* res);
 
         Scene* prepareSceneFromInputStream(const char* caller, std::string const& filename, ramses_internal::IInputStream& inputStream, bool localOnly);
-        Scene* prepareSceneFromFile(const char* caller, std::string const& sceneFilename, bool localOnly);
+        Scene* prepareSceneFromFile(const char* caller, std::string const& sceneFilename, bool localOnly, bool prefetchResources = false);
+        void startResourcePrefetch(Scene& scene, const ramses_internal::ResourceFileInputStreamSPtr& resourceFile, std::string const& filename, const ramses_internal::ResourceTableOfContents& toc);
+        // running prefetch tasks skip remaining entries, no new prefetch is started
+        void stopResourcePrefetch();
         void finalizeLoadedScene(Scene* scene);
 
         status_t validateScenes(uint32_t indent, StatusObjectSet& visitedObjects) const;
@@ -193,6 +202,7 @@ namespace ramses
         std::unique_ptr<ramses_internal::FlushSceneVersion> m_cmdFlushSceneVersion;
         std::unique_ptr<ramses_internal::DumpSceneToFile> m_cmdDumpSceneToFile;
         std::unique_ptr<ramses_internal::LogResourceMemoryUsage> m_cmdLogResourceMemoryUsage;
+        std::unique_ptr<ramses_internal::EffectCompilationCache> m_effectCompilationCache;
 
         RamsesFrameworkImpl& m_framework;
         mutable ramses_internal::PlatformLock m_clientLock;
@@ -202,6 +212,10 @@ namespace ramses
 
         std::vector<SceneLoadStatus> m_asyncSceneLoadStatusVec;
 
+        // stopped on destruction so that draining load queue does not wait for resources nobody will use
+        std::vector<std::weak_ptr<ramses_internal::ResourcePrefetcher>> m_resourcePrefetchers;
+        bool m_resourcePrefetchStopped = false;
+
         ResourceDataPool m_resourceDataPool;
     };
 
@@ -23,7 +23,7 @@ namespace ramses_internal
         {
             LOG_INFO(CONTEXT_CLIENT, "RamsesVersion::WriteToStream: Version: " << versionString << " Git Hash: " << gitHash);
             StringOutputStream out;
-            out << "[RamsesVersion:" << versionString << "]\n[GitHash:" << gitHash << "]\n";
+            out << "[RamsesVersion:" << versionString << "]\n[GitHash:" << gitHash << "]\n[FileFormatVersion:" << FileFormatVersion << "]\n";
             stream.write(out.c_str(), out.size());
         }
 
@@ -126,6 +126,15 @@ namespace ramses_internal
             return true;
         }
 
+        static bool ExpectFileFormatVersion(const String& fileFormatVersionString, VersionInfo& outVersion)
+        {
+            UInt idx = 0;
+            return ExpectString(fileFormatVersionString, idx, "[FileFormatVersion:") &&
+                ExpectAndGetNumber(fileFormatVersionString, idx, outVersion.fileFormatVersion) &&
+                ExpectString(fileFormatVersionString, idx, "]") &&
+                idx == fileFormatVersionString.size();
+        }
+
         bool ReadFromStream(IInputStream& stream, VersionInfo& outVersion)
         {
             String versionString;
@@ -141,6 +150,13 @@ namespace ramses_internal
                 !ExpectGitHash(gitHashString, outVersion))
                 return false;
 
+            // files written before format version was introduced continue with binary data here,
+            // they are reported with format version 0 and can not be read any further
+            String fileFormatVersionString;
+            if (!ReadUntilNewline(stream, 100, fileFormatVersionString) ||
+                !ExpectFileFormatVersion(fileFormatVersionString, outVersion))
+                outVersion.fileFormatVersion = 0u;
+
             return true;
         }
 
@@ -18,12 +18,20 @@ namespace ramses_internal
 
     namespace RamsesVersion
     {
+        // must be increased whenever binary format of scene or resource files changes, files of other format version are rejected
+        // version 0: files without format version information
+        // version 1: resources larger than LZ4CompressionUtils::ChunkSize are compressed in independent chunks
+        // version 2: scenes are stored as binary snapshot (ScenePersistation::WriteSceneToStream)
+        // version 3: scene objects of every type are stored as one block prefixed by its size
+        constexpr UInt32 FileFormatVersion = 3u;
+
         struct VersionInfo
         {
             String gitHash;
             String versionString;
             UInt32 major;
             UInt32 minor;
+            UInt32 fileFormatVersion = 0u;
         };
 
         void WriteToStream(IOutputStream& stream, const String& versionString, const String& gitHash);
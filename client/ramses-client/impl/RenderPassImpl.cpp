@@ -396,4 +396,15 @@ namespace ramses
         getIScene().retriggerRenderPassRenderOnce(m_renderPassHandle);
         return StatusOK;
     }
+
+    status_t RenderPassImpl::setFrustumCulling(bool enable)
+    {
+        getIScene().setRenderPassFrustumCulling(m_renderPassHandle, enable);
+        return StatusOK;
+    }
+
+    bool RenderPassImpl::isFrustumCullingEnabled() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isFrustumCullingEnabled;
+    }
 }
@@ -75,6 +75,9 @@ namespace ramses
         bool     isRenderOnce() const;
         status_t retriggerRenderOnce();
 
+        status_t setFrustumCulling(bool enable);
+        bool     isFrustumCullingEnabled() const;
+
         ramses_internal::RenderPassHandle getRenderPassHandle() const;
 
     private:
@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ResourcePrefetcher.h"
+#include "ClientApplicationLogic.h"
+#include "Components/ResourcePersistation.h"
+#include "TaskFramework/ITaskQueue.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/LogMacros.h"
+#include "PlatformAbstraction/PlatformTime.h"
+
+namespace ramses_internal
+{
+    ResourcePrefetcher::ResourcePrefetcher(ClientApplicationLogic& appLogic, ResourceFileInputStreamSPtr resourceFile, std::string filePath, std::vector<ResourceFileEntry> entries)
+        : m_appLogic(appLogic)
+        , m_resourceFile(std::move(resourceFile))
+        , m_filePath(std::move(filePath))
+        , m_entries(std::move(entries))
+    {
+    }
+
+    void ResourcePrefetcher::start(ITaskQueue& taskQueue, UInt32 numTasks)
+    {
+        m_startTime = PlatformTime::GetMillisecondsMonotonic();
+        m_runningTasks = numTasks;
+        for (UInt32 i = 0u; i < numTasks; ++i)
+        {
+            PrefetchTask* task = new PrefetchTask(shared_from_this());
+            if (!taskQueue.enqueue(*task))
+                --m_runningTasks;
+            task->release();
+        }
+    }
+
+    void ResourcePrefetcher::stop()
+    {
+        m_stopped = true;
+
+        // release resources outside of lock, resource deleter locks resource storage
+        ManagedResourceVector resources;
+        {
+            std::lock_guard<std::mutex> l{ m_resourcesLock };
+            resources.swap(m_resources);
+        }
+    }
+
+    size_t ResourcePrefetcher::getNumberOfPrefetchedResources() const
+    {
+        std::lock_guard<std::mutex> l{ m_resourcesLock };
+        return m_resources.size();
+    }
+
+    void ResourcePrefetcher::prefetchFromQueue()
+    {
+        // file streams are not thread safe, each task reads through its own stream unless file is mapped
+        const std::shared_ptr<MemoryMappedFile>& mappedFile = m_resourceFile->getMemoryMapping();
+        std::unique_ptr<File> file;
+        std::unique_ptr<BinaryFileInputStream> stream;
+        if (!mappedFile)
+        {
+            file = std::make_unique<File>(m_filePath.c_str());
+            stream = std::make_unique<BinaryFileInputStream>(*file);
+            if (stream->getState() != EStatus::Ok)
+            {
+                LOG_WARN(CONTEXT_CLIENT, "ResourcePrefetcher::prefetchFromQueue: failed to open " << m_filePath << ", resources will be loaded on demand");
+                return;
+            }
+        }
+
+        for (size_t entryIdx = m_nextEntryIdx++; entryIdx < m_entries.size() && !m_stopped; entryIdx = m_nextEntryIdx++)
+        {
+            const ResourceFileEntry& entry = m_entries[entryIdx];
+            // already loaded, e.g. used by other scene
+            if (m_appLogic.getResource(entry.resourceInfo.hash))
+                continue;
+
+            IResource* resource = mappedFile ?
+                ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFile, entry) :
+                ResourcePersistation::RetrieveResourceFromStream(*stream, entry);
+            if (!resource)
+                continue;
+            resource->decompress();
+
+            ManagedResource managedResource = m_appLogic.addResource(resource, true);
+            std::lock_guard<std::mutex> l{ m_resourcesLock };
+            if (!m_stopped)
+                m_resources.push_back(std::move(managedResource));
+        }
+    }
+
+    ResourcePrefetcher::PrefetchTask::PrefetchTask(std::shared_ptr<ResourcePrefetcher> prefetcher)
+        : m_prefetcher(std::move(prefetcher))
+    {
+    }
+
+    void ResourcePrefetcher::PrefetchTask::execute()
+    {
+        m_prefetcher->prefetchFromQueue();
+
+        if (--m_prefetcher->m_runningTasks == 0u)
+        {
+            LOG_INFO(CONTEXT_CLIENT, "ResourcePrefetcher: prefetched " << m_prefetcher->getNumberOfPrefetchedResources() << " of " << m_prefetcher->m_entries.size()
+                << " resources from '" << m_prefetcher->m_filePath << "' in " << (PlatformTime::GetMillisecondsMonotonic() - m_prefetcher->m_startTime) << " ms");
+        }
+    }
+}
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEPREFETCHER_H
+#define RAMSES_RESOURCEPREFETCHER_H
+
+#include "Components/ManagedResource.h"
+#include "Components/ResourceFileInputStream.h"
+#include "Components/ResourceTableOfContents.h"
+#include "TaskFramework/ITask.h"
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace ramses_internal
+{
+    class ClientApplicationLogic;
+    class ITaskQueue;
+
+    // Loads and decompresses resources from a resource file in multiple tasks ahead of time, so that first flush
+    // of a scene loaded from file finds them already managed instead of loading them one by one while holding framework lock.
+    // Tasks pick entries in order of their offset in file, each task reads through its own file stream (or from memory mapping
+    // if file is mapped). Prefetched resources are kept alive until stop is called.
+    class ResourcePrefetcher : public std::enable_shared_from_this<ResourcePrefetcher>
+    {
+    public:
+        ResourcePrefetcher(ClientApplicationLogic& appLogic, ResourceFileInputStreamSPtr resourceFile, std::string filePath, std::vector<ResourceFileEntry> entries);
+
+        ResourcePrefetcher(const ResourcePrefetcher&) = delete;
+        ResourcePrefetcher& operator=(const ResourcePrefetcher&) = delete;
+
+        void start(ITaskQueue& taskQueue, UInt32 numTasks);
+        // entries not loaded yet are skipped, prefetched resources are released
+        void stop();
+
+        size_t getNumberOfPrefetchedResources() const;
+
+    private:
+        class PrefetchTask : public ITask
+        {
+        public:
+            explicit PrefetchTask(std::shared_ptr<ResourcePrefetcher> prefetcher);
+            virtual void execute() override;
+
+        private:
+            std::shared_ptr<ResourcePrefetcher> m_prefetcher;
+        };
+
+        void prefetchFromQueue();
+
+        ClientApplicationLogic& m_appLogic;
+        const ResourceFileInputStreamSPtr m_resourceFile;
+        const std::string m_filePath;
+        const std::vector<ResourceFileEntry> m_entries;
+
+        std::atomic<size_t> m_nextEntryIdx{ 0u };
+        std::atomic<bool> m_stopped{ false };
+        std::atomic<UInt32> m_runningTasks{ 0u };
+        UInt64 m_startTime = 0u;
+
+        mutable std::mutex m_resourcesLock;
+        ManagedResourceVector m_resources;
+    };
+}
+
+#endif
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "SceneImpl.h"
+#include "ResourcePrefetcher.h"
 
 #include "ramses-client-api/RamsesClient.h"
 #include "ramses-client-api/RenderBuffer.h"
@@ -104,6 +105,8 @@
 #include "DataTypeUtils.h"
 #include "RamsesVersion.h"
 #include "Scene/ScenePersistation.h"
+#include "Utils/RawBinaryInputStream.h"
+#include "PlatformAbstraction/PlatformThread.h"
 
 #include "Resource/ArrayResource.h"
 #include "Resource/TextureResource.h"
@@ -115,6 +118,9 @@
 #include "ResourceDataPoolImpl.h"
 
 #include <array>
+#include <atomic>
+#include <functional>
+#include <algorithm>
 
 namespace ramses
 {
@@ -141,6 +147,8 @@ namespace ramses
             delete &RamsesObjectTypeUtils::ConvertTo<SceneObject>(*it);
         }
 
+        if (m_resourcePrefetcher)
+            m_resourcePrefetcher->stop();
         closeSceneFile();
 
         getClientImpl().getFramework().getPeriodicLogger().removeStatisticCollectionScene(m_scene.getSceneId());
@@ -154,6 +162,13 @@ namespace ramses
     {
     }
 
+    namespace
+    {
+        // block sizes come from file, block data is read in chunks of at most this size so that a corrupted size
+        // fails at end of stream instead of allocating memory for the whole announced size upfront
+        constexpr uint32_t MaxObjectBlockReadChunkSize = 1024u * 1024u;
+    }
+
     status_t SceneImpl::serialize(ramses_internal::IOutputStream& outStream, SerializationContext& serializationContext) const
     {
         CHECK_RETURN_ERR(ClientObjectImpl::serialize(outStream, serializationContext));
@@ -212,6 +227,201 @@ namespace ramses
         return StatusOK;
     }
 
+    // Objects of one type as stored in scene file. Impls of all blocks are created upfront in file order, so scene object ids
+    // are assigned deterministically, data of the blocks is then deserialized independently of each other.
+    struct SceneImpl::SceneObjectBlock
+    {
+        ERamsesObjectType type = ERamsesObjectType_Invalid;
+        std::vector<ramses_internal::Byte> data;
+        std::vector<RamsesObjectImpl*> impls;
+        std::vector<ObjectIDType> objectIDs;
+        RamsesObject* (*createObject)(RamsesObjectImpl&) = nullptr;
+        status_t status = StatusOK;
+    };
+
+    namespace
+    {
+        constexpr uint32_t MaxDeserializationWorkerThreads = 3u;
+        // smaller scenes are deserialized faster than threads can be started
+        constexpr size_t MinDataSizeForParallelDeserialization = 32u * 1024u;
+
+        // Processes blocks by index in worker threads and calling thread, each thread picks next unprocessed block
+        class SceneObjectBlockProcessor : public ramses_internal::Runnable
+        {
+        public:
+            SceneObjectBlockProcessor(uint32_t numBlocks, std::function<bool(uint32_t)> processBlock)
+                : m_numBlocks(numBlocks)
+                , m_processBlock(std::move(processBlock))
+            {
+            }
+
+            virtual void run() override
+            {
+                for (uint32_t blockIdx = m_nextBlockIdx++; blockIdx < m_numBlocks && !m_failed; blockIdx = m_nextBlockIdx++)
+                {
+                    if (!m_processBlock(blockIdx))
+                        m_failed = true;
+                }
+            }
+
+            bool processAll(uint32_t numWorkers)
+            {
+                std::vector<std::unique_ptr<ramses_internal::PlatformThread>> workers;
+                for (uint32_t i = 0u; i < numWorkers; ++i)
+                {
+                    workers.push_back(std::make_unique<ramses_internal::PlatformThread>("R_SceneObjLoad"));
+                    workers.back()->start(*this);
+                }
+                run();
+                for (auto& worker : workers)
+                    worker->join();
+
+                return !m_failed;
+            }
+
+        private:
+            const uint32_t m_numBlocks;
+            std::function<bool(uint32_t)> m_processBlock;
+            std::atomic<uint32_t> m_nextBlockIdx{ 0u };
+            std::atomic<bool> m_failed{ false };
+        };
+
+        bool IsDeserializedOnCallingThread(ERamsesObjectType type)
+        {
+            // animation systems access internal scene and register their nested animation objects to deserialization context
+            return type == ERamsesObjectType_AnimationSystem || type == ERamsesObjectType_AnimationSystemRealTime;
+        }
+    }
+
+    template <typename ObjectType, typename ObjectImplType>
+    void SceneImpl::createTypedObjectImplsForBlock(SceneObjectBlock& block, uint32_t count)
+    {
+        block.impls.reserve(count);
+        for (uint32_t i = 0u; i < count; ++i)
+            block.impls.push_back(&createImplHelper<ObjectImplType>(*this, TYPE_ID_OF_RAMSES_OBJECT<ObjectType>::ID));
+        block.createObject = [](RamsesObjectImpl& impl) -> RamsesObject* { return new ObjectType(static_cast<ObjectImplType&>(impl)); };
+    }
+
+    status_t SceneImpl::createObjectImplsForBlock(SceneObjectBlock& block, uint32_t count)
+    {
+        switch (block.type)
+        {
+        case ERamsesObjectType_Node:
+            createTypedObjectImplsForBlock<Node, NodeImpl>(block, count);
+            break;
+        case ERamsesObjectType_MeshNode:
+            createTypedObjectImplsForBlock<MeshNode, MeshNodeImpl>(block, count);
+            break;
+        case ERamsesObjectType_PerspectiveCamera:
+            createTypedObjectImplsForBlock<PerspectiveCamera, CameraNodeImpl>(block, count);
+            break;
+        case ERamsesObjectType_OrthographicCamera:
+            createTypedObjectImplsForBlock<OrthographicCamera, CameraNodeImpl>(block, count);
+            break;
+        case ERamsesObjectType_Appearance:
+            createTypedObjectImplsForBlock<Appearance, AppearanceImpl>(block, count);
+            break;
+        case ERamsesObjectType_GeometryBinding:
+            createTypedObjectImplsForBlock<GeometryBinding, GeometryBindingImpl>(block, count);
+            break;
+        case ERamsesObjectType_StreamTexture:
+            createTypedObjectImplsForBlock<StreamTexture, StreamTextureImpl>(block, count);
+            break;
+        case ERamsesObjectType_AnimationSystem:
+            createTypedObjectImplsForBlock<AnimationSystem, AnimationSystemImpl>(block, count);
+            break;
+        case ERamsesObjectType_AnimationSystemRealTime:
+            createTypedObjectImplsForBlock<AnimationSystemRealTime, AnimationSystemImpl>(block, count);
+            break;
+        case ERamsesObjectType_RenderGroup:
+            createTypedObjectImplsForBlock<RenderGroup, RenderGroupImpl>(block, count);
+            break;
+        case ERamsesObjectType_RenderPass:
+            createTypedObjectImplsForBlock<RenderPass, RenderPassImpl>(block, count);
+            break;
+        case ERamsesObjectType_BlitPass:
+            createTypedObjectImplsForBlock<BlitPass, BlitPassImpl>(block, count);
+            break;
+        case ERamsesObjectType_PickableObject:
+            createTypedObjectImplsForBlock<PickableObject, PickableObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_SceneReference:
+            createTypedObjectImplsForBlock<SceneReference, SceneReferenceImpl>(block, count);
+            break;
+        case ERamsesObjectType_RenderBuffer:
+            createTypedObjectImplsForBlock<RenderBuffer, RenderBufferImpl>(block, count);
+            break;
+        case ERamsesObjectType_RenderTarget:
+            createTypedObjectImplsForBlock<RenderTarget, RenderTargetImpl>(block, count);
+            break;
+        case ERamsesObjectType_TextureSampler:
+            createTypedObjectImplsForBlock<TextureSampler, TextureSamplerImpl>(block, count);
+            break;
+        case ERamsesObjectType_TextureSamplerMS:
+            createTypedObjectImplsForBlock<TextureSamplerMS, TextureSamplerImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataFloat:
+            createTypedObjectImplsForBlock<DataFloat, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector2f:
+            createTypedObjectImplsForBlock<DataVector2f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector3f:
+            createTypedObjectImplsForBlock<DataVector3f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector4f:
+            createTypedObjectImplsForBlock<DataVector4f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataMatrix22f:
+            createTypedObjectImplsForBlock<DataMatrix22f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataMatrix33f:
+            createTypedObjectImplsForBlock<DataMatrix33f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataMatrix44f:
+            createTypedObjectImplsForBlock<DataMatrix44f, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataInt32:
+            createTypedObjectImplsForBlock<DataInt32, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector2i:
+            createTypedObjectImplsForBlock<DataVector2i, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector3i:
+            createTypedObjectImplsForBlock<DataVector3i, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataVector4i:
+            createTypedObjectImplsForBlock<DataVector4i, DataObjectImpl>(block, count);
+            break;
+        case ERamsesObjectType_DataBufferObject:
+            createTypedObjectImplsForBlock<ArrayBuffer, ArrayBufferImpl>(block, count);
+            break;
+        case ERamsesObjectType_Texture2DBuffer:
+            createTypedObjectImplsForBlock<Texture2DBuffer, Texture2DBufferImpl>(block, count);
+            break;
+        case ERamsesObjectType_ArrayResource:
+            createTypedObjectImplsForBlock<ArrayResource, ArrayResourceImpl>(block, count);
+            break;
+        case ERamsesObjectType_Texture2D:
+            createTypedObjectImplsForBlock<Texture2D, Texture2DImpl>(block, count);
+            break;
+        case ERamsesObjectType_Texture3D:
+            createTypedObjectImplsForBlock<Texture3D, Texture3DImpl>(block, count);
+            break;
+        case ERamsesObjectType_TextureCube:
+            createTypedObjectImplsForBlock<TextureCube, TextureCubeImpl>(block, count);
+            break;
+        case ERamsesObjectType_Effect:
+            createTypedObjectImplsForBlock<Effect, EffectImpl>(block, count);
+            break;
+
+        default:
+            return addErrorEntry("Scene::deserialize failed, unexpected object type in file stream.");
+        }
+
+        return StatusOK;
+    }
+
     status_t SceneImpl::deserialize(ramses_internal::IInputStream& inStream, DeserializationContext& serializationContext)
     {
         CHECK_RETURN_ERR(ClientObjectImpl::deserialize(inStream, serializationContext));
@@ -228,137 +438,123 @@ namespace ramses
 
         std::array<uint32_t, ERamsesObjectType_NUMBER_OF_TYPES> objectCounts = {};
 
-        for (uint32_t i = 0u; i < typesCount; ++i)
+        std::vector<SceneObjectBlock> blocks(typesCount);
+        // impls are owned by blocks until wrapped into their objects and registered
+        const auto deleteUnregisteredImpls = [&blocks]()
+        {
+            for (auto& block : blocks)
+            {
+                for (auto impl : block.impls)
+                    delete impl;
+                block.impls.clear();
+            }
+        };
+
+        size_t totalDataSize = 0u;
+        for (auto& block : blocks)
         {
             uint32_t count = 0u;
-            const ERamsesObjectType type = SerializationHelper::DeserializeObjectTypeAndCount(inStream, count);
-            assert(m_objectRegistry.getNumberOfObjects(type) == 0u);
-            m_objectRegistry.reserveAdditionalObjectCapacity(type, count);
-            objectCounts[type] = count;
+            uint32_t blockSize = 0u;
+            block.type = SerializationHelper::DeserializeObjectTypeAndCount(inStream, count, blockSize);
+            // every object is stored at least with its object ID
+            if (inStream.getState() != ramses_internal::EStatus::Ok || count > blockSize)
+            {
+                deleteUnregisteredImpls();
+                return addErrorEntry("Scene::deserialize failed, object block header in file stream corrupted.");
+            }
+            for (uint32_t bytesRead = 0u; bytesRead < blockSize && inStream.getState() == ramses_internal::EStatus::Ok;)
+            {
+                const uint32_t chunkSize = std::min(blockSize - bytesRead, MaxObjectBlockReadChunkSize);
+                block.data.resize(bytesRead + chunkSize);
+                inStream.read(block.data.data() + bytesRead, chunkSize);
+                bytesRead += chunkSize;
+            }
+            if (inStream.getState() != ramses_internal::EStatus::Ok)
+            {
+                deleteUnregisteredImpls();
+                return addErrorEntry("Scene::deserialize failed, could not read object block from file stream.");
+            }
+            totalDataSize += blockSize;
 
-            status_t status = StatusOK;
-            switch (type)
+            const status_t status = createObjectImplsForBlock(block, count);
+            if (status != StatusOK)
+            {
+                deleteUnregisteredImpls();
+                return status;
+            }
+
+            assert(m_objectRegistry.getNumberOfObjects(block.type) == 0u);
+            m_objectRegistry.reserveAdditionalObjectCapacity(block.type, count);
+            objectCounts[block.type] = count;
+        }
+
+        const auto deserializeBlock = [this, &serializationContext](SceneObjectBlock& block)
+        {
+            ramses_internal::RawBinaryInputStream blockStream(block.data.data(), block.data.size());
+            block.objectIDs.resize(block.impls.size());
+            for (size_t i = 0u; i < block.impls.size() && block.status == StatusOK; ++i)
+            {
+                block.objectIDs[i] = SerializationHelper::DeserializeObjectID(blockStream);
+                block.status = block.impls[i]->deserialize(blockStream, serializationContext);
+            }
+            if (block.status == StatusOK && (blockStream.getState() != ramses_internal::EStatus::Ok || blockStream.getBytesRead() != block.data.size()))
+                block.status = addErrorEntry(std::string("Scene::deserialize failed, data of ") + RamsesObjectTypeUtils::GetRamsesObjectTypeName(block.type) + " objects in file stream corrupted.");
+            return block.status == StatusOK;
+        };
+
+        std::vector<SceneObjectBlock*> parallelBlocks;
+        parallelBlocks.reserve(blocks.size());
+        for (auto& block : blocks)
+        {
+            if (!IsDeserializedOnCallingThread(block.type))
             {
-            case ERamsesObjectType_Node:
-                status = createAndDeserializeObjectImpls<Node, NodeImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_MeshNode:
-                status = createAndDeserializeObjectImpls<MeshNode, MeshNodeImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_PerspectiveCamera:
-                status = createAndDeserializeObjectImpls<PerspectiveCamera, CameraNodeImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_OrthographicCamera:
-                status = createAndDeserializeObjectImpls<OrthographicCamera, CameraNodeImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_Appearance:
-                status = createAndDeserializeObjectImpls<Appearance, AppearanceImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_GeometryBinding:
-                status = createAndDeserializeObjectImpls<GeometryBinding, GeometryBindingImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_StreamTexture:
-                status = createAndDeserializeObjectImpls<StreamTexture, StreamTextureImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_AnimationSystem:
-                status = createAndDeserializeObjectImpls<AnimationSystem, AnimationSystemImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_AnimationSystemRealTime:
-                status = createAndDeserializeObjectImpls<AnimationSystemRealTime, AnimationSystemImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_RenderGroup:
-                status = createAndDeserializeObjectImpls<RenderGroup, RenderGroupImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_RenderPass:
-                status = createAndDeserializeObjectImpls<RenderPass, RenderPassImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_BlitPass:
-                status = createAndDeserializeObjectImpls<BlitPass, BlitPassImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_PickableObject:
-                status = createAndDeserializeObjectImpls<PickableObject, PickableObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_SceneReference:
-                status = createAndDeserializeObjectImpls<SceneReference, SceneReferenceImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_RenderBuffer:
-                status = createAndDeserializeObjectImpls<RenderBuffer, RenderBufferImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_RenderTarget:
-                status = createAndDeserializeObjectImpls<RenderTarget, RenderTargetImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_TextureSampler:
-                status = createAndDeserializeObjectImpls<TextureSampler, TextureSamplerImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_TextureSamplerMS:
-                status = createAndDeserializeObjectImpls<TextureSamplerMS, TextureSamplerImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataFloat:
-                status = createAndDeserializeObjectImpls<DataFloat, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector2f:
-                status = createAndDeserializeObjectImpls<DataVector2f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector3f:
-                status = createAndDeserializeObjectImpls<DataVector3f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector4f:
-                status = createAndDeserializeObjectImpls<DataVector4f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataMatrix22f:
-                status = createAndDeserializeObjectImpls<DataMatrix22f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataMatrix33f:
-                status = createAndDeserializeObjectImpls<DataMatrix33f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataMatrix44f:
-                status = createAndDeserializeObjectImpls<DataMatrix44f, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataInt32:
-                status = createAndDeserializeObjectImpls<DataInt32, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector2i:
-                status = createAndDeserializeObjectImpls<DataVector2i, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector3i:
-                status = createAndDeserializeObjectImpls<DataVector3i, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataVector4i:
-                status = createAndDeserializeObjectImpls<DataVector4i, DataObjectImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_DataBufferObject:
-                status = createAndDeserializeObjectImpls<ArrayBuffer, ArrayBufferImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_Texture2DBuffer:
-                status = createAndDeserializeObjectImpls<Texture2DBuffer, Texture2DBufferImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_ArrayResource:
-                status = createAndDeserializeObjectImpls<ArrayResource, ArrayResourceImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_Texture2D:
-                status = createAndDeserializeObjectImpls<Texture2D, Texture2DImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_Texture3D:
-                status = createAndDeserializeObjectImpls<Texture3D, Texture3DImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_TextureCube:
-                status = createAndDeserializeObjectImpls<TextureCube, TextureCubeImpl>(inStream, serializationContext, count);
-                break;
-            case ERamsesObjectType_Effect:
-                status = createAndDeserializeObjectImpls<Effect, EffectImpl>(inStream, serializationContext, count);
-                break;
-
-            default:
-                return addErrorEntry("Scene::deserialize failed, unexpected object type in file stream.");
+                parallelBlocks.push_back(&block);
             }
+            else if (!deserializeBlock(block))
+            {
+                deleteUnregisteredImpls();
+                return block.status;
+            }
+        }
 
-            CHECK_RETURN_ERR(status);
+        // biggest blocks first, so that no thread is left with a big block at the end
+        std::stable_sort(parallelBlocks.begin(), parallelBlocks.end(), [](const SceneObjectBlock* a, const SceneObjectBlock* b) { return a->data.size() > b->data.size(); });
+        const uint32_t numParallelBlocks = static_cast<uint32_t>(parallelBlocks.size());
+        const uint32_t numWorkers = (numParallelBlocks > 1u && totalDataSize >= MinDataSizeForParallelDeserialization) ?
+            std::min(MaxDeserializationWorkerThreads, numParallelBlocks - 1u) : 0u;
+        SceneObjectBlockProcessor processor{ numParallelBlocks, [&](uint32_t blockIdx) { return deserializeBlock(*parallelBlocks[blockIdx]); } };
+        if (!processor.processAll(numWorkers))
+        {
+            deleteUnregisteredImpls();
+            const auto failedBlock = std::find_if(blocks.cbegin(), blocks.cend(), [](const SceneObjectBlock& block) { return block.status != StatusOK; });
+            assert(failedBlock != blocks.cend());
+            return failedBlock->status;
+        }
+
+        for (auto& block : blocks)
+        {
+            for (size_t i = 0u; i < block.impls.size(); ++i)
+            {
+                if (!serializationContext.registerObjectImpl(block.impls[i], block.objectIDs[i]))
+                {
+                    deleteUnregisteredImpls();
+                    return addErrorEntry("Deserialization of object failed, object data serialized with wrong ID or data in file corrupted.");
+                }
+
+                RamsesObject* object = block.createObject(*block.impls[i]);
+                block.impls[i] = nullptr;
+                m_objectRegistry.addObject(*object);
+
+                if (auto resource = RamsesUtils::TryConvert<Resource>(*object))
+                    m_resources.insert({ resource->getResourceId(), resource });
+            }
+            block.impls.clear();
         }
 
         inStream >> m_lastSceneObjectId.getReference();
 
         LOG_DEBUG_F(ramses_internal::CONTEXT_PROFILING, ([&](ramses_internal::StringOutputStream& sos) {
-                    sos << "SceneImpl::deserialize: HL scene object counts for SceneID " << m_scene.getSceneId() << "\n";
+                    sos << "SceneImpl::deserialize: HL scene object counts for SceneID " << m_scene.getSceneId() << " (deserialized by " << numWorkers + 1u << " threads)\n";
                     for (uint32_t i = 0; i < ERamsesObjectType_NUMBER_OF_TYPES; i++)
                     {
                         if (objectCounts[i] > 0)
@@ -1431,6 +1627,13 @@ namespace ramses
             return addErrorEntry("Scene::flush: Flushing scene failed, consult logs for more details.");
         getStatisticCollection().statFlushesTriggered.incCounter(1);
 
+        // first flush resolved prefetched resources, any further loading happens on demand as before
+        if (m_resourcePrefetcher)
+        {
+            m_resourcePrefetcher->stop();
+            m_resourcePrefetcher.reset();
+        }
+
         return StatusOK;
     }
 
@@ -2055,6 +2258,11 @@ namespace ramses
         m_sceneFilename = sceneFilename;
     }
 
+    void SceneImpl::setResourcePrefetcher(std::shared_ptr<ramses_internal::ResourcePrefetcher> prefetcher)
+    {
+        m_resourcePrefetcher = std::move(prefetcher);
+    }
+
     void SceneImpl::closeSceneFile()
     {
         if (m_sceneFilename.empty())
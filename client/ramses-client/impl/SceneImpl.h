@@ -40,6 +40,7 @@
 #include "RamsesFrameworkTypesImpl.h"
 #include <chrono>
 #include <unordered_map>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -47,6 +48,7 @@ namespace ramses_internal
     class IScene;
     class ClientScene;
     class EffectResource;
+    class ResourcePrefetcher;
 }
 
 namespace ramses
@@ -287,6 +289,8 @@ namespace ramses
 
         void setSceneFileName(std::string const& sceneFilename);
         void closeSceneFile();
+        // prefetched resources are kept until first flush which takes them over
+        void setResourcePrefetcher(std::shared_ptr<ramses_internal::ResourcePrefetcher> prefetcher);
 
         void updateResourceId(resourceId_t const& oldId, Resource& resourceWithNewId);
 
@@ -343,6 +347,11 @@ namespace ramses
 
         status_t writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream) const;
 
+        struct SceneObjectBlock;
+        status_t createObjectImplsForBlock(SceneObjectBlock& block, uint32_t count);
+        template <typename ObjectType, typename ObjectImplType>
+        void createTypedObjectImplsForBlock(SceneObjectBlock& block, uint32_t count);
+
         bool removeResourceWithIdFromResources(resourceId_t const& id, Resource& resource);
 
         ramses_internal::ClientScene&           m_scene;
@@ -367,6 +376,7 @@ namespace ramses
         std::string m_effectErrorMessages;
 
         std::string m_sceneFilename;
+        std::shared_ptr<ramses_internal::ResourcePrefetcher> m_resourcePrefetcher;
     };
 
     // define here to allow inlining
@@ -69,6 +69,7 @@ namespace ramses
 
     void DeserializationContext::addForDependencyResolve(RamsesObjectImpl* obj)
     {
+        std::lock_guard<std::mutex> g(m_dependingObjectsLock);
         m_dependingObjects.put(obj);
     }
 
@@ -15,6 +15,7 @@
 #include "Collections/IInputStream.h"
 #include "Components/ManagedResource.h"
 #include "SceneAPI/Handles.h"
+#include <mutex>
 
 namespace ramses
 {
@@ -40,6 +41,7 @@ namespace ramses
         template <typename PTR_TYPE>
         static void ReadDependentPointerAndStoreAsID(ramses_internal::IInputStream& inStream, PTR_TYPE*& ptr);
 
+        // can be called concurrently while deserializing independent objects
         void addForDependencyResolve(RamsesObjectImpl* obj);
 
         // phase 2: resolve dependencies
@@ -53,6 +55,7 @@ namespace ramses
         std::vector<RamsesObjectImpl*> m_objectImpls;
         std::vector<NodeImpl*>         m_nodeMap;
         RamsesObjectImplSet m_dependingObjects;
+        std::mutex m_dependingObjectsLock;
     };
 
     class SerializationContext
@@ -11,6 +11,7 @@
 
 #include "SerializationContext.h"
 #include "Collections/IOutputStream.h"
+#include "Utils/BinaryOutputStream.h"
 #include "RamsesObjectImpl.h"
 #include "RamsesObjectRegistry.h"
 #include "RamsesObjectRegistryIterator.h"
@@ -66,6 +67,8 @@ namespace ramses
             outStream << totalCount;
             outStream << static_cast<uint32_t>(typesToSerialize.size());
 
+            // objects of every type are stored as one block prefixed by its size, so that blocks can be read
+            // without parsing preceding ones and deserialized independently
             for (const auto& typeCountIter : typesToSerialize)
             {
                 const ERamsesObjectType type = typeCountIter.first;
@@ -73,11 +76,15 @@ namespace ramses
                 outStream << static_cast<uint32_t>(type);
                 outStream << typeCountIter.second;
 
+                ramses_internal::BinaryOutputStream blockStream;
                 RamsesObjectRegistryIterator iter(registry, type);
                 while (const ObjectsBaseType* obj = iter.getNext<ObjectsBaseType>())
                 {
-                    CHECK_RETURN_ERR(obj->impl.serialize(outStream, serializationContext));
+                    CHECK_RETURN_ERR(obj->impl.serialize(blockStream, serializationContext));
                 }
+
+                outStream << static_cast<uint32_t>(blockStream.getSize());
+                outStream.write(blockStream.getData(), blockStream.getSize());
             }
 
             return StatusOK;
@@ -89,11 +96,12 @@ namespace ramses
             inStream >> typesCount;
         }
 
-        static ERamsesObjectType DeserializeObjectTypeAndCount(ramses_internal::IInputStream& inStream, uint32_t& count)
+        static ERamsesObjectType DeserializeObjectTypeAndCount(ramses_internal::IInputStream& inStream, uint32_t& count, uint32_t& blockSize)
         {
             uint32_t typeInt = ERamsesObjectType_Invalid;
             inStream >> typeInt;
             inStream >> count;
+            inStream >> blockSize;
 
             return static_cast<ERamsesObjectType>(typeInt);
         }
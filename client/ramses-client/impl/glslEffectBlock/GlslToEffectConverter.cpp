@@ -100,12 +100,39 @@ namespace ramses_internal
         }
         else if (storageQualifier == glslang::EvqUniform)
         {
+            if (symbol->getType().getBasicType() == glslang::EbtBlock)
+            {
+                return setUniformBlockInputs(symbol->getType(), String(symbol->getName().c_str()));
+            }
             return setInputTypeFromType(symbol->getType(), String(symbol->getName().c_str()), m_uniformInputs);
         }
 
         return true;
     }
 
+    bool GlslToEffectConverter::setUniformBlockInputs(const glslang::TType& blockType, const String& instanceName)
+    {
+        if (blockType.isArray())
+        {
+            m_message << instanceName << ": arrays of uniform blocks are not supported";
+            return false;
+        }
+
+        // members of uniform block are named same as GL names them: 'BlockName.member' for named block instance,
+        // only 'member' for anonymous block instance (glslang names anonymous instances 'anon@<N>')
+        const bool isAnonymousInstance = instanceName.startsWith("anon@");
+        const String blockName(blockType.getTypeName().c_str());
+        for (const auto& blockField : *blockType.getStruct())
+        {
+            const glslang::TType& fieldType = *blockField.type;
+            const String fieldName(fieldType.getFieldName().c_str());
+            const String memberName = isAnonymousInstance ? fieldName : getStructFieldIdentifier(blockName, fieldName, -1);
+            CHECK_RETURN_ERR(setInputTypeFromType(fieldType, memberName, m_uniformInputs));
+        }
+
+        return true;
+    }
+
     bool GlslToEffectConverter::makeUniformsUnique()
     {
         EffectInputInformationVector temp;
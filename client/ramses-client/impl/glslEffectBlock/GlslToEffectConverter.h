@@ -48,6 +48,7 @@ namespace ramses_internal
         bool parseLinkerObjectsForStage(const TIntermNode* node, EShaderStage stage);
         const glslang::TIntermSequence* getLinkerObjectSequence(const TIntermNode* node) const;
         bool handleSymbol(const glslang::TIntermSymbol* symbol, EShaderStage stage);
+        bool setUniformBlockInputs(const glslang::TType& blockType, const String& instanceName);
 
         bool getElementCountFromType(const glslang::TType& type, const String& inputName, uint32_t& elementCount) const;
         bool setInputTypeFromType(const glslang::TType& type, const String& inputName, EffectInputInformationVector& outputVector) const;
@@ -242,6 +242,32 @@ namespace ramses
         */
         status_t retriggerRenderOnce();
 
+        /**
+        * @brief Enable/disable culling of renderables outside of the camera frustum.
+        * @details By default every visible renderable in the render pass is rendered.
+        *          With frustum culling enabled the renderer computes a bounding box for each renderable
+        *          from its vertex data and skips rendering of those which lie completely outside
+        *          of the frustum of the render pass camera.
+        *
+        *          Culling assumes that vertex positions are transformed by the renderable's model matrix
+        *          and the camera's view and projection matrices. It must not be enabled for render passes
+        *          whose renderables are displaced in the vertex shader beyond that (e.g. skinning,
+        *          billboards or custom projection), as those could be culled even if visible.
+        *          Instanced renderables are never culled.
+        *
+        * @param enable The flag which indicates if renderables outside of camera frustum are culled (Default:false)
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setFrustumCulling(bool enable);
+
+        /**
+        * @brief Get the frustum culling state of the render pass
+        *
+        * @return Indicates if renderables outside of camera frustum are culled
+        */
+        bool isFrustumCullingEnabled() const;
+
         /**
         * Stores internal data for implementation specifics of RenderPass.
         */
@@ -0,0 +1,233 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "EffectCompilationCache.h"
+#include "Resource/EffectResource.h"
+#include "Utils/StatisticCollection.h"
+#include "Utils/File.h"
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <cstdio>
+
+namespace ramses_internal
+{
+    class AnEffectCompilationCache : public ::testing::Test
+    {
+    public:
+        AnEffectCompilationCache()
+            : cache(CacheDirectory, statistics)
+            , key(EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_A" }, {}))
+        {
+            EffectInputInformation uniform;
+            uniform.inputName = "uni";
+            uniform.semantics = EFixedSemantics::ModelViewMatrix;
+            uniformInputs.push_back(uniform);
+            EffectInputInformation attribute;
+            attribute.inputName = "attr";
+            attributeInputs.push_back(attribute);
+        }
+
+        ~AnEffectCompilationCache() override
+        {
+            File(GetEntryPath(key)).remove();
+            File(CacheDirectory).remove();
+        }
+
+        static String GetEntryPath(const ResourceContentHash& entryKey)
+        {
+            return String(CacheDirectory) + fmt::format("/{:016X}{:016X}.effect", entryKey.highPart, entryKey.lowPart);
+        }
+
+        std::unique_ptr<EffectResource> createEffect() const
+        {
+            return std::make_unique<EffectResource>("vert", "frag", "geom", uniformInputs, attributeInputs, "effect", ResourceCacheFlag(0u));
+        }
+
+        static constexpr const char* CacheDirectory = "effectCompilationCacheTest";
+
+        StatisticCollectionFramework statistics;
+        EffectCompilationCache cache;
+        const ResourceContentHash key;
+        EffectInputInformationVector uniformInputs;
+        EffectInputInformationVector attributeInputs;
+    };
+
+    constexpr const char* AnEffectCompilationCache::CacheDirectory;
+
+    TEST_F(AnEffectCompilationCache, createsCacheDirectory)
+    {
+        EXPECT_TRUE(File(CacheDirectory).isDirectory());
+    }
+
+    TEST_F(AnEffectCompilationCache, createsSameKeyForSameInput)
+    {
+        EXPECT_EQ(key, EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_A" }, {}));
+    }
+
+    TEST_F(AnEffectCompilationCache, createsDifferentKeysForDifferentShaderSources)
+    {
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert2", "frag", "geom", { "DEFINE_A" }, {}));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert", "frag2", "geom", { "DEFINE_A" }, {}));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert", "frag", "", { "DEFINE_A" }, {}));
+        EXPECT_NE(EffectCompilationCache::CreateKey("ab", "c", "", {}, {}), EffectCompilationCache::CreateKey("a", "bc", "", {}, {}));
+    }
+
+    TEST_F(AnEffectCompilationCache, createsDifferentKeysForDifferentCompilerDefines)
+    {
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert", "frag", "geom", {}, {}));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_B" }, {}));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_A", "DEFINE_B" }, {}));
+    }
+
+    TEST_F(AnEffectCompilationCache, createsDifferentKeysForDifferentSemanticInputs)
+    {
+        HashMap<String, EFixedSemantics> semantics;
+        semantics.put("uni", EFixedSemantics::ModelViewMatrix);
+        const ResourceContentHash keyWithSemantics = EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_A" }, semantics);
+        EXPECT_NE(key, keyWithSemantics);
+
+        semantics.put("uni", EFixedSemantics::ProjectionMatrix);
+        EXPECT_NE(keyWithSemantics, EffectCompilationCache::CreateKey("vert", "frag", "geom", { "DEFINE_A" }, semantics));
+    }
+
+    TEST_F(AnEffectCompilationCache, createsKeyIndependentOfSemanticInputsInsertionOrder)
+    {
+        HashMap<String, EFixedSemantics> semantics1;
+        HashMap<String, EFixedSemantics> semantics2;
+        for (UInt32 i = 0u; i < 20u; ++i)
+        {
+            semantics1.put(String(fmt::format("input{}", i)), EFixedSemantics::ModelMatrix);
+            semantics2.put(String(fmt::format("input{}", 19u - i)), EFixedSemantics::ModelMatrix);
+        }
+
+        EXPECT_EQ(EffectCompilationCache::CreateKey("vert", "frag", "", {}, semantics1), EffectCompilationCache::CreateKey("vert", "frag", "", {}, semantics2));
+    }
+
+    TEST_F(AnEffectCompilationCache, reportsMissForUnknownKey)
+    {
+        EXPECT_EQ(nullptr, cache.load(key, "effect", ResourceCacheFlag(0u)));
+        EXPECT_EQ(0u, cache.getNumberOfHits());
+        EXPECT_EQ(1u, cache.getNumberOfMisses());
+        EXPECT_EQ(0u, statistics.statEffectCompilationCacheHits.getCounterValue());
+        EXPECT_EQ(1u, statistics.statEffectCompilationCacheMisses.getCounterValue());
+    }
+
+    TEST_F(AnEffectCompilationCache, loadsStoredEffect)
+    {
+        const auto effect = createEffect();
+        EXPECT_TRUE(cache.store(key, *effect));
+
+        std::unique_ptr<EffectResource> loadedEffect(cache.load(key, "otherName", ResourceCacheFlag(15u)));
+        ASSERT_TRUE(loadedEffect);
+        EXPECT_EQ(effect->getHash(), loadedEffect->getHash());
+        EXPECT_STREQ("vert", loadedEffect->getVertexShader());
+        EXPECT_STREQ("frag", loadedEffect->getFragmentShader());
+        EXPECT_STREQ("geom", loadedEffect->getGeometryShader());
+        EXPECT_EQ(uniformInputs, loadedEffect->getUniformInputs());
+        EXPECT_EQ(attributeInputs, loadedEffect->getAttributeInputs());
+        EXPECT_EQ(String("otherName"), loadedEffect->getName());
+        EXPECT_EQ(ResourceCacheFlag(15u), loadedEffect->getCacheFlag());
+
+        EXPECT_EQ(1u, cache.getNumberOfHits());
+        EXPECT_EQ(0u, cache.getNumberOfMisses());
+        EXPECT_EQ(1u, statistics.statEffectCompilationCacheHits.getCounterValue());
+        EXPECT_EQ(0u, statistics.statEffectCompilationCacheMisses.getCounterValue());
+    }
+
+    TEST_F(AnEffectCompilationCache, loadsEffectStoredByOtherCacheInstance)
+    {
+        {
+            StatisticCollectionFramework otherStatistics;
+            EffectCompilationCache otherCache(CacheDirectory, otherStatistics);
+            EXPECT_TRUE(otherCache.store(key, *createEffect()));
+        }
+
+        std::unique_ptr<EffectResource> loadedEffect(cache.load(key, "effect", ResourceCacheFlag(0u)));
+        ASSERT_TRUE(loadedEffect);
+        EXPECT_EQ(createEffect()->getHash(), loadedEffect->getHash());
+    }
+
+    TEST_F(AnEffectCompilationCache, overwritesExistingEntry)
+    {
+        EXPECT_TRUE(cache.store(key, EffectResource("a", "b", "", {}, {}, "", ResourceCacheFlag(0u))));
+        const auto effect = createEffect();
+        EXPECT_TRUE(cache.store(key, *effect));
+
+        std::unique_ptr<EffectResource> loadedEffect(cache.load(key, "effect", ResourceCacheFlag(0u)));
+        ASSERT_TRUE(loadedEffect);
+        EXPECT_EQ(effect->getHash(), loadedEffect->getHash());
+    }
+
+    TEST_F(AnEffectCompilationCache, reportsMissForCorruptedEntry)
+    {
+        EXPECT_TRUE(cache.store(key, *createEffect()));
+
+        File entry(GetEntryPath(key));
+        size_t entrySize = 0u;
+        ASSERT_TRUE(entry.getSizeInBytes(entrySize));
+        ASSERT_TRUE(entry.open(File::Mode::WriteExistingBinary));
+        ASSERT_TRUE(entry.seek(static_cast<std::intptr_t>(entrySize) - 1, File::SeekOrigin::BeginningOfFile));
+        const Byte corruptedByte = 0xAB;
+        ASSERT_TRUE(entry.write(&corruptedByte, 1u));
+        entry.close();
+
+        EXPECT_EQ(nullptr, cache.load(key, "effect", ResourceCacheFlag(0u)));
+        EXPECT_EQ(0u, cache.getNumberOfHits());
+        EXPECT_EQ(1u, cache.getNumberOfMisses());
+    }
+
+    TEST_F(AnEffectCompilationCache, reportsMissForTruncatedEntry)
+    {
+        EXPECT_TRUE(cache.store(key, *createEffect()));
+
+        File entry(GetEntryPath(key));
+        ASSERT_TRUE(entry.open(File::Mode::WriteNewBinary));
+        const Byte someByte = 1u;
+        ASSERT_TRUE(entry.write(&someByte, 1u));
+        entry.close();
+
+        EXPECT_EQ(nullptr, cache.load(key, "effect", ResourceCacheFlag(0u)));
+        EXPECT_EQ(1u, cache.getNumberOfMisses());
+    }
+
+    TEST_F(AnEffectCompilationCache, reportsMissForEntryTruncatedInsideEffectMetadata)
+    {
+        EXPECT_TRUE(cache.store(key, *createEffect()));
+
+        File entry(GetEntryPath(key));
+        size_t entrySize = 0u;
+        ASSERT_TRUE(entry.getSizeInBytes(entrySize));
+        ASSERT_TRUE(entry.open(File::Mode::ReadOnlyBinary));
+        std::vector<Byte> entryData(entrySize);
+        size_t numBytesRead = 0u;
+        ASSERT_EQ(EStatus::Ok, entry.read(entryData.data(), entrySize, numBytesRead));
+        entry.close();
+
+        // keep complete header (format version, key, effect hash, payload size and checksum) and first bytes of metadata
+        const size_t truncatedSize = sizeof(UInt32) + 2u * sizeof(ResourceContentHash) + sizeof(UInt32) + sizeof(UInt64) + 2u;
+        ASSERT_LT(truncatedSize, entrySize);
+        ASSERT_TRUE(entry.open(File::Mode::WriteNewBinary));
+        ASSERT_TRUE(entry.write(entryData.data(), truncatedSize));
+        entry.close();
+
+        EXPECT_EQ(nullptr, cache.load(key, "effect", ResourceCacheFlag(0u)));
+        EXPECT_EQ(1u, cache.getNumberOfMisses());
+    }
+
+    TEST_F(AnEffectCompilationCache, reportsMissForEntryStoredUnderDifferentKey)
+    {
+        const ResourceContentHash otherKey = EffectCompilationCache::CreateKey("vert", "frag", "", {}, {});
+        EXPECT_TRUE(cache.store(otherKey, *createEffect()));
+        // simulate file of other key ending up under name of this key
+        ASSERT_EQ(0, std::rename(GetEntryPath(otherKey).c_str(), GetEntryPath(key).c_str()));
+
+        EXPECT_EQ(nullptr, cache.load(key, "effect", ResourceCacheFlag(0u)));
+        EXPECT_EQ(1u, cache.getNumberOfMisses());
+    }
+}
@@ -734,6 +734,83 @@ TEST_F(AGlslEffect, canParseArrayOfNestedStructUniforms)
     VerifyUniformInputExists(*res, "ans[4].d[1].c.b");
 }
 
+TEST_F(AGlslEffect, canParseUniformBlockMembersWithGLNames)
+{
+    const char* vertexShader = R"SHADER(
+            #version 300 es
+            layout(std140) uniform Camera
+            {
+                mat4 viewMatrix;
+                mat4 projMatrix;
+            };
+            layout(std140) uniform Material
+            {
+                vec4 color;
+                float weights[3];
+            } material;
+            void main(void)
+            {
+                gl_Position = projMatrix * viewMatrix * material.color * material.weights[0];
+            })SHADER";
+    const char* fragmentShader = R"SHADER(
+            #version 300 es
+            precision highp float;
+            layout(std140) uniform Camera
+            {
+                mat4 viewMatrix;
+                mat4 projMatrix;
+            };
+            out lowp vec4 colorOut;
+            void main(void)
+            {
+                colorOut = viewMatrix[0];
+            })SHADER";
+
+    HashMap<String, EFixedSemantics> semantics;
+    semantics.put("viewMatrix", EFixedSemantics::ViewMatrix);
+    semantics.put("projMatrix", EFixedSemantics::ProjectionMatrix);
+
+    GlslEffect ge(vertexShader, fragmentShader, "", emptyCompilerDefines, semantics, "");
+    std::unique_ptr<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    ASSERT_TRUE(res);
+
+    // members of anonymous block instance are accessed directly, members of named block instance with block name prefix
+    const EffectInputInformationVector& uniforms = res->getUniformInputs();
+    ASSERT_EQ(4u, uniforms.size());
+    const auto getUniform = [&](const char* name) { return uniforms[res->getUniformDataFieldHandleByName(name).asMemoryHandle()]; };
+    EXPECT_EQ(EffectInputInformation("viewMatrix", 1, EDataType::Matrix44F, EFixedSemantics::ViewMatrix), getUniform("viewMatrix"));
+    EXPECT_EQ(EffectInputInformation("projMatrix", 1, EDataType::Matrix44F, EFixedSemantics::ProjectionMatrix), getUniform("projMatrix"));
+    EXPECT_EQ(EffectInputInformation("Material.color", 1, EDataType::Vector4F, EFixedSemantics::Invalid), getUniform("Material.color"));
+    EXPECT_EQ(EffectInputInformation("Material.weights", 3, EDataType::Float, EFixedSemantics::Invalid), getUniform("Material.weights"));
+}
+
+TEST_F(AGlslEffect, rejectsArrayOfUniformBlocks)
+{
+    const char* vertexShader = R"SHADER(
+            #version 300 es
+            uniform Light
+            {
+                vec4 position;
+            } lights[2];
+            void main(void)
+            {
+                gl_Position = lights[0].position + lights[1].position;
+            })SHADER";
+
+    const char* fragmentShader = R"SHADER(
+            #version 300 es
+            out lowp vec4 colorOut;
+            void main(void)
+            {
+                colorOut = vec4(0.0);
+            })SHADER";
+
+    GlslEffect ge(vertexShader, fragmentShader, "", emptyCompilerDefines, emptySemanticInputs, "");
+    std::unique_ptr<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    EXPECT_FALSE(res);
+    EXPECT_THAT(ge.getEffectErrorMessages().stdRef(), ::testing::HasSubstr("arrays of uniform blocks are not supported"));
+}
+
 class GlslEffectTestRunnable : public Runnable
 {
 public:
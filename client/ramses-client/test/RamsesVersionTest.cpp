@@ -10,6 +10,7 @@
 #include "gtest/gtest.h"
 #include "Utils/BinaryOutputStream.h"
 #include "Utils/BinaryInputStream.h"
+#include "Utils/RawBinaryInputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "ramses-sdk-build-config.h"
@@ -189,9 +190,35 @@ namespace ramses_internal
 
     TEST_F(ARamsesVersion, canParseHandCraftedVersionInformation)
     {
-        BinaryOutputStream out(CreateOutputStreamFromString("[RamsesVersion:0.0.0]\n[GitHash:d89398fd]\n"));
+        BinaryOutputStream out(CreateOutputStreamFromString("[RamsesVersion:0.0.0]\n[GitHash:d89398fd]\n[FileFormatVersion:12]\n"));
         BinaryInputStream in(out.getData());
         EXPECT_TRUE(RamsesVersion::ReadFromStream(in, info));
+        EXPECT_EQ(12u, info.fileFormatVersion);
+    }
+
+    TEST_F(ARamsesVersion, writesCurrentFileFormatVersion)
+    {
+        BinaryOutputStream out;
+        RamsesVersion::WriteToStream(out, "17.0.1", "af98afa8e94");
+        BinaryInputStream in(out.getData());
+        EXPECT_TRUE(RamsesVersion::ReadFromStream(in, info));
+        EXPECT_EQ(RamsesVersion::FileFormatVersion, info.fileFormatVersion);
+    }
+
+    TEST_F(ARamsesVersion, reportsFileFormatVersionZeroWhenFormatVersionMissing)
+    {
+        const String versionWithoutFormatVersion("[RamsesVersion:0.0.0]\n[GitHash:d89398fd]\n");
+        RawBinaryInputStream in(reinterpret_cast<const Byte*>(versionWithoutFormatVersion.data()), versionWithoutFormatVersion.size());
+        EXPECT_TRUE(RamsesVersion::ReadFromStream(in, info));
+        EXPECT_EQ(0u, info.fileFormatVersion);
+    }
+
+    TEST_F(ARamsesVersion, reportsFileFormatVersionZeroWhenBinaryDataFollowsVersion)
+    {
+        const String versionWithBinaryData("[RamsesVersion:0.0.0]\n[GitHash:d89398fd]\nRAMS\x01\x02\n");
+        RawBinaryInputStream in(reinterpret_cast<const Byte*>(versionWithBinaryData.data()), versionWithBinaryData.size());
+        EXPECT_TRUE(RamsesVersion::ReadFromStream(in, info));
+        EXPECT_EQ(0u, info.fileFormatVersion);
     }
 
     TEST_F(ARamsesVersion, failsWhenHashEntryKeywordWrong)
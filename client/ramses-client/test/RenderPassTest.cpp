@@ -669,4 +669,17 @@ namespace ramses
     {
         EXPECT_NE(StatusOK, renderpass.retriggerRenderOnce());
     }
+
+    TEST_F(ARenderPass, hasFrustumCullingDisabledInitially)
+    {
+        EXPECT_FALSE(renderpass.isFrustumCullingEnabled());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableFrustumCulling)
+    {
+        EXPECT_EQ(StatusOK, renderpass.setFrustumCulling(true));
+        EXPECT_TRUE(renderpass.isFrustumCullingEnabled());
+        EXPECT_EQ(StatusOK, renderpass.setFrustumCulling(false));
+        EXPECT_FALSE(renderpass.isFrustumCullingEnabled());
+    }
 }
@@ -0,0 +1,155 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "ResourcePrefetcher.h"
+#include "ClientApplicationLogic.h"
+#include "ComponentMocks.h"
+#include "Components/ResourceComponent.h"
+#include "Components/ResourcePersistation.h"
+#include "Components/ResourceTableOfContents.h"
+#include "Resource/ArrayResource.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "TaskFramework/TaskForwardingQueue.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/File.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    using namespace testing;
+
+    class AResourcePrefetcher : public testing::Test
+    {
+    public:
+        AResourcePrefetcher()
+            : resourceComponent(statistics, frameworkLock)
+            , appLogic(Guid(555), frameworkLock)
+            , taskExecutor(2u)
+            , taskQueue(taskExecutor)
+        {
+            appLogic.init(resourceComponent, scenegraphProviderComponent);
+            writeResourceFile();
+        }
+
+        ~AResourcePrefetcher()
+        {
+            taskQueue.disableAcceptingTasksAfterExecutingCurrentQueue();
+            appLogic.removeResourceFile(resourceFile.getFileName());
+            resourceFileStream.reset();
+            resourceFile.remove();
+        }
+
+        std::shared_ptr<ResourcePrefetcher> createPrefetcher()
+        {
+            std::vector<ResourceFileEntry> entries;
+            for (const auto& hash : hashes)
+                entries.push_back(toc.getEntryForHash(hash));
+            std::sort(entries.begin(), entries.end(), [](const auto& e1, const auto& e2) { return e1.offsetInBytes < e2.offsetInBytes; });
+
+            return std::make_shared<ResourcePrefetcher>(appLogic, resourceFileStream, resourceFile.getPath().stdRef(), std::move(entries));
+        }
+
+        void waitForPrefetchTasks()
+        {
+            taskQueue.disableAcceptingTasksAfterExecutingCurrentQueue();
+        }
+
+    protected:
+        void writeResourceFile()
+        {
+            ManagedResourceVector resources;
+            for (UInt32 i = 0u; i < NumResources; ++i)
+            {
+                std::vector<float> data(3000u, static_cast<float>(i));
+                const IResource* resource = new ArrayResource(EResourceType_VertexArray, 1000u, EDataType::Vector3F, data.data(), ResourceCacheFlag(0u), "res");
+                resources.push_back(appLogic.addResource(resource, true));
+                hashes.push_back(resources.back()->getHash());
+            }
+
+            {
+                BinaryFileOutputStream outputStream(resourceFile);
+                ResourcePersistation::WriteNamedResourcesWithTOCToStream(outputStream, resources, true);
+            }
+
+            resourceFileStream = std::make_shared<ResourceFileInputStream>(resourceFile.getPath());
+            toc.readTOCPosAndTOCFromStream(resourceFileStream->resourceStream);
+            appLogic.addResourceFile(resourceFileStream, toc);
+        }
+
+        static constexpr UInt32 NumResources = 10u;
+
+        PlatformLock frameworkLock;
+        StatisticCollectionFramework statistics;
+        ResourceComponent resourceComponent;
+        NiceMock<SceneGraphProviderComponentMock> scenegraphProviderComponent;
+        ClientApplicationLogic appLogic;
+        ThreadedTaskExecutor taskExecutor;
+        TaskForwardingQueue taskQueue;
+
+        File resourceFile{ "prefetchTest.ramres" };
+        ResourceFileInputStreamSPtr resourceFileStream;
+        ResourceTableOfContents toc;
+        ResourceContentHashVector hashes;
+    };
+
+    TEST_F(AResourcePrefetcher, loadsAndDecompressesAllResourcesOfFileEntries)
+    {
+        for (const auto& hash : hashes)
+            ASSERT_FALSE(appLogic.getResource(hash));
+
+        auto prefetcher = createPrefetcher();
+        prefetcher->start(taskQueue, 3u);
+        waitForPrefetchTasks();
+
+        EXPECT_EQ(NumResources, prefetcher->getNumberOfPrefetchedResources());
+        for (const auto& hash : hashes)
+        {
+            const ManagedResource resource = appLogic.getResource(hash);
+            ASSERT_TRUE(resource);
+            EXPECT_TRUE(resource->isDeCompressedAvailable());
+        }
+    }
+
+    TEST_F(AResourcePrefetcher, releasesPrefetchedResourcesWhenStopped)
+    {
+        auto prefetcher = createPrefetcher();
+        prefetcher->start(taskQueue, 3u);
+        waitForPrefetchTasks();
+
+        prefetcher->stop();
+        EXPECT_EQ(0u, prefetcher->getNumberOfPrefetchedResources());
+        for (const auto& hash : hashes)
+            EXPECT_FALSE(appLogic.getResource(hash));
+    }
+
+    TEST_F(AResourcePrefetcher, skipsResourcesWhichAreAlreadyLoaded)
+    {
+        const ManagedResource loadedResource = appLogic.loadResource(hashes.front());
+        ASSERT_TRUE(loadedResource);
+
+        auto prefetcher = createPrefetcher();
+        prefetcher->start(taskQueue, 3u);
+        waitForPrefetchTasks();
+
+        EXPECT_EQ(NumResources - 1u, prefetcher->getNumberOfPrefetchedResources());
+        EXPECT_EQ(loadedResource.get(), appLogic.getResource(hashes.front()).get());
+    }
+
+    TEST_F(AResourcePrefetcher, loadsNothingIfStoppedBeforeStart)
+    {
+        auto prefetcher = createPrefetcher();
+        prefetcher->stop();
+        prefetcher->start(taskQueue, 3u);
+        waitForPrefetchTasks();
+
+        EXPECT_EQ(0u, prefetcher->getNumberOfPrefetchedResources());
+        for (const auto& hash : hashes)
+            EXPECT_FALSE(appLogic.getResource(hash));
+    }
+}
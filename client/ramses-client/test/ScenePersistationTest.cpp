@@ -7,6 +7,8 @@
 //  -------------------------------------------------------------------------
 
 #include <array>
+#include <algorithm>
+#include <cstring>
 
 #include "ramses-client-api/MeshNode.h"
 #include "ramses-client-api/AnimationSystemRealTime.h"
@@ -231,6 +233,52 @@ namespace ramses
         EXPECT_NE(geometryIdBeforeSaveAndLoad, camera->getSceneObjectId());
     }
 
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, canReadWriteSceneWithManyObjectsOfDifferentTypes)
+    {
+        // enough objects to have their blocks deserialized in parallel
+        const uint32_t numObjects = 1000u;
+        Node* parent = this->m_scene.createNode("parent");
+        RenderGroup* group = this->m_scene.createRenderGroup("group");
+        std::vector<sceneObjectId_t> nodeIds;
+        for (uint32_t i = 0u; i < numObjects; ++i)
+        {
+            const std::string suffix = std::to_string(i);
+            Node* node = this->m_scene.createNode(("node" + suffix).c_str());
+            EXPECT_EQ(StatusOK, parent->addChild(*node));
+            nodeIds.push_back(node->getSceneObjectId());
+            MeshNode* mesh = this->m_scene.createMeshNode(("mesh" + suffix).c_str());
+            EXPECT_EQ(StatusOK, group->addMeshNode(*mesh, static_cast<int32_t>(i)));
+            DataFloat* data = this->m_scene.createDataFloat(("data" + suffix).c_str());
+            EXPECT_EQ(StatusOK, data->setValue(static_cast<float>(i)));
+        }
+
+        doWriteReadCycle();
+
+        const Node* loadedParent = getObjectForTesting<Node>("parent");
+        const RenderGroup* loadedGroup = getObjectForTesting<RenderGroup>("group");
+        ASSERT_TRUE(loadedParent && loadedGroup);
+        ASSERT_EQ(numObjects, loadedParent->getChildCount());
+        for (uint32_t i = 0u; i < numObjects; ++i)
+        {
+            const std::string suffix = std::to_string(i);
+            const Node* loadedNode = getObjectForTesting<Node>(("node" + suffix).c_str());
+            EXPECT_EQ(loadedNode, loadedParent->getChild(i));
+            EXPECT_EQ(nodeIds[i], loadedNode->getSceneObjectId());
+
+            const MeshNode* loadedMesh = getObjectForTesting<MeshNode>(("mesh" + suffix).c_str());
+            ASSERT_TRUE(loadedMesh);
+            int32_t order = -1;
+            EXPECT_EQ(StatusOK, loadedGroup->getMeshNodeOrder(*loadedMesh, order));
+            EXPECT_EQ(static_cast<int32_t>(i), order);
+
+            const DataFloat* loadedData = getObjectForTesting<DataFloat>(("data" + suffix).c_str());
+            ASSERT_TRUE(loadedData);
+            float value = -1.f;
+            EXPECT_EQ(StatusOK, loadedData->getValue(value));
+            EXPECT_EQ(static_cast<float>(i), value);
+        }
+    }
+
     TEST_F(ASceneAndAnimationSystemLoadedFromFile, canReadWriteAnAppearanceWithUniformValuesSetOrBound)
     {
         Effect* effect = TestEffects::CreateTestEffect(this->m_scene);
@@ -1129,6 +1177,74 @@ namespace ramses
         EXPECT_TRUE(scene == nullptr);
     }
 
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, doesNotLoadSceneFromFileWithOtherFileFormatVersion)
+    {
+        const char* filename = "otherFileFormatVersionFile.ram";
+        m_scene.createNode("node");
+        ASSERT_EQ(StatusOK, m_scene.saveToFile(filename, false));
+
+        std::vector<ramses_internal::Byte> fileData;
+        {
+            ramses_internal::File file(filename);
+            ramses_internal::UInt fileSize = 0;
+            ASSERT_TRUE(file.getSizeInBytes(fileSize));
+            ASSERT_TRUE(file.open(ramses_internal::File::Mode::ReadOnlyBinary));
+            fileData.resize(fileSize);
+            ramses_internal::UInt numBytesRead = 0;
+            ASSERT_EQ(ramses_internal::EStatus::Ok, file.read(fileData.data(), fileSize, numBytesRead));
+        }
+
+        // replace first digit of file format version in version header
+        const std::string formatVersionTag = "[FileFormatVersion:";
+        const auto tagIt = std::search(fileData.begin(), fileData.end(), formatVersionTag.begin(), formatVersionTag.end());
+        ASSERT_TRUE(tagIt + formatVersionTag.size() < fileData.end());
+        *(tagIt + formatVersionTag.size()) = '9';
+
+        {
+            ramses_internal::File file(filename);
+            ASSERT_TRUE(file.open(ramses_internal::File::Mode::WriteOverWriteOldBinary));
+            ASSERT_TRUE(file.write(fileData.data(), fileData.size()));
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile(filename));
+        EXPECT_TRUE(ramses_internal::File(filename).remove());
+    }
+
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, doesNotLoadSceneFromFileWithCorruptedObjectBlockSize)
+    {
+        const char* filename = "corruptedBlockSizeFile.ram";
+        const std::string nodeName = "blockSizeTestNode";
+        m_scene.createNode(nodeName.c_str());
+        ASSERT_EQ(StatusOK, m_scene.saveToFile(filename, false));
+
+        std::vector<ramses_internal::Byte> fileData;
+        {
+            ramses_internal::File file(filename);
+            ramses_internal::UInt fileSize = 0;
+            ASSERT_TRUE(file.getSizeInBytes(fileSize));
+            ASSERT_TRUE(file.open(ramses_internal::File::Mode::ReadOnlyBinary));
+            fileData.resize(fileSize);
+            ramses_internal::UInt numBytesRead = 0;
+            ASSERT_EQ(ramses_internal::EStatus::Ok, file.read(fileData.data(), fileSize, numBytesRead));
+        }
+
+        // node is only object of its block, block size precedes its object ID and name length
+        const auto nameIt = std::search(fileData.begin(), fileData.end(), nodeName.begin(), nodeName.end());
+        ASSERT_TRUE(nameIt != fileData.end());
+        const auto blockSizeOffset = static_cast<size_t>(nameIt - fileData.begin()) - 3u * sizeof(uint32_t);
+        const uint32_t corruptedBlockSize = 0xFFFFFFF0u;
+        std::memcpy(&fileData[blockSizeOffset], &corruptedBlockSize, sizeof(corruptedBlockSize));
+
+        {
+            ramses_internal::File file(filename);
+            ASSERT_TRUE(file.open(ramses_internal::File::Mode::WriteOverWriteOldBinary));
+            ASSERT_TRUE(file.write(fileData.data(), fileData.size()));
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile(filename));
+        EXPECT_TRUE(ramses_internal::File(filename).remove());
+    }
+
     TEST_F(ASceneAndAnimationSystemLoadedFromFile, canHandleAllZeroFileOnResourceLoad)
     {
         const char* filename = "allzerofile.dat";
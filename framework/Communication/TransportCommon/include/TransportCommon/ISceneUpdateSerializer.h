@@ -11,14 +11,30 @@
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "absl/types/span.h"
+#include <functional>
+#include <vector>
+#include <memory>
 
 namespace ramses_internal
 {
+    enum class ESceneActionEncoding
+    {
+        Raw,
+        Compact, // only for receivers known to support it, see SceneActionSerialization::SerializeCompact
+    };
+
     class ISceneUpdateSerializer
     {
     public:
         virtual ~ISceneUpdateSerializer() = default;
         virtual bool writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const = 0;
+
+        // Writes same packets as writeToPackets (with Raw encoding), but data is not necessarily copied into packetMem. Every packet is given as
+        // sequence of segments, either pointing into packetMem (valid only during writeDoneFunc call) or to data which stays
+        // valid as long as object returned by getPacketDataOwner (available from first writeDoneFunc call on) is kept alive.
+        using PacketSegments = std::vector<absl::Span<const Byte>>;
+        virtual bool writeToPacketSegments(absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const PacketSegments&)>& writeDoneFunc) const = 0;
+        virtual std::shared_ptr<const void> getPacketDataOwner() const = 0;
     };
 }
 
@@ -26,6 +26,13 @@ namespace ramses_internal
         absl::Span<const Byte> SerializeData(const SceneActionCollection& actions);
 
         SceneActionCollection Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data);
+
+        // Compact encoding of description and data in one blob: action types and sizes are varint encoded,
+        // data of every action is xor'ed with previous action of same type and size (repeated handles and similar
+        // values become zero bytes) and the result is LZ4 compressed if that makes it smaller.
+        // encodingMemory is used as temporary buffer only, returned span points into workingMemory.
+        absl::Span<const Byte> SerializeCompact(const SceneActionCollection& actions, std::vector<Byte>& workingMemory, std::vector<Byte>& encodingMemory);
+        bool DeserializeCompact(absl::Span<const Byte> compactBlob, SceneActionCollection& actions);
     };
 
     namespace ResourceSerialization
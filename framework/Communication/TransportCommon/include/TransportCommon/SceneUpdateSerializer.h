@@ -10,6 +10,8 @@
 #define RAMSES_SCENEUPDATESERIALIZER_H
 
 #include "TransportCommon/ISceneUpdateSerializer.h"
+#include "Components/ManagedResource.h"
+#include <deque>
 
 namespace ramses_internal
 {
@@ -20,10 +22,24 @@ namespace ramses_internal
     public:
         explicit SceneUpdateSerializer(const SceneUpdate& update);
         bool writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override;
+        bool writeToPacketSegments(absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const PacketSegments&)>& writeDoneFunc) const override;
+        std::shared_ptr<const void> getPacketDataOwner() const override;
 
         const SceneUpdate& getUpdate() const;
     private:
+        // Packets written as segments are created only once per encoding and shared by all receivers of same update,
+        // they reference resource data directly and own copy of remaining packet content.
+        struct PacketCache
+        {
+            size_t packetSize = 0;
+            ManagedResourceVector resources;
+            std::deque<std::vector<Byte>> packetMemData;
+            std::vector<PacketSegments> packets;
+        };
+
         const SceneUpdate& m_update;
+        mutable std::shared_ptr<PacketCache> m_packetCaches[2];  // per ESceneActionEncoding
+        mutable std::shared_ptr<PacketCache> m_lastUsedPacketCache;
     };
 }
 
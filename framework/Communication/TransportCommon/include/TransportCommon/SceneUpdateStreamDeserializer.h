@@ -50,10 +50,11 @@ namespace ramses_internal
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
         Result fail();
 
-        bool finalizeBlock();
-        bool handleSceneActionCollection();
-        bool handleResource();
-        bool handleFlushInfos();
+        bool finalizeBlock(absl::Span<const Byte> block);
+        bool handleSceneActionCollection(absl::Span<const Byte> block);
+        bool handleCompactSceneActionCollection(absl::Span<const Byte> block);
+        bool handleResource(absl::Span<const Byte> block);
+        bool handleFlushInfos(absl::Span<const Byte> block);
 
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
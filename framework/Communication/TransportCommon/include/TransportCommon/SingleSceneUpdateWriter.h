@@ -10,6 +10,7 @@
 #define RAMSES_SINGLESCENEUPDATEWRITER_H
 
 #include "Components/SceneUpdate.h"
+#include "TransportCommon/ISceneUpdateSerializer.h"
 #include "Utils/RawBinaryOutputStream.h"
 #include "absl/types/span.h"
 
@@ -19,6 +20,8 @@ namespace ramses_internal
     {
     public:
         SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc);
+        // resource data is referenced by packet segments instead of being copied to packetMem
+        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const ISceneUpdateSerializer::PacketSegments&)>& writeSegmentsDoneFunc);
 
         bool write();
 
@@ -27,6 +30,7 @@ namespace ramses_internal
             SceneActionCollection = 10,
             Resource              = 11,
             FlushInfos            = 12,
+            CompactSceneActionCollection = 13,
         };
 
         static constexpr const uint32_t hasMorePacketsFlag = 0xCA;
@@ -40,15 +44,22 @@ namespace ramses_internal
         bool writeResource(const IResource& resource);
         bool writeFlushInfos(const FlushInformation& infos);
 
-        bool writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans);
-        bool writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous = false);
+        bool writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans, absl::Span<const Byte> referencableData = {});
+        bool writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous = false, bool referenceData = false);
+        void closePacketMemSegment();
 
         const SceneUpdate&                 m_update;
         const absl::Span<Byte>             m_packetMem;
-        const std::function<bool(size_t)>& m_writeDoneFunc;
+        const std::function<bool(size_t)>* m_writeDoneFunc = nullptr;
+        const std::function<bool(const ISceneUpdateSerializer::PacketSegments&)>* m_writeSegmentsDoneFunc = nullptr;
+        const ESceneActionEncoding         m_sceneActionEncoding = ESceneActionEncoding::Raw;
         RawBinaryOutputStream              m_packetWriter;
+        size_t                             m_packetSize = 0;  // bytes written to packetMem and referenced
+        size_t                             m_packetMemSegmentStart = 0;
+        ISceneUpdateSerializer::PacketSegments m_packetSegments;
         uint32_t                           m_packetNum = 1;
         std::vector<Byte>                  m_temporaryMemToSerializeDescription;  // optimization to avoid allocations
+        std::vector<Byte>                  m_temporaryMemToEncodeSceneActions;
     };
 }
 
@@ -13,6 +13,8 @@
 #include "Utils/BinaryInputStream.h"
 #include "Components/ResourceSerializationHelper.h"
 #include "Components/FlushInformation.h"
+#include "lz4.h"
+#include <array>
 
 
 namespace
@@ -49,6 +51,64 @@ namespace
 
 namespace ramses_internal
 {
+    namespace
+    {
+        constexpr uint8_t CompactSceneActionsFlag_DataCompressed = 1u;
+        // compression of less data does not pay off
+        constexpr size_t CompactSceneActionsMinimumDataSizeToCompress = 128u;
+
+        void WriteVarUInt32(std::vector<Byte>& out, uint32_t value)
+        {
+            while (value >= 0x80u)
+            {
+                out.push_back(static_cast<Byte>(value | 0x80u));
+                value >>= 7u;
+            }
+            out.push_back(static_cast<Byte>(value));
+        }
+
+        bool ReadVarUInt32(absl::Span<const Byte>& in, uint32_t& value)
+        {
+            value = 0u;
+            for (uint32_t shift = 0u; shift < 35u; shift += 7u)
+            {
+                if (in.empty())
+                    return false;
+                const Byte b = in.front();
+                in.remove_prefix(1u);
+                value |= static_cast<uint32_t>(b & 0x7fu) << shift;
+                if ((b & 0x80u) == 0u)
+                    return true;
+            }
+            return false;
+        }
+
+        // Xor's data of an action with data of previous action of same type if both have same size. Applied in action order
+        // on raw data it encodes, applied in place in action order on encoded data it decodes (previous action is already decoded).
+        class SceneActionDeltaCoder
+        {
+        public:
+            void apply(ESceneActionId type, uint32_t offset, uint32_t size, const Byte* reference, Byte* target)
+            {
+                ActionRange& previous = m_previousActionOfType[static_cast<uint32_t>(type)];
+                if (previous.size == size)
+                {
+                    for (uint32_t i = 0u; i < size; ++i)
+                        target[offset + i] ^= reference[previous.offset + i];
+                }
+                previous = { offset, size };
+            }
+
+        private:
+            struct ActionRange
+            {
+                uint32_t offset = 0u;
+                uint32_t size = 0u;
+            };
+            std::array<ActionRange, NumOfSceneActionTypes> m_previousActionOfType;
+        };
+    }
+
     namespace SceneActionSerialization
     {
         absl::Span<const Byte> SerializeDescription(const SceneActionCollection& actions, std::vector<Byte>& workingMemory)
@@ -85,6 +145,109 @@ namespace ramses_internal
             }
             return actions;
         }
+
+        absl::Span<const Byte> SerializeCompact(const SceneActionCollection& actions, std::vector<Byte>& workingMemory, std::vector<Byte>& encodingMemory)
+        {
+            /*
+              Compact format
+              - flags : uint8_t (CompactSceneActionsFlag_*)
+              - number of actions : varint
+              - data size (uncompressed) : varint
+              - for every action: type : varint, size : varint
+              - data, delta encoded and LZ4 compressed when flag set, until end of blob
+             */
+            const std::vector<Byte>& rawData = actions.collectionData();
+            encodingMemory.assign(rawData.cbegin(), rawData.cend());
+
+            const size_t blobStart = workingMemory.size();
+            workingMemory.reserve(blobStart + 2u * sizeof(uint32_t) + 4u * actions.numberOfActions() + rawData.size());
+            workingMemory.push_back(0u);
+            WriteVarUInt32(workingMemory, static_cast<uint32_t>(actions.numberOfActions()));
+            WriteVarUInt32(workingMemory, static_cast<uint32_t>(rawData.size()));
+            SceneActionDeltaCoder deltaCoder;
+            for (const auto& action : actions)
+            {
+                WriteVarUInt32(workingMemory, static_cast<uint32_t>(action.type()));
+                WriteVarUInt32(workingMemory, action.size());
+                deltaCoder.apply(action.type(), action.offsetInCollection(), action.size(), rawData.data(), encodingMemory.data());
+            }
+
+            const size_t dataStart = workingMemory.size();
+            if (encodingMemory.size() >= CompactSceneActionsMinimumDataSizeToCompress)
+            {
+                const int maxCompressedSize = LZ4_compressBound(static_cast<int>(encodingMemory.size()));
+                workingMemory.resize(dataStart + maxCompressedSize);
+                const int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(encodingMemory.data()), reinterpret_cast<char*>(workingMemory.data() + dataStart),
+                    static_cast<int>(encodingMemory.size()), maxCompressedSize);
+                if (compressedSize > 0 && static_cast<size_t>(compressedSize) < encodingMemory.size())
+                {
+                    workingMemory.resize(dataStart + compressedSize);
+                    workingMemory[blobStart] = CompactSceneActionsFlag_DataCompressed;
+                    return { workingMemory.data() + blobStart, workingMemory.size() - blobStart };
+                }
+                workingMemory.resize(dataStart);
+            }
+
+            workingMemory.insert(workingMemory.end(), encodingMemory.cbegin(), encodingMemory.cend());
+            return { workingMemory.data() + blobStart, workingMemory.size() - blobStart };
+        }
+
+        bool DeserializeCompact(absl::Span<const Byte> compactBlob, SceneActionCollection& actions)
+        {
+            if (compactBlob.empty())
+                return false;
+            const uint8_t flags = compactBlob.front();
+            compactBlob.remove_prefix(1u);
+
+            uint32_t numActions = 0u;
+            uint32_t dataSize = 0u;
+            if (!ReadVarUInt32(compactBlob, numActions) || !ReadVarUInt32(compactBlob, dataSize))
+                return false;
+            // every action takes at least two bytes of description, do not trust corrupted counts for allocation
+            if (numActions > compactBlob.size() / 2u)
+                return false;
+
+            SceneActionCollection result(0u, numActions);
+            uint32_t offset = 0u;
+            for (uint32_t i = 0u; i < numActions; ++i)
+            {
+                uint32_t type = 0u;
+                uint32_t size = 0u;
+                if (!ReadVarUInt32(compactBlob, type) || !ReadVarUInt32(compactBlob, size) ||
+                    type >= NumOfSceneActionTypes || size > dataSize - offset)
+                    return false;
+                result.addRawSceneActionInformation(static_cast<ESceneActionId>(type), offset);
+                offset += size;
+            }
+            if (offset != dataSize)
+                return false;
+
+            std::vector<Byte>& data = result.getRawDataForDirectWriting();
+            if ((flags & CompactSceneActionsFlag_DataCompressed) != 0u)
+            {
+                // LZ4 cannot expand data by more than factor 255, do not trust corrupted size for allocation
+                if (dataSize / 255u > compactBlob.size())
+                    return false;
+                data.resize(dataSize);
+                const int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(compactBlob.data()), reinterpret_cast<char*>(data.data()),
+                    static_cast<int>(compactBlob.size()), static_cast<int>(dataSize));
+                if (decompressedSize < 0 || static_cast<uint32_t>(decompressedSize) != dataSize)
+                    return false;
+            }
+            else
+            {
+                if (compactBlob.size() != dataSize)
+                    return false;
+                data.assign(compactBlob.cbegin(), compactBlob.cend());
+            }
+
+            SceneActionDeltaCoder deltaCoder;
+            for (const auto& action : result)
+                deltaCoder.apply(action.type(), action.offsetInCollection(), action.size(), data.data(), data.data());
+
+            actions = std::move(result);
+            return true;
+        }
     }
 
     namespace FlushInformationSerialization
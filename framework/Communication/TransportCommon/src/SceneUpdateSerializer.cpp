@@ -22,6 +22,57 @@ namespace ramses_internal
         return writer.write();
     }
 
+    bool SceneUpdateSerializer::writeToPacketSegments(absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const PacketSegments&)>& writeDoneFunc) const
+    {
+        std::shared_ptr<PacketCache>& packetCache = m_packetCaches[encoding == ESceneActionEncoding::Compact ? 1 : 0];
+        if (!packetCache || packetCache->packetSize != packetMem.size())
+        {
+            auto cache = std::make_shared<PacketCache>();
+            cache->packetSize = packetMem.size();
+            cache->resources = m_update.resources;
+
+            const Byte* packetMemBegin = packetMem.data();
+            const Byte* packetMemEnd = packetMem.data() + packetMem.size();
+            // writer keeps a reference to the function, it must outlive the writer
+            const std::function<bool(const PacketSegments&)> cachePacketFunc = [&](const PacketSegments& segments) {
+                PacketSegments cachedSegments;
+                cachedSegments.reserve(segments.size());
+                for (const auto& segment : segments)
+                {
+                    // packetMem is reused for next packet, its content must be copied
+                    if (!std::less<const Byte*>()(segment.data(), packetMemBegin) && std::less<const Byte*>()(segment.data(), packetMemEnd))
+                    {
+                        cache->packetMemData.emplace_back(segment.begin(), segment.end());
+                        const auto& copy = cache->packetMemData.back();
+                        cachedSegments.push_back({copy.data(), copy.size()});
+                    }
+                    else
+                        cachedSegments.push_back(segment);
+                }
+                cache->packets.push_back(std::move(cachedSegments));
+                return true;
+            };
+            SingleSceneUpdateWriter writer(m_update, packetMem, encoding, cachePacketFunc);
+            if (!writer.write())
+                return false;
+
+            packetCache = std::move(cache);
+        }
+
+        m_lastUsedPacketCache = packetCache;
+        for (const auto& packet : packetCache->packets)
+        {
+            if (!writeDoneFunc(packet))
+                return false;
+        }
+        return true;
+    }
+
+    std::shared_ptr<const void> SceneUpdateSerializer::getPacketDataOwner() const
+    {
+        return m_lastUsedPacketCache;
+    }
+
     const SceneUpdate& SceneUpdateSerializer::getUpdate() const
     {
         return m_update;
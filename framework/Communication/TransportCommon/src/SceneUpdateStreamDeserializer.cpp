@@ -11,9 +11,17 @@
 #include "TransportCommon/SceneUpdateSerializationHelper.h"
 #include "Utils/LogMacros.h"
 #include "Utils/BinaryInputStream.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // block sizes come from the network: memory is reserved only up to this size upfront and larger blocks grow with
+        // their arriving data, buffers grown larger are released after the block instead of being kept for later blocks
+        constexpr size_t MaxBlockBufferReserveSize = 16u * 1024u * 1024u;
+    }
+
     SceneUpdateStreamDeserializer::Result SceneUpdateStreamDeserializer::processData(absl::Span<const Byte> data)
     {
         // check state + input
@@ -61,12 +69,32 @@ namespace ramses_internal
             {
                 if (!startReadingNewBlock(is, data.size()))
                     return fail();
+
+                // block contained fully in packet is deserialized in place, only blocks split over packets are assembled
+                if (m_currentBlockSize <= data.size() - is.getCurrentReadBytes())
+                {
+                    const absl::Span<const Byte> block(is.readPosition(), m_currentBlockSize);
+                    is.skip(m_currentBlockSize);
+                    if (!finalizeBlock(block))
+                        return fail();
+                    continue;
+                }
+
+                if (hasMorePackets == SingleSceneUpdateWriter::lastPacketFlag)
+                {
+                    LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::processData: Block size {} exceeds remaining data {} of last packet (type {})",
+                                m_currentBlockSize, data.size() - is.getCurrentReadBytes(), m_blockType);
+                    return fail();
+                }
+
+                m_currentBlock.reserve(std::min<size_t>(m_currentBlockSize, MaxBlockBufferReserveSize));
+                continueReadingBlock(is, data.size());
             }
 
             // check if read full block
             if (m_currentBlock.size() == m_currentBlockSize)
             {
-                if (!finalizeBlock())
+                if (!finalizeBlock(m_currentBlock))
                     return fail();
             }
         }
@@ -119,23 +147,28 @@ namespace ramses_internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::finalizeBlock()
+    bool SceneUpdateStreamDeserializer::finalizeBlock(absl::Span<const Byte> block)
     {
         SingleSceneUpdateWriter::BlockType blockType = static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType);
 
         if (blockType == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
         {
-            if (!handleSceneActionCollection())
+            if (!handleSceneActionCollection(block))
+                return false;
+        }
+        else if (blockType == SingleSceneUpdateWriter::BlockType::CompactSceneActionCollection)
+        {
+            if (!handleCompactSceneActionCollection(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::Resource)
         {
-            if (!handleResource())
+            if (!handleResource(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::FlushInfos)
         {
-            if (!handleFlushInfos())
+            if (!handleFlushInfos(block))
                 return false;
         }
         else
@@ -145,6 +178,8 @@ namespace ramses_internal
         }
 
         m_currentBlock.clear();
+        if (m_currentBlock.capacity() > MaxBlockBufferReserveSize)
+            m_currentBlock.shrink_to_fit();
         m_currentBlockSize = 0;
         return true;
     }
@@ -152,14 +187,15 @@ namespace ramses_internal
     SceneUpdateStreamDeserializer::Result SceneUpdateStreamDeserializer::fail()
     {
         m_hasFailed = true;
+        m_currentBlock = std::vector<Byte>();
         return Result{ResultType::Failed, SceneActionCollection(), {}, {}};
     }
 
-    bool SceneUpdateStreamDeserializer::handleSceneActionCollection()
+    bool SceneUpdateStreamDeserializer::handleSceneActionCollection(absl::Span<const Byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", block.size());
             return false;
         }
         if (m_currentResult.actions.numberOfActions() != 0)
@@ -168,7 +204,7 @@ namespace ramses_internal
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
@@ -179,15 +215,31 @@ namespace ramses_internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::handleResource()
+    bool SceneUpdateStreamDeserializer::handleCompactSceneActionCollection(absl::Span<const Byte> block)
+    {
+        if (m_currentResult.actions.numberOfActions() != 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompactSceneActionCollection: More than one SceneActionCollection in packet");
+            return false;
+        }
+
+        if (!SceneActionSerialization::DeserializeCompact(block, m_currentResult.actions))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompactSceneActionCollection: Corrupted block (size {})", block.size());
+            return false;
+        }
+        return true;
+    }
+
+    bool SceneUpdateStreamDeserializer::handleResource(absl::Span<const Byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
@@ -199,15 +251,15 @@ namespace ramses_internal
 
     }
 
-    bool SceneUpdateStreamDeserializer::handleFlushInfos()
+    bool SceneUpdateStreamDeserializer::handleFlushInfos(absl::Span<const Byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t))
+        if (block.size() < sizeof(uint32_t))
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t dataSize = 0;
         is >> dataSize;
 
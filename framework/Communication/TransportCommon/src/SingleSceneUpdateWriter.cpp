@@ -15,7 +15,7 @@ namespace ramses_internal
     SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc)
         : m_update(update)
         , m_packetMem(packetMem)
-        , m_writeDoneFunc(writeDoneFunc)
+        , m_writeDoneFunc(&writeDoneFunc)
         , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
     {
         /*
@@ -37,6 +37,9 @@ namespace ramses_internal
           - type list blob
           - data blob
 
+          Compact SceneAction data (BlockType::CompactSceneActionCollection, instead of SceneAction data)
+          - blob in format of SceneActionSerialization::SerializeCompact
+
           Resource data
           - metadata length : uin32_t
           - blob length : uint32_t
@@ -45,6 +48,15 @@ namespace ramses_internal
          */
     }
 
+    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const ISceneUpdateSerializer::PacketSegments&)>& writeSegmentsDoneFunc)
+        : m_update(update)
+        , m_packetMem(packetMem)
+        , m_writeSegmentsDoneFunc(&writeSegmentsDoneFunc)
+        , m_sceneActionEncoding(encoding)
+        , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
+    {
+    }
+
     bool SingleSceneUpdateWriter::write()
     {
         if (m_packetMem.size() < 50)
@@ -68,7 +80,7 @@ namespace ramses_internal
             if (!writeFlushInfos(m_update.flushInfos))
                 return false;
 
-        if (m_packetWriter.getBytesWritten() > 0)
+        if (m_packetSize > 0)
         {
             if (!finalizePacket(false))
                 return false;
@@ -80,6 +92,12 @@ namespace ramses_internal
     bool SingleSceneUpdateWriter::writeSceneActionCollection()
     {
         m_temporaryMemToSerializeDescription.clear();
+        if (m_sceneActionEncoding == ESceneActionEncoding::Compact)
+        {
+            const auto compactSpan = SceneActionSerialization::SerializeCompact(m_update.actions, m_temporaryMemToSerializeDescription, m_temporaryMemToEncodeSceneActions);
+            return writeBlock(BlockType::CompactSceneActionCollection, {compactSpan});
+        }
+
         const auto descSpan = SceneActionSerialization::SerializeDescription(m_update.actions, m_temporaryMemToSerializeDescription);
         const auto dataSpan = SceneActionSerialization::SerializeData(m_update.actions);
 
@@ -100,7 +118,7 @@ namespace ramses_internal
         RawBinaryOutputStream os(header, sizeof(header));
         os << static_cast<uint32_t>(descSpan.size())
            << static_cast<uint32_t>(dataSpan.size());
-        return writeBlock(BlockType::Resource, {{os.getData(), os.getSize()}, descSpan, dataSpan});
+        return writeBlock(BlockType::Resource, {{os.getData(), os.getSize()}, descSpan}, dataSpan);
     }
 
     bool SingleSceneUpdateWriter::writeFlushInfos(const FlushInformation& infos)
@@ -120,11 +138,14 @@ namespace ramses_internal
         // reserve space for packet header, will be written at end
         m_packetWriter << static_cast<uint32_t>(0)
                        << static_cast<uint32_t>(0);  // placeholders
+        m_packetSize = m_packetWriter.getBytesWritten();
+        m_packetMemSegmentStart = 0;
+        m_packetSegments.clear();
     }
 
-    bool SingleSceneUpdateWriter::writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans)
+    bool SingleSceneUpdateWriter::writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans, absl::Span<const Byte> referencableData)
     {
-        size_t blockSize = 0;
+        size_t blockSize = referencableData.size();
         for (const auto s : spans)
             blockSize += s.size();
         Byte header[sizeof(uint32_t)*2];
@@ -138,16 +159,17 @@ namespace ramses_internal
             if (!writeDataToPackets(s))
                 return false;
         }
-        return true;
+        // written last, packets only reference it when written as segments
+        return writeDataToPackets(referencableData, false, m_writeSegmentsDoneFunc != nullptr);
     }
 
-    bool SingleSceneUpdateWriter::writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous)
+    bool SingleSceneUpdateWriter::writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous, bool referenceData)
     {
         while (data.size() > 0)
         {
             const bool startNewPacket = writeContinuous ?
-                (m_packetMem.size() < m_packetWriter.getBytesWritten() + data.size()) :
-                (m_packetMem.size() == m_packetWriter.getBytesWritten());
+                (m_packetMem.size() < m_packetSize + data.size()) :
+                (m_packetMem.size() == m_packetSize);
 
             if (startNewPacket)
             {
@@ -157,24 +179,54 @@ namespace ramses_internal
                 initializePacket();
             }
 
-            const size_t capacityRemaining = m_packetMem.size() - m_packetWriter.getBytesWritten();
+            const size_t capacityRemaining = m_packetMem.size() - m_packetSize;
             const size_t writeBytes = std::min(capacityRemaining, data.size());
 
-            m_packetWriter.write(data.data(), static_cast<uint32_t>(writeBytes));
+            if (referenceData)
+            {
+                closePacketMemSegment();
+                m_packetSegments.push_back(data.subspan(0, writeBytes));
+            }
+            else
+            {
+                m_packetWriter.write(data.data(), static_cast<uint32_t>(writeBytes));
+            }
+            m_packetSize += writeBytes;
             data = data.subspan(writeBytes);
         }
         return true;
     }
 
+    void SingleSceneUpdateWriter::closePacketMemSegment()
+    {
+        const size_t packetMemBytes = m_packetWriter.getBytesWritten();
+        if (packetMemBytes > m_packetMemSegmentStart)
+        {
+            m_packetSegments.push_back({m_packetMem.data() + m_packetMemSegmentStart, packetMemBytes - m_packetMemSegmentStart});
+            m_packetMemSegmentStart = packetMemBytes;
+        }
+    }
+
     bool SingleSceneUpdateWriter::finalizePacket(bool more)
     {
         RawBinaryOutputStream headerWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()));
         headerWriter << m_packetNum
                      << static_cast<uint32_t>(more ? hasMorePacketsFlag : lastPacketFlag);
 
-        if (!m_writeDoneFunc(m_packetWriter.getBytesWritten()))
+        bool writeSucceeded = false;
+        if (m_writeSegmentsDoneFunc)
+        {
+            closePacketMemSegment();
+            writeSucceeded = (*m_writeSegmentsDoneFunc)(m_packetSegments);
+        }
+        else
+        {
+            writeSucceeded = (*m_writeDoneFunc)(m_packetSize);
+        }
+
+        if (!writeSucceeded)
         {
-            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::finalizePacket: Packet write failed (size {})", m_packetWriter.getBytesWritten());
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::finalizePacket: Packet write failed (size {})", m_packetSize);
             return false;
         }
 
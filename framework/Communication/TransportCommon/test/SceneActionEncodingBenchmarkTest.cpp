@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportCommon/SceneUpdateSerializationHelper.h"
+#include "Scene/SceneActionCollection.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Compares raw and compact scene action encoding for flushes of an animated scene (many transform and uniform updates per frame).
+    // Sizes (bytes per flush) and encoding/decoding times (microseconds) are recorded as test properties,
+    // the test itself only checks that compact encoding round trips and does not grow the data.
+    class ASceneActionEncodingBenchmark : public ::testing::Test
+    {
+    protected:
+        static constexpr UInt32 FlushCount = 100u;
+        static constexpr UInt32 AnimatedNodeCount = 200u;
+        static constexpr UInt32 AnimatedUniformCount = 100u;
+
+        template <typename Func>
+        static int MeasureUs(Func&& func)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            func();
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        }
+
+        static void CreateAnimationFlush(UInt32 frame, SceneActionCollection& actions)
+        {
+            SceneActionCollectionCreator creator(actions);
+            const Float time = static_cast<Float>(frame) * 0.016f;
+            for (UInt32 i = 0u; i < AnimatedNodeCount; ++i)
+            {
+                const TransformHandle transform(i);
+                creator.setTransformComponent(ETransformPropertyType_Translation, transform, Vector3(static_cast<Float>(i), time, 0.f), ERotationConvention::XYZ);
+                creator.setTransformComponent(ETransformPropertyType_Rotation, transform, Vector3(0.f, 0.f, time * 10.f), ERotationConvention::XYZ);
+            }
+            for (UInt32 i = 0u; i < AnimatedUniformCount; ++i)
+            {
+                const Float color[] = { 1.f, 0.5f, time, 1.f };
+                creator.setDataFloatArray(DataInstanceHandle(i), DataFieldHandle(2u), 4u, color);
+            }
+        }
+    };
+
+    TEST_F(ASceneActionEncodingBenchmark, compareRawAndCompactEncodingOfAnimationFlushes)
+    {
+        std::vector<SceneActionCollection> flushes(FlushCount);
+        for (UInt32 frame = 0u; frame < FlushCount; ++frame)
+            CreateAnimationFlush(frame, flushes[frame]);
+
+        size_t rawSize = 0u;
+        const int rawEncodingTime = MeasureUs([&]() {
+            std::vector<Byte> workingMemory;
+            for (const auto& flush : flushes)
+            {
+                workingMemory.clear();
+                rawSize += SceneActionSerialization::SerializeDescription(flush, workingMemory).size();
+                rawSize += SceneActionSerialization::SerializeData(flush).size();
+            }
+        });
+
+        std::vector<std::vector<Byte>> compactBlobs(FlushCount);
+        size_t compactSize = 0u;
+        const int compactEncodingTime = MeasureUs([&]() {
+            std::vector<Byte> encodingMemory;
+            for (UInt32 i = 0u; i < FlushCount; ++i)
+                compactSize += SceneActionSerialization::SerializeCompact(flushes[i], compactBlobs[i], encodingMemory).size();
+        });
+
+        std::vector<SceneActionCollection> decodedFlushes(FlushCount);
+        bool decodingSucceeded = true;
+        const int compactDecodingTime = MeasureUs([&]() {
+            for (UInt32 i = 0u; i < FlushCount; ++i)
+                decodingSucceeded &= SceneActionSerialization::DeserializeCompact(compactBlobs[i], decodedFlushes[i]);
+        });
+
+        EXPECT_TRUE(decodingSucceeded);
+        EXPECT_EQ(flushes, decodedFlushes);
+        EXPECT_LT(compactSize, rawSize);
+
+        RecordProperty("rawBytesPerFlush", static_cast<int>(rawSize / FlushCount));
+        RecordProperty("compactBytesPerFlush", static_cast<int>(compactSize / FlushCount));
+        RecordProperty("rawEncodingUs", rawEncodingTime);
+        RecordProperty("compactEncodingUs", compactEncodingTime);
+        RecordProperty("compactDecodingUs", compactDecodingTime);
+    }
+}
@@ -23,7 +23,29 @@ namespace ramses_internal
             return SceneActionSerialization::Deserialize(desc, data);
         }
 
+        SceneActionCollection SerializeDeserializeCompact(const SceneActionCollection& actions)
+        {
+            const absl::Span<const Byte> blob = SceneActionSerialization::SerializeCompact(actions, workingMem, encodingMem);
+            SceneActionCollection result;
+            EXPECT_TRUE(SceneActionSerialization::DeserializeCompact(blob, result));
+            return result;
+        }
+
+        static void AddTransformActions(SceneActionCollection& actions, UInt32 count)
+        {
+            for (UInt32 i = 0u; i < count; ++i)
+            {
+                actions.beginWriteSceneAction(ESceneActionId::SetTransformComponent);
+                actions.write(static_cast<UInt32>(0u));
+                actions.write(i);
+                actions.write(static_cast<Float>(i) * 0.1f);
+                actions.write(1.f);
+                actions.write(2.f);
+            }
+        }
+
         std::vector<Byte> workingMem;
+        std::vector<Byte> encodingMem;
     };
 
     TEST_F(ASceneActionSerialization, canSerializeDeserializeEmptyCollection)
@@ -44,6 +66,87 @@ namespace ramses_internal
         EXPECT_EQ(in, SerializeDeserialize(in));
     }
 
+    TEST_F(ASceneActionSerialization, canSerializeDeserializeEmptyCollectionInCompactEncoding)
+    {
+        SceneActionCollection in;
+        EXPECT_EQ(in, SerializeDeserializeCompact(in));
+    }
+
+    TEST_F(ASceneActionSerialization, canSerializeDeserializeCollectionWithDataInCompactEncoding)
+    {
+        SceneActionCollection in;
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+        in.write(static_cast<uint32_t>(123));
+        in.write(static_cast<uint32_t>(456));
+        in.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        in.write(String("foobar"));
+        in.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        in.write(String("foobaz"));
+        in.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        in.write(String("other length"));
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+
+        EXPECT_EQ(in, SerializeDeserializeCompact(in));
+    }
+
+    TEST_F(ASceneActionSerialization, canSerializeDeserializeCompressedCollectionInCompactEncoding)
+    {
+        SceneActionCollection in;
+        AddTransformActions(in, 1000u);
+
+        const absl::Span<const Byte> blob = SceneActionSerialization::SerializeCompact(in, workingMem, encodingMem);
+        EXPECT_LT(blob.size() * 2u, in.collectionData().size());
+
+        SceneActionCollection out;
+        EXPECT_TRUE(SceneActionSerialization::DeserializeCompact(blob, out));
+        EXPECT_EQ(in, out);
+    }
+
+    TEST_F(ASceneActionSerialization, compactEncodingAppendsToWorkingMemory)
+    {
+        workingMem = { 1u, 2u, 3u };
+        SceneActionCollection in;
+        AddTransformActions(in, 10u);
+
+        const absl::Span<const Byte> blob = SceneActionSerialization::SerializeCompact(in, workingMem, encodingMem);
+        EXPECT_EQ(workingMem.data() + 3u, blob.data());
+        EXPECT_EQ(3u, workingMem[2]);
+
+        SceneActionCollection out;
+        EXPECT_TRUE(SceneActionSerialization::DeserializeCompact(blob, out));
+        EXPECT_EQ(in, out);
+    }
+
+    TEST_F(ASceneActionSerialization, deserializeCompactFailsForTruncatedBlob)
+    {
+        for (UInt32 count : { 3u, 1000u })
+        {
+            SceneActionCollection in;
+            AddTransformActions(in, count);
+            workingMem.clear();
+            const absl::Span<const Byte> blob = SceneActionSerialization::SerializeCompact(in, workingMem, encodingMem);
+
+            SceneActionCollection out;
+            EXPECT_FALSE(SceneActionSerialization::DeserializeCompact({}, out));
+            EXPECT_FALSE(SceneActionSerialization::DeserializeCompact(blob.subspan(0u, 1u), out));
+            EXPECT_FALSE(SceneActionSerialization::DeserializeCompact(blob.subspan(0u, blob.size() - 1u), out));
+            EXPECT_TRUE(out.empty());
+        }
+    }
+
+    TEST_F(ASceneActionSerialization, deserializeCompactFailsForInvalidActionType)
+    {
+        // uncompressed blob with one action of given type and empty data: flags, number of actions, data size, type, size
+        const auto makeBlob = [](uint32_t type) {
+            return std::vector<Byte>{ 0u, 1u, 0u, static_cast<Byte>(type | 0x80u), static_cast<Byte>(type >> 7u), 0u };
+        };
+        ASSERT_LT(NumOfSceneActionTypes, 1u << 14u);
+
+        SceneActionCollection out;
+        EXPECT_TRUE(SceneActionSerialization::DeserializeCompact(makeBlob(NumOfSceneActionTypes - 1u), out));
+        EXPECT_EQ(1u, out.numberOfActions());
+        EXPECT_FALSE(SceneActionSerialization::DeserializeCompact(makeBlob(NumOfSceneActionTypes), out));
+    }
 
     class AResourceSerialization : public ::testing::Test
     {
@@ -8,13 +8,16 @@
 
 #include "TransportCommon/SceneUpdateSerializer.h"
 #include "TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "TransportCommon/SingleSceneUpdateWriter.h"
 #include "Components/SceneUpdate.h"
 #include "Scene/SceneActionCollection.h"
 #include "gtest/gtest.h"
 #include "Components/ResourceDeleterCallingCallback.h"
 #include "ResourceMock.h"
 #include "ResourceSerializationTestHelper.h"
+#include "Utils/BinaryOutputStream.h"
 #include "gmock/gmock.h"
+#include <limits>
 
 namespace ramses_internal
 {
@@ -59,6 +62,26 @@ namespace ramses_internal
             update.flushInfos.versionTag = SceneVersionTag(2);
         }
 
+        bool serializeCompact(size_t pktSize)
+        {
+            SceneUpdateSerializer sus(update);
+            std::vector<Byte> vec(pktSize);
+            return sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Compact, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+                data.emplace_back();
+                for (const auto& segment : segments)
+                    data.back().insert(data.back().end(), segment.begin(), segment.end());
+                return true;
+            });
+        }
+
+        size_t serializedSize() const
+        {
+            size_t size = 0u;
+            for (const auto& d : data)
+                size += d.size();
+            return size;
+        }
+
         SceneUpdateStreamDeserializer::Result deserialize()
         {
             for (const auto& d : data)
@@ -152,6 +175,14 @@ namespace ramses_internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, canSerialieDeserializeResourceLargerThanBlockBufferReserveSize)
+    {
+        update.resources.push_back(CreateTestResource(20u * 1024u * 1024u));
+        EXPECT_TRUE(serialize(1024u * 1024u));
+        EXPECT_GT(data.size(), 1u);
+        expectDeserializeToSame();
+    }
+
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeFlushInformation)
     {
         addFlushInformation();
@@ -286,6 +317,167 @@ namespace ramses_internal
         }
     }
 
+    TEST_F(ASceneUpdateSerialization, writesSamePacketsAsSegmentsWithResourceDataReferenced)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        update.resources.push_back(CreateTestResource(1000));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(100));
+
+        SceneUpdateSerializer sus(update);
+        std::vector<Byte> vec(100);
+        std::vector<std::vector<Byte>> segmentData;
+        size_t numReferencedBytes = 0u;
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+            segmentData.emplace_back();
+            for (const auto& segment : segments)
+            {
+                for (const auto& res : update.resources)
+                {
+                    const auto& blob = res->getResourceData();
+                    if (segment.data() >= blob.data() && segment.data() < blob.data() + blob.size())
+                        numReferencedBytes += segment.size();
+                }
+                segmentData.back().insert(segmentData.back().end(), segment.begin(), segment.end());
+            }
+            return true;
+        }));
+
+        EXPECT_EQ(data, segmentData);
+        EXPECT_EQ(1100u, numReferencedBytes);
+    }
+
+    TEST_F(ASceneUpdateSerialization, createsPacketSegmentsOnlyOnceForSamePacketSize)
+    {
+        update.resources.push_back(CreateTestResource(1000));
+        for (size_t i = 0; i < 10; ++i)
+            addTestActions();
+
+        SceneUpdateSerializer sus(update);
+        std::vector<Byte> vec(100);
+        std::vector<ISceneUpdateSerializer::PacketSegments> packets1;
+        std::vector<ISceneUpdateSerializer::PacketSegments> packets2;
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+            packets1.push_back(segments);
+            return true;
+        }));
+        const auto owner = sus.getPacketDataOwner();
+        EXPECT_TRUE(owner);
+
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+            packets2.push_back(segments);
+            return true;
+        }));
+        EXPECT_EQ(owner, sus.getPacketDataOwner());
+
+        // same data used for both
+        ASSERT_EQ(packets1.size(), packets2.size());
+        for (size_t i = 0; i < packets1.size(); ++i)
+        {
+            ASSERT_EQ(packets1[i].size(), packets2[i].size());
+            for (size_t j = 0; j < packets1[i].size(); ++j)
+            {
+                EXPECT_EQ(packets1[i][j].data(), packets2[i][j].data());
+                EXPECT_EQ(packets1[i][j].size(), packets2[i][j].size());
+            }
+        }
+    }
+
+    TEST_F(ASceneUpdateSerialization, packetSegmentsStayValidWhileOwnerIsKeptAfterSerializerIsGone)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        addTestActions();
+        EXPECT_TRUE(serialize(100));
+
+        std::vector<ISceneUpdateSerializer::PacketSegments> packets;
+        std::shared_ptr<const void> owner;
+        {
+            SceneUpdateSerializer sus(update);
+            std::vector<Byte> vec(100);
+            EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+                packets.push_back(segments);
+                return true;
+            }));
+            owner = sus.getPacketDataOwner();
+        }
+
+        ASSERT_EQ(data.size(), packets.size());
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            std::vector<Byte> packetData;
+            for (const auto& segment : packets[i])
+                packetData.insert(packetData.end(), segment.begin(), segment.end());
+            EXPECT_EQ(data[i], packetData);
+        }
+    }
+
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeEmptyUpdateInCompactEncoding)
+    {
+        EXPECT_TRUE(serializeCompact(60));
+        EXPECT_EQ(1u, data.size());
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeComplexUpdateInCompactEncoding)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        update.resources.push_back(CreateTestResource(200));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        addFlushInformation();
+        EXPECT_TRUE(serializeCompact(100));
+        EXPECT_GT(data.size(), 1u);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, compactEncodingOfRepetitiveSceneActionsIsSmaller)
+    {
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(1000));
+        const size_t rawSize = serializedSize();
+
+        data.clear();
+        EXPECT_TRUE(serializeCompact(1000));
+        EXPECT_LT(serializedSize() * 4u, rawSize);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, createsPacketSegmentsSeparatelyForEveryEncoding)
+    {
+        for (size_t i = 0; i < 10; ++i)
+            addTestActions();
+
+        SceneUpdateSerializer sus(update);
+        std::vector<Byte> vec(100);
+        const auto ignorePackets = [](const ISceneUpdateSerializer::PacketSegments&) { return true; };
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, ignorePackets));
+        const auto rawOwner = sus.getPacketDataOwner();
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Compact, ignorePackets));
+        const auto compactOwner = sus.getPacketDataOwner();
+        EXPECT_TRUE(rawOwner);
+        EXPECT_TRUE(compactOwner);
+        EXPECT_NE(rawOwner, compactOwner);
+
+        // both are kept and reused
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, ignorePackets));
+        EXPECT_EQ(rawOwner, sus.getPacketDataOwner());
+        EXPECT_TRUE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Compact, ignorePackets));
+        EXPECT_EQ(compactOwner, sus.getPacketDataOwner());
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsSerializeToSegmentsWhenWriteFunctionFails)
+    {
+        update.resources.push_back(CreateTestResource(2500));
+        SceneUpdateSerializer sus(update);
+        std::vector<Byte> vec(60);
+        int cnt = 0;
+        EXPECT_FALSE(sus.writeToPacketSegments({vec.data(), vec.size()}, ESceneActionEncoding::Raw, [&](const ISceneUpdateSerializer::PacketSegments&) {
+            return ++cnt != 10;
+        }));
+    }
+
     TEST_F(ASceneUpdateSerialization, failsDeserializeEmptyPacket)
     {
         const auto res = deser.processData({});
@@ -298,6 +490,18 @@ namespace ramses_internal
         EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, res.result);
     }
 
+    TEST_F(ASceneUpdateSerialization, failsDeserializeWhenLastPacketAnnouncesBlockLargerThanPacket)
+    {
+        BinaryOutputStream os;
+        os << static_cast<uint32_t>(1u)
+           << SingleSceneUpdateWriter::lastPacketFlag
+           << static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::Resource)
+           << std::numeric_limits<uint32_t>::max()
+           << static_cast<uint32_t>(0u);
+        const std::vector<Byte> packet(os.getData(), os.getData() + os.getSize());
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(packet).result);
+    }
+
     TEST_F(ASceneUpdateSerialization, failsWithTruncatedFirstPacket)
     {
         addTestActions();
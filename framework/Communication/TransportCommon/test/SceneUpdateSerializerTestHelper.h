@@ -19,6 +19,8 @@ namespace ramses_internal
     {
     public:
         MOCK_METHOD(bool, writeToPackets, (absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc), (const, override));
+        MOCK_METHOD(bool, writeToPacketSegments, (absl::Span<Byte> packetMem, ESceneActionEncoding encoding, const std::function<bool(const PacketSegments&)>& writeDoneFunc), (const, override));
+        MOCK_METHOD(std::shared_ptr<const void>, getPacketDataOwner, (), (const, override));
     };
 
 
@@ -45,6 +47,25 @@ namespace ramses_internal
             return true;
         }
 
+        virtual bool writeToPacketSegments(absl::Span<Byte> packetMem, ESceneActionEncoding /*encoding*/, const std::function<bool(const PacketSegments&)>& writeDoneFunc) const override
+        {
+            EXPECT_EQ(expectedSize, packetMem.size());
+            for (const auto& d : data)
+            {
+                assert(packetMem.size() >= d.size());
+                assert(d.data());
+                std::memcpy(packetMem.data(), d.data(), d.size());
+                if (!writeDoneFunc({ absl::Span<const Byte>(packetMem.data(), d.size()) }))
+                    return false;
+            }
+            return true;
+        }
+
+        virtual std::shared_ptr<const void> getPacketDataOwner() const override
+        {
+            return {};
+        }
+
         std::vector<std::vector<Byte>> data;
         const size_t expectedSize;
     };
@@ -18,7 +18,9 @@
 #include "Collections/HashSet.h"
 #include "Collections/HashMap.h"
 #include "TransportTCP/AsioWrapper.h"
+#include "absl/types/span.h"
 #include <deque>
+#include <memory>
 
 
 namespace ramses_internal
@@ -29,9 +31,10 @@ namespace ramses_internal
     class TCPConnectionSystem final : public Runnable, public ICommunicationSystem
     {
     public:
+        // compactSceneActions: scene actions are sent in compact encoding to participants which enabled it as well
         TCPConnectionSystem(const NetworkParticipantAddress& participantAddress, UInt32 protocolVersion, const NetworkParticipantAddress& daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout, bool compactSceneActions = false);
         virtual ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
@@ -121,6 +124,16 @@ namespace ramses_internal
             std::vector<Guid> to;
             EMessageId messageType;
             BinaryOutputStream stream;
+
+            // data sent without copying it into stream, each follows stream content up to its stream position
+            struct ExternalData
+            {
+                size_t streamPosition;
+                absl::Span<const Byte> data;
+            };
+            std::vector<ExternalData> externalData;
+            // keeps external data valid until message is sent
+            std::shared_ptr<const void> externalDataOwner;
         };
 
         struct Participant
@@ -135,6 +148,7 @@ namespace ramses_internal
 
             std::deque<OutMessage> outQueue;
             std::vector<Byte> currentOutBuffer;
+            std::shared_ptr<const void> currentOutExternalDataOwner;
 
             uint32_t lengthReceiveBuffer;
             std::vector<Byte> receiveBuffer;
@@ -202,6 +216,9 @@ namespace ramses_internal
         void handleDcsmForceStopOfferContent(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleDcsmUpdateContentMetadata(const ParticipantPtr& pp, BinaryInputStream& stream);
 
+        // capability flags exchanged with connection description
+        static constexpr uint32_t Capability_CompactSceneActions = 1u;
+
         static const char* EnumToString(EParticipantState e);
         static const char* EnumToString(EParticipantType e);
 
@@ -213,6 +230,7 @@ namespace ramses_internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const bool m_compactSceneActions;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
@@ -221,6 +239,7 @@ namespace ramses_internal
         ConnectionStatusUpdateNotifier m_ramsesConnectionStatusUpdateNotifier;
         ConnectionStatusUpdateNotifier m_dcsmConnectionStatusUpdateNotifier;
         std::vector<Guid> m_connectedParticipantsForBroadcasts;
+        HashSet<Guid> m_participantsWithCompactSceneActions;
 
         ISceneProviderServiceHandler* m_sceneProviderHandler;
         ISceneRendererServiceHandler* m_sceneRendererHandler;
@@ -29,7 +29,8 @@ namespace ramses_internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     bool compactSceneActions)
         : m_participantAddress(participantAddress)
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(daemonAddress)
@@ -43,6 +44,7 @@ namespace ramses_internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_compactSceneActions(compactSceneActions)
         , m_frameworkLock(frameworkLock)
         , m_thread("R_TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -319,7 +321,11 @@ namespace ramses_internal
         assert(pp->currentOutBuffer.empty());
 
         pp->currentOutBuffer = msg.stream.release();
-        const uint32_t fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        pp->currentOutExternalDataOwner = std::move(msg.externalDataOwner);
+        size_t externalDataSize = 0;
+        for (const auto& ext : msg.externalData)
+            externalDataSize += ext.data.size();
+        const uint32_t fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size() + externalDataSize);
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
                   ", MsgType " << msg.messageType << ", Size " << fullSize);
@@ -329,8 +335,20 @@ namespace ramses_internal
         s << remainingSize
           << m_protocolVersion;
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+        // gather stream content and external data without copying
+        std::vector<asio::const_buffer> buffers;
+        buffers.reserve(2 * msg.externalData.size() + 1);
+        size_t streamPosition = 0;
+        for (const auto& ext : msg.externalData)
+        {
+            buffers.emplace_back(pp->currentOutBuffer.data() + streamPosition, ext.streamPosition - streamPosition);
+            buffers.emplace_back(ext.data.data(), ext.data.size());
+            streamPosition = ext.streamPosition;
+        }
+        buffers.emplace_back(pp->currentOutBuffer.data() + streamPosition, pp->currentOutBuffer.size() - streamPosition);
+
+        asio::async_write(pp->socket, buffers,
+                          [this, pp, fullSize](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
                                   LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: Send to "
@@ -342,9 +360,10 @@ namespace ramses_internal
                               else
                               {
                                   LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
-                                            ", MsgBytes " << pp->currentOutBuffer.size() << ", SentBytes " << sentBytes);
+                                            ", MsgBytes " << fullSize << ", SentBytes " << sentBytes);
 
                                   pp->currentOutBuffer.clear();
+                                  pp->currentOutExternalDataOwner.reset();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -695,7 +714,8 @@ namespace ramses_internal
                    << m_participantAddress.getParticipantName()
                    << m_participantAddress.getIp()
                    << static_cast<uint16_t>(m_runState->m_acceptor.local_endpoint().port())
-                   << m_participantType;
+                   << m_participantType
+                   << (m_compactSceneActions ? Capability_CompactSceneActions : 0u);
         sendMessageToParticipant(pp, std::move(msg));
     }
 
@@ -721,16 +741,21 @@ namespace ramses_internal
         String ip;
         uint16_t port;
         EParticipantType participantType;
+        uint32_t capabilities = 0u;
         stream >> guid
                >> name
                >> ip
                >> port
-               >> participantType;
+               >> participantType
+               >> capabilities;
         pp->address = NetworkParticipantAddress(guid, name, ip, port);
         assert(!guid.isInvalid());
 
+        // compact encoding is only used when both sides enabled it
+        const bool compactSceneActions = m_compactSceneActions && (capabilities & Capability_CompactSceneActions) != 0u;
+
         LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleConnectionDescriptionMessage: Hello from " <<
-                 guid << "/" << name << " type " << EnumToString(participantType) << " at " << ip << ":" << port << ". Established now");
+                 guid << "/" << name << " type " << EnumToString(participantType) << " at " << ip << ":" << port << ", compactSceneActions " << compactSceneActions << ". Established now");
 
         pp->type = participantType;
         pp->state = EParticipantState::Established;
@@ -739,7 +764,14 @@ namespace ramses_internal
         m_establishedParticipants.put(guid, pp);
 
         if (pp->type != EParticipantType::PureDaemon)
+        {
+            if (compactSceneActions)
+            {
+                PlatformGuard guard(m_frameworkLock);
+                m_participantsWithCompactSceneActions.put(guid);
+            }
             triggerConnectionUpdateNotification(guid, EConnectionStatus_Connected);
+        }
 
         sendConnectorAddressExchangeMessagesForNewParticipant(pp);
     }
@@ -945,14 +977,30 @@ namespace ramses_internal
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
+        // packet data outside of buffer is not copied into messages but sent directly, its owner is kept alive until sent
         std::vector<Byte> buffer(SceneActionDataSize);
-        return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
+        const Byte* bufferBegin = buffer.data();
+        const Byte* bufferEnd = buffer.data() + buffer.size();
+        const ESceneActionEncoding encoding = m_participantsWithCompactSceneActions.contains(to) ? ESceneActionEncoding::Compact : ESceneActionEncoding::Raw;
+        return serializer.writeToPacketSegments({buffer.data(), buffer.size()}, encoding, [&](const ISceneUpdateSerializer::PacketSegments& segments) {
+
+            uint32_t usedSize = 0;
+            for (const auto& segment : segments)
+                usedSize += static_cast<uint32_t>(segment.size());
 
-            const uint32_t usedSize = static_cast<uint32_t>(size);
             OutMessage msg(to, EMessageId::SendSceneUpdate);
             msg.stream << sceneId.getValue()
                        << usedSize;
-            msg.stream.write(buffer.data(), usedSize);
+            for (const auto& segment : segments)
+            {
+                // packet memory is reused for next packet, so only its content needs copy
+                if (!std::less<const Byte*>()(segment.data(), bufferBegin) && std::less<const Byte*>()(segment.data(), bufferEnd))
+                    msg.stream.write(segment.data(), segment.size());
+                else
+                    msg.externalData.push_back({ msg.stream.getSize(), segment });
+            }
+            if (!msg.externalData.empty())
+                msg.externalDataOwner = serializer.getPacketDataOwner();
 
             return postMessageForSending(std::move(msg));
         });
@@ -968,13 +1016,21 @@ namespace ramses_internal
             uint32_t dataSize = 0;
             stream >> dataSize;
 
-            std::vector<Byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            if (dataSize > pp->receiveBuffer.size() - stream.getCurrentReadBytes())
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneActionList: invalid data size " << dataSize <<
+                          " from " << pp->address.getParticipantId());
+                return;
+            }
+
+            // handled synchronously, so data can be passed directly from receive buffer which is reused for next message
+            const absl::Span<const Byte> data(stream.readPosition(), dataSize);
+            stream.skip(dataSize);
 
             LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneActionList: from " << pp->address.getParticipantId());
 
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(data), pp->address.getParticipantId());
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, data, pp->address.getParticipantId());
         }
     }
 
@@ -1422,6 +1478,7 @@ namespace ramses_internal
                                 sos << "  Self: " << m_participantAddress.getParticipantName() << " / " << m_participantAddress.getParticipantId() << "\n";
                                 sos << "  Connected: " << (m_runState ? "Yes" : "No") << "\n";
                                 sos << "  Protocol version: " << m_protocolVersion << "\n";
+                                sos << "  Compact scene actions: " << (m_compactSceneActions ? "enabled" : "disabled") << "\n";
                                 sos << "  Type: " << EnumToString(m_participantType) << "\n";
                                 if (m_hasOtherDaemon)
                                     sos << "  Upstram daemon at " << m_daemonAddress.getIp() << ":" << m_daemonAddress.getPort() << "\n";
@@ -1496,6 +1553,7 @@ namespace ramses_internal
                                                                    m_connectedParticipantsForBroadcasts.end(),
                                                                    participant),
                                                        m_connectedParticipantsForBroadcasts.end());
+            m_participantsWithCompactSceneActions.remove(participant);
         }
         m_ramsesConnectionStatusUpdateNotifier.triggerNotification(participant, status);
         m_dcsmConnectionStatusUpdateNotifier.triggerNotification(participant, status);
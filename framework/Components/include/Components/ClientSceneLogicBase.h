@@ -13,6 +13,8 @@
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Scene/Scene.h"
+#include "Scene/SceneActionCoalescer.h"
+#include <unordered_map>
 
 namespace ramses_internal
 {
@@ -36,6 +38,12 @@ namespace ramses_internal
 
         std::vector<Guid> getWaitingAndActiveSubscribers() const;
 
+        // data of resources available at subscriber is not sent with initial scene to that subscriber
+        void setResourcesAvailableAtSubscriber(const Guid& subscriber, const ResourceContentHashVector& availableResources);
+
+        // setter actions overwritten by later actions are removed on flush
+        void setSceneActionCoalescingEnabled(bool enabled);
+
         virtual bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
 
         const char* getSceneStateString() const;
@@ -45,6 +53,7 @@ namespace ramses_internal
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneActionCollection& collection) const;
         bool verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
+        void coalesceSceneActions(SceneActionCollection& actions);
 
         ISceneGraphSender&     m_scenegraphSender;
         IResourceProviderComponent& m_resourceComponent;
@@ -59,10 +68,13 @@ namespace ramses_internal
 
         UInt64                 m_flushCounter = 0u;
         ResourceContentHashVector m_lastFlushClientResourcesInUse;
+        std::unordered_map<Guid, ResourceContentHashVector> m_resourcesAvailableAtSubscribers; // sorted
 
         ResourceChanges m_resourceChanges; // keep container memory allocated
         ResourceContentHashVector m_newResources; // keep container memory allocated
         AnimationSystemFactory m_animationSystemFactory;
+        bool m_sceneActionCoalescingEnabled = false;
+        SceneActionCoalescer m_sceneActionCoalescer;
     };
 }
 
@@ -21,7 +21,8 @@ namespace ramses_internal
     class ResourceComponent : public IResourceProviderComponent
     {
     public:
-        ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock);
+        // memoryMapResourceFiles: added resource files get mapped into memory and resources are read from mapping
+        ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock, bool memoryMapResourceFiles = false);
         virtual ~ResourceComponent() override;
 
         // implement IResourceProviderComponent
@@ -45,6 +46,7 @@ namespace ramses_internal
         ResourceFilesRegistry m_resourceFiles;
 
         StatisticCollectionFramework& m_statistics;
+        const bool m_memoryMapResourceFiles;
     };
 }
 
@@ -11,6 +11,8 @@
 
 #include "Utils/File.h"
 #include "Utils/BinaryFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -27,7 +29,27 @@ namespace ramses_internal
             return resourceFile.getFileName();
         }
 
+        // maps whole file into memory additionally to the stream, resources can then be read from mapping
+        // and keep referencing it (shared ownership), mapping stays valid as long as such resources live
+        bool mapIntoMemory()
+        {
+            if (!memoryMapping)
+            {
+                auto mapping = std::make_shared<MemoryMappedFile>(resourceFile.getPath());
+                if (!mapping->isMapped())
+                    return false;
+                memoryMapping = std::move(mapping);
+            }
+            return true;
+        }
+
+        const std::shared_ptr<MemoryMappedFile>& getMemoryMapping() const
+        {
+            return memoryMapping;
+        }
+
     private:
+        std::shared_ptr<MemoryMappedFile> memoryMapping;
         File resourceFile; // here the order is crucial as the stream holds an reference of the file and closes it at destruction
 
     public:
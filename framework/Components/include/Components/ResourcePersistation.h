@@ -12,6 +12,7 @@
 #include "Collections/Vector.h"
 #include "ManagedResource.h"
 #include "Collections/Pair.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -19,6 +20,7 @@ namespace ramses_internal
     class IInputStream;
     class BinaryFileInputStream;
     class BinaryFileOutputStream;
+    class MemoryMappedFile;
     struct ResourceFileEntry;
 
     class ResourcePersistation
@@ -29,6 +31,8 @@ namespace ramses_internal
 
         static IResource* ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static IResource* RetrieveResourceFromStream(BinaryFileInputStream& inStream, const ResourceFileEntry& entry);
+        // resource data is not copied, retrieved resource references mapped file and keeps it alive
+        static IResource* RetrieveResourceFromMemoryMappedFile(const std::shared_ptr<MemoryMappedFile>& file, const ResourceFileEntry& entry);
     };
 }
 
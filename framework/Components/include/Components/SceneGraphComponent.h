@@ -46,7 +46,8 @@ namespace ramses_internal
                                       public IPeriodicLogSupplier
     {
     public:
-        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock);
+        // coalesceSceneActions: redundant scene actions of client scenes are removed on flush
+        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock, bool coalesceSceneActions = false);
         virtual ~SceneGraphComponent() override;
 
         virtual void setSceneRendererHandler(ISceneRendererHandler* sceneRendererHandler) override;
@@ -111,6 +112,7 @@ namespace ramses_internal
         SceneEventConsumerMap m_sceneEventConsumers;
 
         IResourceProviderComponent& m_resourceComponent;
+        const bool m_coalesceSceneActions;
 
         struct ReceivedScene
         {
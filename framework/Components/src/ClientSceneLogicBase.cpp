@@ -18,6 +18,8 @@
 #include "Utils/StatisticCollection.h"
 #include "Components/IResourceProviderComponent.h"
 #include "Components/SceneUpdate.h"
+#include <algorithm>
+#include <iterator>
 
 namespace ramses_internal
 {
@@ -60,6 +62,7 @@ namespace ramses_internal
         // reset to initial state
         m_subscribersActive.clear();
         m_subscribersWaitingForScene.clear();
+        m_resourcesAvailableAtSubscribers.clear();
     }
 
     bool ClientSceneLogicBase::isPublished() const
@@ -82,6 +85,8 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::removeSubscriber(const Guid& subscriber)
     {
+        m_resourcesAvailableAtSubscribers.erase(subscriber);
+
         auto it = find_c(m_subscribersActive, subscriber);
         if (it != m_subscribersActive.end())
         {
@@ -106,6 +111,18 @@ namespace ramses_internal
         return result;
     }
 
+    void ClientSceneLogicBase::setResourcesAvailableAtSubscriber(const Guid& subscriber, const ResourceContentHashVector& availableResources)
+    {
+        // local subscriber shares resources with client, there is nothing to save
+        if (subscriber == m_myID)
+            return;
+
+        LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::setResourcesAvailableAtSubscriber: " << availableResources.size() << " resources available at " << subscriber << " for scene " << m_sceneId);
+        ResourceContentHashVector& sortedResources = m_resourcesAvailableAtSubscribers[subscriber];
+        sortedResources = availableResources;
+        std::sort(sortedResources.begin(), sortedResources.end());
+    }
+
     void ClientSceneLogicBase::sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
         if (m_subscribersWaitingForScene.empty())
@@ -139,7 +156,41 @@ namespace ramses_internal
             m_scenegraphSender.sendCreateScene(subscriber, m_sceneId, m_scenePublicationMode);
         }
         m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<UInt32>(m_subscribersWaitingForScene.size()));
-        m_scenegraphSender.sendSceneUpdate(m_subscribersWaitingForScene, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode);
+
+        // subscriber which reported resources as available gets own scene update without data of those resources,
+        // receiver has to take the data of resources added in flush but not sent from its own storage
+        AddressVector subscribersReceivingAllResources;
+        for (const auto& subscriber : m_subscribersWaitingForScene)
+        {
+            const auto availableIt = m_resourcesAvailableAtSubscribers.find(subscriber);
+            if (availableIt == m_resourcesAvailableAtSubscribers.end())
+            {
+                subscribersReceivingAllResources.push_back(subscriber);
+                continue;
+            }
+
+            const ResourceContentHashVector& availableResources = availableIt->second;
+            ManagedResourceVector resourcesToSend;
+            resourcesToSend.reserve(sceneUpdate.resources.size());
+            std::copy_if(sceneUpdate.resources.cbegin(), sceneUpdate.resources.cend(), std::back_inserter(resourcesToSend), [&](const auto& mr)
+            {
+                return !std::binary_search(availableResources.cbegin(), availableResources.cend(), mr->getHash());
+            });
+            m_resourcesAvailableAtSubscribers.erase(availableIt);
+
+            if (resourcesToSend.size() == sceneUpdate.resources.size())
+            {
+                subscribersReceivingAllResources.push_back(subscriber);
+                continue;
+            }
+
+            LOG_INFO(CONTEXT_CLIENT, "Sending scene " << m_sceneId << " to " << subscriber << " without " << sceneUpdate.resources.size() - resourcesToSend.size()
+                << " client resources available at subscriber");
+            SceneUpdate reducedSceneUpdate{ sceneUpdate.actions.copy(), std::move(resourcesToSend), sceneUpdate.flushInfos.copy() };
+            m_scenegraphSender.sendSceneUpdate({ subscriber }, std::move(reducedSceneUpdate), m_sceneId, m_scenePublicationMode);
+        }
+        if (!subscribersReceivingAllResources.empty())
+            m_scenegraphSender.sendSceneUpdate(subscribersReceivingAllResources, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode);
 
         m_subscribersActive.insert(m_subscribersActive.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         m_subscribersWaitingForScene.clear();
@@ -195,6 +246,21 @@ namespace ramses_internal
         }
     }
 
+    void ClientSceneLogicBase::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        m_sceneActionCoalescingEnabled = enabled;
+    }
+
+    void ClientSceneLogicBase::coalesceSceneActions(SceneActionCollection& actions)
+    {
+        if (!m_sceneActionCoalescingEnabled)
+            return;
+
+        const auto result = m_sceneActionCoalescer.coalesce(actions);
+        m_scene.getStatisticCollection().statSceneActionsCoalesced.incCounter(result.numRemovedActions);
+        m_scene.getStatisticCollection().statSceneActionsCoalescedSize.incCounter(result.numRemovedBytes);
+    }
+
     bool ClientSceneLogicBase::verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions)
     {
         m_resourceChanges.clear();
@@ -205,9 +271,8 @@ namespace ramses_internal
 
         if (m_scene.haveResourcesChanged())
         {
-            m_newResources.clear();
-            ResourceUtils::GetAllResourcesFromScene(m_newResources, m_scene);
-            ResourceUtils::DiffResources(m_lastFlushClientResourcesInUse, m_newResources, m_resourceChanges);
+            // scene keeps track of client resources in use, no need to collect them from whole scene
+            m_scene.collectClientResourceChanges(m_resourceChanges);
 
             if (!m_resourceChanges.m_resourcesAdded.empty())
             {
@@ -216,7 +281,12 @@ namespace ramses_internal
                     return false;
             }
 
-            m_lastFlushClientResourcesInUse.swap(m_newResources);
+            if (!m_resourceChanges.m_resourcesAdded.empty() || !m_resourceChanges.m_resourcesRemoved.empty())
+            {
+                m_newResources.clear();
+                ResourceUtils::ApplyResourceChanges(m_lastFlushClientResourcesInUse, m_resourceChanges, m_newResources);
+                m_lastFlushClientResourcesInUse.swap(m_newResources);
+            }
         }
 
         m_resourceChanges.m_sceneResourceActions = m_scene.getSceneResourceActions();
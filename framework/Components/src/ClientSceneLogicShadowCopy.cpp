@@ -48,6 +48,7 @@ namespace ramses_internal
 
         // swap out of ClientScene and reserve new memory there
         sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        coalesceSceneActions(sceneUpdate.actions);
         m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushClientResourcesInUse); // keep ll resources alive, in case we need to send a scene update to a new subscriber
 
         if (m_flushCounter == 0)
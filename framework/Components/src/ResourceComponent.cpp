@@ -13,9 +13,10 @@
 
 namespace ramses_internal
 {
-    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock)
+    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock, bool memoryMapResourceFiles)
         : m_resourceStorage(frameworkLock, statistics)
         , m_statistics(statistics)
+        , m_memoryMapResourceFiles(memoryMapResourceFiles)
     {
     }
 
@@ -45,6 +46,9 @@ namespace ramses_internal
 
     void ResourceComponent::addResourceFile(ResourceFileInputStreamSPtr resourceFileInputStream, const ramses_internal::ResourceTableOfContents& toc)
     {
+        if (m_memoryMapResourceFiles && !resourceFileInputStream->mapIntoMemory())
+            LOG_WARN(CONTEXT_FRAMEWORK, "ResourceComponent::addResourceFile: failed to map " << resourceFileInputStream->getResourceFileName() << " into memory, resources will be read from file stream");
+
         for (const auto& item : toc.getFileContents())
         {
             m_resourceStorage.storeResourceInfo(item.key, item.value.resourceInfo);
@@ -91,15 +95,23 @@ namespace ramses_internal
 
     ManagedResource ResourceComponent::loadResource(const ResourceContentHash& hash)
     {
-        BinaryFileInputStream* resourceStream(nullptr);
+        ResourceFileInputStream* resourceFile(nullptr);
         ResourceFileEntry entry;
-        const EStatus canLoadFromFile = m_resourceFiles.getEntry(hash, resourceStream, entry);
+        const EStatus canLoadFromFile = m_resourceFiles.getEntry(hash, resourceFile, entry);
         if (canLoadFromFile == EStatus::Ok)
         {
             m_statistics.statResourcesLoadedFromFileNumber.incCounter(1);
             m_statistics.statResourcesLoadedFromFileSize.incCounter(entry.sizeInBytes);
 
-            IResource* lowLevelResource = ResourcePersistation::RetrieveResourceFromStream(*resourceStream, entry);
+            const std::shared_ptr<MemoryMappedFile>& mappedFile = resourceFile->getMemoryMapping();
+            IResource* lowLevelResource = mappedFile ?
+                ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFile, entry) :
+                ResourcePersistation::RetrieveResourceFromStream(resourceFile->resourceStream, entry);
+            if (!lowLevelResource)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceComponent::loadResource: failed to read resource " << hash << " from " << resourceFile->getResourceFileName());
+                return ManagedResource();
+            }
             return m_resourceStorage.manageResource(*lowLevelResource, true);
         }
 
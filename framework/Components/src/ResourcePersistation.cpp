@@ -14,14 +14,25 @@
 #include "Utils/VoidOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
+#include "Utils/RawBinaryInputStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Components/ManagedResource.h"
 #include "Components/ResourceTableOfContents.h"
 #include "Resource/ResourceInfo.h"
 #include "Resource/IResource.h"
 #include "Components/SingleResourceSerialization.h"
+#include "Components/ResourceSerializationHelper.h"
+#include <memory>
+#include <cstdint>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // largest element type of uncompressed resource data is 32 bit wide
+        constexpr std::uintptr_t MinimumMappedResourceDataAlignment = 4u;
+    }
+
     void ResourcePersistation::WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource)
     {
         SingleResourceSerialization::SerializeResource(outStream, *resource.get());
@@ -101,4 +112,40 @@ namespace ramses_internal
         assert(currentPosAfterRead - fileEntry.offsetInBytes == fileEntry.sizeInBytes);
         return resource;
     }
+
+    IResource* ResourcePersistation::RetrieveResourceFromMemoryMappedFile(const std::shared_ptr<MemoryMappedFile>& file, const ResourceFileEntry& fileEntry)
+    {
+        if (fileEntry.offsetInBytes > file->size() || fileEntry.sizeInBytes > file->size() - fileEntry.offsetInBytes)
+            return nullptr;
+
+        // entry comes from file content, reading must not go beyond it
+        Byte* entryData = file->data() + fileEntry.offsetInBytes;
+        RawBinaryInputStream inStream(entryData, fileEntry.sizeInBytes);
+        const ResourceSerializationHelper::DeserializedResourceHeader header = ResourceSerializationHelper::ResourceFromMetadataStream(inStream);
+        std::unique_ptr<IResource> resource(header.resource);
+        if (!resource || inStream.getState() != EStatus::Ok)
+            return nullptr;
+
+        const bool compressed = (header.compressionStatus == EResourceCompressionStatus_Compressed);
+        const UInt32 dataSize = compressed ? header.compressedSize : header.decompressedSize;
+        if (dataSize == 0u || dataSize != fileEntry.sizeInBytes - inStream.getBytesRead())
+            return nullptr;
+
+        // resource data references mapped file instead of being copied, compressed data is decompressed directly from mapping
+        Byte* resourceData = entryData + inStream.getBytesRead();
+        if (compressed)
+        {
+            resource->setCompressedResourceData(CompressedResourceBlob(dataSize, resourceData, file), IResource::CompressionLevel::Offline, header.decompressedSize, fileEntry.resourceInfo.hash);
+        }
+        else if (reinterpret_cast<std::uintptr_t>(resourceData) % MinimumMappedResourceDataAlignment == 0u)
+        {
+            resource->setResourceData(ResourceBlob(dataSize, resourceData, file), fileEntry.resourceInfo.hash);
+        }
+        else
+        {
+            // resource data is accessed as array of its elements, it must be copied if it is not aligned within file
+            resource->setResourceData(ResourceBlob(dataSize, resourceData), fileEntry.resourceInfo.hash);
+        }
+        return resource.release();
+    }
 }
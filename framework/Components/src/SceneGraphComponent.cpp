@@ -25,13 +25,14 @@
 
 namespace ramses_internal
 {
-    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock)
+    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock, bool coalesceSceneActions)
         : m_sceneRendererHandler(nullptr)
         , m_myID(myID)
         , m_communicationSystem(communicationSystem)
         , m_connectionStatusUpdateNotifier(connectionStatusUpdateNotifier)
         , m_frameworkLock(frameworkLock)
         , m_resourceComponent(res)
+        , m_coalesceSceneActions(coalesceSceneActions)
     {
         m_connectionStatusUpdateNotifier.registerForConnectionUpdates(this);
         m_communicationSystem.setSceneProviderServiceHandler(this);
@@ -106,6 +107,8 @@ namespace ramses_internal
     void SceneGraphComponent::sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode /*mode*/)
     {
         // send to network (no ownership transfer)
+        // one serializer for all remote receivers, so that packets are created once and shared
+        const SceneUpdateSerializer serializer(sceneUpdate);
         bool sendToSelf = false;
         bool alreadyCompressed = false;
         for (const auto& to : toVec)
@@ -124,7 +127,7 @@ namespace ramses_internal
                     }
                     alreadyCompressed = true;
                 }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate));
+                m_communicationSystem.sendSceneUpdate(to, sceneId, serializer);
             }
         }
 
@@ -274,6 +277,7 @@ namespace ramses_internal
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId() << " (shadow copy)");
             sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_resourceComponent, m_myID);
         }
+        sceneLogic->setSceneActionCoalescingEnabled(m_coalesceSceneActions);
         m_sceneEventConsumers.put(sceneId, &eventConsumer);
         m_clientSceneLogicMap.put(sceneId, sceneLogic);
     }
@@ -388,7 +392,7 @@ namespace ramses_internal
         }
     }
 
-    void SceneGraphComponent::handleRendererEvent(const SceneId& sceneId, const std::vector<Byte>& data, const Guid& /*rendererID*/)
+    void SceneGraphComponent::handleRendererEvent(const SceneId& sceneId, const std::vector<Byte>& data, const Guid& rendererID)
     {
         // First extract type of event, it is at the beginning
         // TODO(jonathan): check if we can improve type handling, handle in better framing format e.g.
@@ -413,6 +417,8 @@ namespace ramses_internal
             {
                 ResourceAvailabilityEvent event;
                 event.readFromBlob(data);
+                if (ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(event.sceneid))
+                    (*sceneLogic)->setResourcesAvailableAtSubscriber(rendererID, event.availableResources);
                 forwardToSceneProviderEventConsumer(event);
                 break;
             }
@@ -314,6 +314,34 @@ TYPED_TEST(AClientSceneLogic_All, flushesPendingActionsIfSceneDistributedAndHasP
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, doesNotCoalesceSceneActionsByDefault)
+{
+    const NodeHandle node = this->m_scene.allocateNode();
+    const TransformHandle transform = this->m_scene.allocateTransform(node);
+    this->m_scene.setTranslation(transform, Vector3(1.f));
+    this->m_scene.setTranslation(transform, Vector3(2.f));
+
+    this->expectResolveResources({}, 0);
+    this->m_sceneLogic.flushSceneActions({}, {});
+    EXPECT_EQ(0u, this->m_scene.getStatisticCollection().statSceneActionsCoalesced.getCounterValue());
+}
+
+TYPED_TEST(AClientSceneLogic_All, coalescesRedundantSceneActionsIfEnabled)
+{
+    this->m_sceneLogic.setSceneActionCoalescingEnabled(true);
+
+    const NodeHandle node = this->m_scene.allocateNode();
+    const TransformHandle transform = this->m_scene.allocateTransform(node);
+    this->m_scene.setTranslation(transform, Vector3(1.f));
+    this->m_scene.setTranslation(transform, Vector3(2.f));
+    this->m_scene.setTranslation(transform, Vector3(3.f));
+
+    this->expectResolveResources({}, 0);
+    this->m_sceneLogic.flushSceneActions({}, {});
+    EXPECT_EQ(2u, this->m_scene.getStatisticCollection().statSceneActionsCoalesced.getCounterValue());
+    EXPECT_LT(0u, this->m_scene.getStatisticCollection().statSceneActionsCoalescedSize.getCounterValue());
+}
+
 TEST_F(AClientSceneLogic_Direct, everyFlushGeneratesSceneActionSentToSubscriber)
 {
     this->publishAndAddSubscriberWithoutPendingActions();
@@ -1186,6 +1214,94 @@ TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResou
     this->expectSceneUnpublish();
 }
 
+TEST_F(AClientSceneLogic_Direct, doesNotSendDataOfResourcesAvailableAtNewlySubscribedRenderer)
+{
+    this->publish();
+    const float data1[] = { 1.f, 2.f, 3.f };
+    const float data2[] = { 4.f, 5.f, 6.f };
+    ManagedResourceVector resources{
+        std::make_shared<const ArrayResource>(EResourceType_VertexArray, 3, EDataType::Float, data1, ResourceCacheFlag_DoNotCache, "res1"),
+        std::make_shared<const ArrayResource>(EResourceType_VertexArray, 3, EDataType::Float, data2, ResourceCacheFlag_DoNotCache, "res2")
+    };
+    const ResourceContentHash hash1 = resources[0]->getHash();
+    const ResourceContentHash hash2 = resources[1]->getHash();
+    this->m_scene.allocateStreamTexture(WaylandIviSurfaceId{ 0u }, hash1);
+    this->m_scene.allocateStreamTexture(WaylandIviSurfaceId{ 1u }, hash2);
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+
+    const Guid rendererWithResource(9000);
+    this->m_sceneLogic.setResourcesAvailableAtSubscriber(rendererWithResource, { hash2, ResourceContentHash(1u, 2u) });
+    this->m_sceneLogic.addSubscriber(rendererWithResource);
+    this->addSubscriber();
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(rendererWithResource, _, _));
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ rendererWithResource }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        EXPECT_FALSE(update.actions.empty());
+        EXPECT_EQ((ResourceContentHashVector{ hash1, hash2 }), update.flushInfos.resourceChanges.m_resourcesAdded);
+        ASSERT_EQ(1u, update.resources.size());
+        EXPECT_EQ(hash1, update.resources[0]->getHash());
+    });
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        EXPECT_FALSE(update.actions.empty());
+        EXPECT_EQ((ResourceContentHashVector{ hash1, hash2 }), update.flushInfos.resourceChanges.m_resourcesAdded);
+        EXPECT_EQ(resources, update.resources);
+    });
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_Direct, sendsSameSceneUpdateToAllNewSubscribersIfNoneOfItsResourcesAreAvailableAtRenderer)
+{
+    this->publish();
+    const float data[] = { 1.f, 2.f, 3.f };
+    ManagedResourceVector resources{ std::make_shared<const ArrayResource>(EResourceType_VertexArray, 3, EDataType::Float, data, ResourceCacheFlag_DoNotCache, "res") };
+    this->m_scene.allocateStreamTexture(WaylandIviSurfaceId{ 0u }, resources[0]->getHash());
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+
+    const Guid otherRenderer(9000);
+    this->m_sceneLogic.setResourcesAvailableAtSubscriber(otherRenderer, { ResourceContentHash(1u, 2u) });
+    this->m_sceneLogic.addSubscriber(otherRenderer);
+    this->addSubscriber();
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(otherRenderer, _, _));
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ otherRenderer, this->m_rendererID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        EXPECT_EQ(resources, update.resources);
+    });
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_Direct, ignoresResourcesAvailableAtLocalSubscriber)
+{
+    this->publish();
+    const float data[] = { 1.f, 2.f, 3.f };
+    ManagedResourceVector resources{ std::make_shared<const ArrayResource>(EResourceType_VertexArray, 3, EDataType::Float, data, ResourceCacheFlag_DoNotCache, "res") };
+    this->m_scene.allocateStreamTexture(WaylandIviSurfaceId{ 0u }, resources[0]->getHash());
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+
+    this->m_sceneLogic.setResourcesAvailableAtSubscriber(this->m_myID, { resources[0]->getHash() });
+    this->m_sceneLogic.addSubscriber(this->m_myID);
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_myID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_myID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        EXPECT_EQ(resources, update.resources);
+    });
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(resources));
+    this->m_sceneLogic.flushSceneActions({}, {});
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, doesNotSendSceneUpdatesToNewSubscriberThatUnsubscribedBeforeFlush)
 {
     // add some active subscriber so actions are queued
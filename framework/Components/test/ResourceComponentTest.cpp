@@ -169,6 +169,38 @@ namespace ramses_internal
         ResourceComponent localResourceComponent;
     };
 
+    class AResourceComponentWithMemoryMappedFilesTest : public ResourceComponentTestBase
+    {
+    public:
+        AResourceComponentWithMemoryMappedFilesTest()
+            : localResourceComponent(statistics, frameworkLock, true)
+        {}
+
+        virtual ResourceComponent& getResourceComponent() override
+        {
+            return localResourceComponent;
+        }
+
+        void expectResourcesLoadedFromFileWithSameDataAsOriginal(const ResourceContentHashVector& hashes, size_t extraSize)
+        {
+            for (UInt32 i = 0; i < hashes.size(); ++i)
+            {
+                EXPECT_EQ(nullptr, localResourceComponent.getResource(hashes[i]).get());
+                ManagedResource resource = localResourceComponent.loadResource(hashes[i]);
+                ASSERT_TRUE(resource);
+                EXPECT_EQ(hashes[i], resource->getHash());
+                resource->decompress();
+
+                std::unique_ptr<IResource> original{ CreateTestResource(i*1.0f, extraSize) };
+                EXPECT_EQ(original->getResourceData().span(), resource->getResourceData().span());
+            }
+        }
+
+    protected:
+        StatisticCollectionFramework statistics;
+        ResourceComponent localResourceComponent;
+    };
+
     TEST_F(AResourceComponentTest, CanGetAlreadyManagedResource)
     {
         ResourceContentHash dummyResourceHash(47, 0);
@@ -508,4 +540,29 @@ namespace ramses_internal
         EXPECT_TRUE(resolved[0]->getHash() == hashes[0]);
         EXPECT_TRUE(resolved[1]->getHash() == hashes[1]);
     }
+
+    TEST_F(AResourceComponentWithMemoryMappedFilesTest, loadsUncompressedResourcesFromMappedFile)
+    {
+        const ResourceContentHashVector hashes = writeMultipleTestResourceFile(3, 2000, false);
+        expectResourcesLoadedFromFileWithSameDataAsOriginal(hashes, 2000);
+    }
+
+    TEST_F(AResourceComponentWithMemoryMappedFilesTest, loadsCompressedResourcesFromMappedFile)
+    {
+        const ResourceContentHashVector hashes = writeMultipleTestResourceFile(3, 2000, true);
+        expectResourcesLoadedFromFileWithSameDataAsOriginal(hashes, 2000);
+    }
+
+    TEST_F(AResourceComponentWithMemoryMappedFilesTest, canRemoveMappedResourceFileAndKeepsLoadedResource)
+    {
+        const ResourceContentHash hash = writeTestResourceFile();
+        ManagedResource resource = localResourceComponent.loadResource(hash);
+        ASSERT_TRUE(resource);
+
+        localResourceComponent.removeResourceFile(resourceFileName);
+        EXPECT_FALSE(localResourceComponent.hasResourceFile(resourceFileName));
+
+        std::unique_ptr<IResource> original{ CreateTestResource() };
+        EXPECT_EQ(original->getResourceData().span(), resource->getResourceData().span());
+    }
 }
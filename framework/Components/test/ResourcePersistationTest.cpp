@@ -17,6 +17,7 @@
 #include "Components/ResourceDeleterCallingCallback.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "ResourceMock.h"
 
 using namespace testing;
@@ -282,4 +283,106 @@ namespace ramses_internal
         EXPECT_EQ(String("Some effect with a name"), loadedResource->getName());
         delete loadedResource;
     }
+
+    TEST(ResourcePersistation, retrievesResourceFromMemoryMappedFileOnlyWithinFileAndEntryBounds)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        float data[9];
+        for (uint32_t i = 0u; i < 9; ++i)
+        {
+            data[i] = static_cast<Float>(i);
+        }
+        ArrayResource res(EResourceType_VertexArray, 3, EDataType::Vector3F, data, ResourceCacheFlag(0u), "res");
+        ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+
+        const String filename("memoryMappedResourceFile");
+        File tempFile(filename);
+        {
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, { managedRes }, false);
+        }
+        tempFile.close();
+
+        ResourceTableOfContents loadedTOC;
+        {
+            BinaryFileInputStream instream(tempFile);
+            loadedTOC.readTOCPosAndTOCFromStream(instream);
+        }
+        tempFile.close();
+        ASSERT_TRUE(loadedTOC.containsResource(managedRes->getHash()));
+        const ResourceFileEntry entry = loadedTOC.getEntryForHash(managedRes->getHash());
+
+        {
+            const auto mappedFilePtr = std::make_shared<MemoryMappedFile>(filename);
+            const MemoryMappedFile& mappedFile = *mappedFilePtr;
+            ASSERT_TRUE(mappedFile.isMapped());
+
+            std::unique_ptr<IResource> loadedResource(ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFilePtr, entry));
+            ASSERT_TRUE(loadedResource);
+            EXPECT_EQ(absl::MakeSpan(reinterpret_cast<const uint8_t*>(data), sizeof(data)), loadedResource->getResourceData().span());
+
+            ResourceFileEntry truncatedEntry = entry;
+            truncatedEntry.sizeInBytes -= 1u;
+            EXPECT_EQ(nullptr, ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFilePtr, truncatedEntry));
+
+            ResourceFileEntry entryBeyondFile = entry;
+            entryBeyondFile.offsetInBytes = static_cast<UInt32>(mappedFile.size());
+            EXPECT_EQ(nullptr, ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFilePtr, entryBeyondFile));
+
+            ResourceFileEntry entryOverflowingOffset = entry;
+            entryOverflowingOffset.sizeInBytes = std::numeric_limits<UInt32>::max();
+            EXPECT_EQ(nullptr, ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFilePtr, entryOverflowingOffset));
+        }
+
+        tempFile.remove();
+    }
+
+    TEST(ResourcePersistation, retrievesCompressedResourceFromMemoryMappedFileWithoutCopyingIt)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        std::vector<float> data(30000u);
+        for (size_t i = 0u; i < data.size(); ++i)
+            data[i] = static_cast<Float>(i % 100u);
+        ArrayResource res(EResourceType_VertexArray, static_cast<UInt32>(data.size() / 3u), EDataType::Vector3F, data.data(), ResourceCacheFlag(0u), "res");
+        ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+
+        const String filename("memoryMappedCompressedResourceFile");
+        File tempFile(filename);
+        {
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, { managedRes }, true);
+        }
+        tempFile.close();
+
+        ResourceTableOfContents loadedTOC;
+        {
+            BinaryFileInputStream instream(tempFile);
+            loadedTOC.readTOCPosAndTOCFromStream(instream);
+        }
+        tempFile.close();
+        ASSERT_TRUE(loadedTOC.containsResource(managedRes->getHash()));
+
+        auto mappedFile = std::make_shared<MemoryMappedFile>(filename);
+        ASSERT_TRUE(mappedFile->isMapped());
+        std::unique_ptr<IResource> loadedResource(ResourcePersistation::RetrieveResourceFromMemoryMappedFile(mappedFile, loadedTOC.getEntryForHash(managedRes->getHash())));
+        ASSERT_TRUE(loadedResource);
+        ASSERT_TRUE(loadedResource->isCompressedAvailable());
+        EXPECT_FALSE(loadedResource->isDeCompressedAvailable());
+        EXPECT_TRUE(loadedResource->getCompressedResourceData().isExternal());
+        EXPECT_GE(loadedResource->getCompressedResourceData().data(), mappedFile->data());
+        EXPECT_LT(loadedResource->getCompressedResourceData().data(), mappedFile->data() + mappedFile->size());
+
+        // resource keeps mapping alive
+        mappedFile.reset();
+        loadedResource->decompress();
+        EXPECT_EQ(absl::MakeSpan(reinterpret_cast<const uint8_t*>(data.data()), data.size() * sizeof(float)), loadedResource->getResourceData().span());
+        EXPECT_FALSE(loadedResource->getResourceData().isExternal());
+
+        loadedResource.reset();
+        tempFile.remove();
+    }
 }
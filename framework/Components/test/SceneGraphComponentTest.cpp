@@ -366,6 +366,26 @@ TEST_F(ASceneGraphComponent, canSendSceneActionsToLocalAndRemote)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
 }
 
+TEST_F(ASceneGraphComponent, usesSameSerializerForAllRemoteReceiversOfSceneUpdate)
+{
+    const SceneId sceneId(456);
+    const Guid otherRemoteParticipantID(33);
+
+    const ISceneUpdateSerializer* usedSerializer = nullptr;
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto, auto, auto& serializer) {
+        usedSerializer = &serializer;
+        return true;
+    });
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(otherRemoteParticipantID, sceneId, _)).WillOnce([&](auto, auto, auto& serializer) {
+        EXPECT_EQ(usedSerializer, &serializer);
+        return true;
+    });
+
+    SceneUpdate update;
+    update.actions = createFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction });
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, otherRemoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
+}
+
 TEST_F(ASceneGraphComponent, canRepublishALocalOnlySceneToBeDistributedRemotely)
 {
     sceneGraphComponent.setSceneRendererHandler(&consumer);
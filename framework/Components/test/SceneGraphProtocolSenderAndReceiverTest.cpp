@@ -171,4 +171,30 @@ namespace ramses_internal
         ASSERT_TRUE(waitForEvent(2));
     }
 
+    TEST_P(ASceneGraphProtocolSenderAndReceiverTest, sendLargeSceneUpdateAndRecordThroughput)
+    {
+        skipStatisticsTest();
+
+        const SceneId sceneId{432};
+        const int numPackets = 100;
+        const std::vector<Byte> blob(290000, 7u);
+
+        {
+            PlatformGuard g(receiverExpectCallLock);
+            EXPECT_CALL(consumerHandler, handleSceneUpdate(sceneId, _, senderId)).Times(numPackets).WillRepeatedly([&](auto, const auto& data, auto) {
+                EXPECT_EQ(blob.size(), data.size());
+                sendEvent();
+            });
+        }
+
+        FakseSceneUpdateSerializer serializer(std::vector<std::vector<Byte>>(numPackets, blob), 300000);
+        const auto startTime = std::chrono::steady_clock::now();
+        EXPECT_TRUE(sender.sendSceneUpdate(receiverId, sceneId, serializer));
+        ASSERT_TRUE(waitForEvent(numPackets));
+        const auto durationUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+        // bytes per microsecond equal megabytes per second
+        const auto totalBytes = static_cast<int64_t>(numPackets) * static_cast<int64_t>(blob.size());
+        RecordProperty("ThroughputMBytesPerSecond", static_cast<int>(totalBytes / std::max<int64_t>(durationUs, 1)));
+    }
 }
@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UTILS_ASYNCLOGDISPATCHER_H
+#define RAMSES_UTILS_ASYNCLOGDISPATCHER_H
+
+#include "Utils/LogLevel.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ramses_internal
+{
+    class LogContext;
+    class LogMessage;
+
+    enum class EAsyncLogOverflowPolicy
+    {
+        Drop,   // message is discarded and counted as dropped
+        Block   // logging thread waits until logger thread made room
+    };
+
+    // Decouples logging threads from appender I/O: log messages are copied into a bounded ring buffer
+    // (lock-free for the logging threads) and handed to the dispatch function on a dedicated logger thread.
+    class AsyncLogDispatcher final : public Runnable
+    {
+    public:
+        using DispatchFunction = std::function<void(const LogMessage&)>;
+
+        AsyncLogDispatcher(UInt32 queueSize, EAsyncLogOverflowPolicy overflowPolicy, DispatchFunction dispatchFunction);
+        virtual ~AsyncLogDispatcher() override;
+
+        // returns false if message was dropped
+        bool push(const LogMessage& msg);
+        // blocks until all messages pushed so far are dispatched
+        void flush();
+
+        UInt64 getDroppedMessageCount() const;
+        UInt32 getQueueSize() const;
+        EAsyncLogOverflowPolicy getOverflowPolicy() const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> sequence{ 0u };
+            const LogContext* context = nullptr;
+            ELogLevel logLevel = ELogLevel::Off;
+            std::string text;
+        };
+
+        virtual void run() override;
+
+        bool tryPush(const LogMessage& msg);
+        bool dispatchPendingMessages();
+        bool hasPendingMessage() const;
+        void reportDroppedMessages();
+        void wakeUpLoggerThread();
+        bool isLoggerThread() const;
+
+        const EAsyncLogOverflowPolicy m_overflowPolicy;
+        const DispatchFunction m_dispatchFunction;
+        const size_t m_queueSize;
+        std::unique_ptr<Slot[]> m_slots;
+
+        std::atomic<size_t> m_enqueuePosition{ 0u };
+        std::atomic<size_t> m_dequeuePosition{ 0u };
+        std::atomic<UInt64> m_droppedMessages{ 0u };
+        UInt64 m_reportedDroppedMessages = 0u;
+
+        std::mutex m_wakeUpLock;
+        std::condition_variable m_wakeUpCondition;
+        std::atomic<bool> m_loggerThreadWaiting{ false };
+        std::atomic<std::thread::id> m_loggerThreadId{ std::thread::id() };
+
+        PlatformThread m_thread;
+    };
+}
+
+#endif
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MEMORYMAPPEDFILE_H
+#define RAMSES_MEMORYMAPPEDFILE_H
+
+#include "Collections/String.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+
+namespace ramses_internal
+{
+    // Maps whole file into memory for as long as the object lives.
+    // Pages are loaded by OS on first access and can be dropped again under memory pressure,
+    // so file content does not need to be buffered additionally in heap memory.
+    // Mapping is private copy-on-write, modifying mapped memory only copies the touched pages and never changes the file.
+    class MemoryMappedFile final
+    {
+    public:
+        explicit MemoryMappedFile(const String& filepath);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        // false if file could not be opened or is empty
+        bool isMapped() const;
+        Byte* data();
+        const Byte* data() const;
+        size_t size() const;
+
+    private:
+        Byte* m_data = nullptr;
+        size_t m_size = 0u;
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#endif
+    };
+
+    inline bool MemoryMappedFile::isMapped() const
+    {
+        return m_data != nullptr;
+    }
+
+    inline Byte* MemoryMappedFile::data()
+    {
+        return m_data;
+    }
+
+    inline const Byte* MemoryMappedFile::data() const
+    {
+        return m_data;
+    }
+
+    inline size_t MemoryMappedFile::size() const
+    {
+        return m_size;
+    }
+}
+
+#endif
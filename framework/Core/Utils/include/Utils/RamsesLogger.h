@@ -13,6 +13,7 @@
 #include "Utils/LogContext.h"
 #include "Utils/ConsoleLogAppender.h"
 #include "Utils/LogAppenderBase.h"
+#include "Utils/AsyncLogDispatcher.h"
 #include "Collections/Vector.h"
 #include "Collections/String.h"
 #include <mutex>
@@ -44,6 +45,13 @@ namespace ramses_internal
 
         void log(const LogMessage& msg);
 
+        // appenders are called on a dedicated logger thread instead of the logging thread
+        void enableAsyncLogging(UInt32 queueSize, EAsyncLogOverflowPolicy overflowPolicy);
+        // dispatches all queued messages before returning
+        void disableAsyncLogging();
+        bool isAsyncLoggingEnabled() const;
+        UInt64 getDroppedLogMessageCount() const;
+
         void applyContextFilterCommand(const String& command);
         std::vector<LogContextInformation> getAllContextsInformation() const;
 
@@ -64,13 +72,14 @@ namespace ramses_internal
     private:
         static const ELogLevel LogLevelDefault_Contexts = ELogLevel::Info;
         static const ELogLevel LogLevelDefault_Console = ELogLevel::Info;
-
+        static const UInt32 DefaultAsyncLogQueueSize = 4096u;
 
         static void UpdateConsoleLogLevelFromDefine(ELogLevel& loglevel);
         static void UpdateConsoleLogLevelFromEnvVar(ELogLevel& loglevel);
 
         void dltLogLevelChangeCallback(const String& contextId, int logLevelAsInt);
         LogContext* getLogContextById(const String& contextId);
+        void dispatchToAppenders(const LogMessage& msg);
 
         std::mutex m_appenderLock;
         bool m_isInitialized;
@@ -82,6 +91,9 @@ namespace ramses_internal
         std::vector<LogAppenderBase*> m_logAppenders;
         LogContext& m_fileTransferContext;
         ELogLevel m_consoleLogLevelProgrammatically = LogLevelDefault_Console;
+        // dispatcher is kept once created, so that threads logging concurrently to disabling can still use it
+        std::unique_ptr<AsyncLogDispatcher> m_asyncLogDispatcher;
+        std::atomic<bool> m_asyncLoggingEnabled{ false };
     };
 
     inline RamsesLogger& GetRamsesLogger()
@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RAWBINARYINPUTSTREAM_H
+#define RAMSES_RAWBINARYINPUTSTREAM_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Collections/IInputStream.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    // Reads from memory of known size. Like BinaryFileInputStream at end of file, a read beyond the end
+    // leaves the target untouched and puts the stream into error state.
+    class RawBinaryInputStream: public IInputStream
+    {
+    public:
+        RawBinaryInputStream(const Byte* data, size_t size);
+
+        IInputStream& read(void* buffer, size_t size) override;
+        virtual EStatus getState() const override;
+
+        size_t getBytesRead() const;
+        size_t getSize() const;
+
+    private:
+        const Byte* m_data;
+        size_t m_size;
+        size_t m_bytesRead = 0u;
+        EStatus m_state = EStatus::Ok;
+    };
+
+    inline RawBinaryInputStream::RawBinaryInputStream(const Byte* data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    inline IInputStream& RawBinaryInputStream::read(void* buffer, size_t size)
+    {
+        if (m_state != EStatus::Ok)
+            return *this;
+
+        if (size > m_size - m_bytesRead)
+        {
+            m_state = EStatus::Eof;
+            return *this;
+        }
+
+        if (size)
+            std::memcpy(buffer, m_data + m_bytesRead, size);
+        m_bytesRead += size;
+        return *this;
+    }
+
+    inline EStatus RawBinaryInputStream::getState() const
+    {
+        return m_state;
+    }
+
+    inline size_t RawBinaryInputStream::getBytesRead() const
+    {
+        return m_bytesRead;
+    }
+
+    inline size_t RawBinaryInputStream::getSize() const
+    {
+        return m_size;
+    }
+}
+
+#endif
@@ -165,6 +165,8 @@ namespace ramses_internal
         StatisticEntry<UInt32> statResourcesReceivedNumber;
         StatisticEntry<UInt32> statResourcesLoadedFromFileNumber;
         StatisticEntry<UInt32> statResourcesLoadedFromFileSize;
+        StatisticEntry<UInt32> statEffectCompilationCacheHits;
+        StatisticEntry<UInt32> statEffectCompilationCacheMisses;
     };
 
     class StatisticCollectionScene : public StatisticCollection
@@ -185,6 +187,8 @@ namespace ramses_internal
         StatisticEntry<UInt32> statSceneActionsSentSkipped;
         StatisticEntry<UInt32> statSceneActionsGenerated;
         StatisticEntry<UInt32> statSceneActionsGeneratedSize;
+        StatisticEntry<UInt32> statSceneActionsCoalesced; //redundant actions removed on flush
+        StatisticEntry<UInt32> statSceneActionsCoalescedSize;
     };
 }
 
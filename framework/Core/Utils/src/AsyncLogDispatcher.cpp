@@ -0,0 +1,201 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogDispatcher.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogMacros.h"
+#include <chrono>
+
+namespace ramses_internal
+{
+    static size_t GetRingBufferSize(UInt32 queueSize)
+    {
+        // power of two, so that sequence numbers map to slots without gaps when they wrap around
+        size_t size = 2u;
+        while (size < queueSize)
+            size *= 2u;
+        return size;
+    }
+
+    AsyncLogDispatcher::AsyncLogDispatcher(UInt32 queueSize, EAsyncLogOverflowPolicy overflowPolicy, DispatchFunction dispatchFunction)
+        : m_overflowPolicy(overflowPolicy)
+        , m_dispatchFunction(std::move(dispatchFunction))
+        , m_queueSize(GetRingBufferSize(queueSize))
+        , m_slots(new Slot[m_queueSize])
+        , m_thread("R_AsyncLogger")
+    {
+        for (size_t i = 0u; i < m_queueSize; ++i)
+            m_slots[i].sequence = i;
+        m_thread.start(*this);
+    }
+
+    AsyncLogDispatcher::~AsyncLogDispatcher()
+    {
+        // logger thread dispatches all remaining messages before it finishes
+        cancel();
+        wakeUpLoggerThread();
+        m_thread.join();
+    }
+
+    bool AsyncLogDispatcher::push(const LogMessage& msg)
+    {
+        if (!tryPush(msg))
+        {
+            // logger thread must never wait for itself, e.g. when an appender logs
+            if (m_overflowPolicy == EAsyncLogOverflowPolicy::Drop || isLoggerThread())
+            {
+                ++m_droppedMessages;
+                return false;
+            }
+
+            do
+            {
+                wakeUpLoggerThread();
+                std::this_thread::yield();
+            } while (!tryPush(msg));
+        }
+
+        // pairs with logger thread setting waiting flag before checking for messages, so that no wake up gets lost
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_loggerThreadWaiting)
+            wakeUpLoggerThread();
+        return true;
+    }
+
+    void AsyncLogDispatcher::flush()
+    {
+        if (isLoggerThread())
+            return;
+
+        const size_t pushedMessages = m_enqueuePosition.load();
+        while (m_dequeuePosition.load() < pushedMessages)
+        {
+            wakeUpLoggerThread();
+            std::this_thread::yield();
+        }
+    }
+
+    UInt64 AsyncLogDispatcher::getDroppedMessageCount() const
+    {
+        return m_droppedMessages;
+    }
+
+    UInt32 AsyncLogDispatcher::getQueueSize() const
+    {
+        return static_cast<UInt32>(m_queueSize);
+    }
+
+    EAsyncLogOverflowPolicy AsyncLogDispatcher::getOverflowPolicy() const
+    {
+        return m_overflowPolicy;
+    }
+
+    bool AsyncLogDispatcher::tryPush(const LogMessage& msg)
+    {
+        // bounded multi producer queue: every slot carries a sequence number telling whether it is free for
+        // position being claimed (sequence == position) or still holds message of previous round (sequence < position)
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;)
+        {
+            slot = &m_slots[position & (m_queueSize - 1u)];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence == position)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    break;
+            }
+            else if (sequence < position)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->context = &msg.getContext();
+        slot->logLevel = msg.getLogLevel();
+        slot->text.assign(msg.getStream().data());
+        slot->sequence.store(position + 1u, std::memory_order_release);
+        return true;
+    }
+
+    bool AsyncLogDispatcher::hasPendingMessage() const
+    {
+        const size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        return m_slots[position & (m_queueSize - 1u)].sequence.load(std::memory_order_acquire) == position + 1u;
+    }
+
+    bool AsyncLogDispatcher::dispatchPendingMessages()
+    {
+        bool dispatchedAny = false;
+        while (hasPendingMessage())
+        {
+            const size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[position & (m_queueSize - 1u)];
+
+            // text is moved back afterwards so that slot keeps its allocated capacity
+            StringOutputStream stream(std::move(slot.text));
+            m_dispatchFunction(LogMessage(*slot.context, slot.logLevel, stream));
+            slot.text = stream.release();
+
+            slot.sequence.store(position + m_queueSize, std::memory_order_release);
+            m_dequeuePosition.store(position + 1u);
+            dispatchedAny = true;
+        }
+
+        reportDroppedMessages();
+        return dispatchedAny;
+    }
+
+    void AsyncLogDispatcher::reportDroppedMessages()
+    {
+        const UInt64 droppedMessages = m_droppedMessages;
+        if (droppedMessages == m_reportedDroppedMessages)
+            return;
+
+        StringOutputStream stream;
+        stream << "AsyncLogDispatcher: " << (droppedMessages - m_reportedDroppedMessages) << " log messages dropped because log queue of size "
+            << m_queueSize << " was full (" << droppedMessages << " in total)";
+        m_dispatchFunction(LogMessage(CONTEXT_FRAMEWORK, ELogLevel::Warn, stream));
+        m_reportedDroppedMessages = droppedMessages;
+    }
+
+    void AsyncLogDispatcher::run()
+    {
+        m_loggerThreadId = std::this_thread::get_id();
+
+        while (!isCancelRequested())
+        {
+            if (!dispatchPendingMessages())
+            {
+                std::unique_lock<std::mutex> l(m_wakeUpLock);
+                m_loggerThreadWaiting = true;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                // timeout only as safety net, logging threads wake logger thread up when it is waiting
+                m_wakeUpCondition.wait_for(l, std::chrono::milliseconds(100), [this] { return isCancelRequested() || hasPendingMessage(); });
+                m_loggerThreadWaiting = false;
+            }
+        }
+
+        dispatchPendingMessages();
+    }
+
+    void AsyncLogDispatcher::wakeUpLoggerThread()
+    {
+        std::lock_guard<std::mutex> l(m_wakeUpLock);
+        m_wakeUpCondition.notify_one();
+    }
+
+    bool AsyncLogDispatcher::isLoggerThread() const
+    {
+        return m_loggerThreadId.load() == std::this_thread::get_id();
+    }
+}
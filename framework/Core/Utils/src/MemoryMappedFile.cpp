@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+
+#ifdef _WIN32
+
+#include "PlatformAbstraction/MinimalWindowsH.h"
+
+namespace ramses_internal
+{
+    MemoryMappedFile::MemoryMappedFile(const String& filepath)
+    {
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        m_fileHandle = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+            return;
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping == nullptr)
+            return;
+        m_mappingHandle = mapping;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (view == nullptr)
+            return;
+
+        m_data = static_cast<Byte*>(view);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle)
+            CloseHandle(m_fileHandle);
+    }
+}
+
+#else // posix
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ramses_internal
+{
+    MemoryMappedFile::MemoryMappedFile(const String& filepath)
+    {
+        const int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+            void* mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED)
+            {
+                m_data = static_cast<Byte*>(mapping);
+                m_size = fileSize;
+            }
+        }
+
+        // mapping stays valid after closing file descriptor
+        close(fd);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            munmap(m_data, m_size);
+    }
+}
+
+#endif
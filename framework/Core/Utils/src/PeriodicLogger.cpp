@@ -166,6 +166,10 @@ namespace ramses_internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileSize.getSummary(), numberTimeIntervals);
+                    output << " effCH ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statEffectCompilationCacheHits.getSummary(), numberTimeIntervals);
+                    output << " effCM ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statEffectCompilationCacheMisses.getSummary(), numberTimeIntervals);
         }));
 
         m_statisticCollection.resetSummaries();
@@ -195,6 +199,10 @@ namespace ramses_internal
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsGenerated.getSummary(), numberTimeIntervals);
                             output << " actGS ";
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsGeneratedSize.getSummary(), numberTimeIntervals);
+                            output << " actC ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneActionsCoalesced.getSummary(), numberTimeIntervals);
+                            output << " actCS ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneActionsCoalescedSize.getSummary(), numberTimeIntervals);
                             output << " actO ";
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsSent.getSummary(), numberTimeIntervals);
                             output << " actSkp ";
@@ -22,6 +22,8 @@
 
 namespace ramses_internal
 {
+    const UInt32 RamsesLogger::DefaultAsyncLogQueueSize;
+
     RamsesLogger::RamsesLogger()
         : m_isInitialized(false)
         , m_consoleLogAppender()
@@ -43,6 +45,8 @@ namespace ramses_internal
 
     RamsesLogger::~RamsesLogger()
     {
+        // queued messages refer to contexts
+        m_asyncLogDispatcher.reset();
         for (auto& ctx : m_logContexts)
         {
             delete ctx;
@@ -194,8 +198,14 @@ namespace ramses_internal
             CONTEXT_SMOKETEST.disableSetLogLevel();
         }
 
+        ArgumentBool logAsync(parser, "la", "log-async", "");
+        ArgumentUInt32 logAsyncQueueSize(parser, "laqs", "log-async-queue-size", DefaultAsyncLogQueueSize);
+        ArgumentBool logAsyncBlockWhenFull(parser, "labf", "log-async-block-when-full", "");
+        if (logAsync.wasDefined())
+            enableAsyncLogging(logAsyncQueueSize, logAsyncBlockWhenFull.wasDefined() ? EAsyncLogOverflowPolicy::Block : EAsyncLogOverflowPolicy::Drop);
+
         LOG_INFO(CONTEXT_FRAMEWORK, "Ramses log levels: Contexts " << RamsesLogger::GetLogLevelText(logLevelContexts) <<
-                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole));
+                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole) << (isAsyncLoggingEnabled() ? ", async" : ""));
     }
 
     void RamsesLogger::applyContextFilterCommand(const String& command)
@@ -334,14 +344,63 @@ namespace ramses_internal
     {
         if (msg.getStream().size() > 0)
         {
-            std::lock_guard<std::mutex> guard(m_appenderLock);
-            for (auto& appender : m_logAppenders)
+            if (m_asyncLoggingEnabled)
             {
-                appender->log(msg);
+                m_asyncLogDispatcher->push(msg);
+                // make sure fatal message is written before application possibly terminates
+                if (msg.getLogLevel() == ELogLevel::Fatal)
+                    m_asyncLogDispatcher->flush();
             }
+            else
+            {
+                dispatchToAppenders(msg);
+            }
+        }
+    }
+
+    void RamsesLogger::dispatchToAppenders(const LogMessage& msg)
+    {
+        std::lock_guard<std::mutex> guard(m_appenderLock);
+        for (auto& appender : m_logAppenders)
+        {
+            appender->log(msg);
         }
     }
 
+    void RamsesLogger::enableAsyncLogging(UInt32 queueSize, EAsyncLogOverflowPolicy overflowPolicy)
+    {
+        if (m_asyncLogDispatcher)
+        {
+            if (m_asyncLogDispatcher->getQueueSize() < queueSize)
+                LOG_WARN(CONTEXT_FRAMEWORK, "RamsesLogger::enableAsyncLogging: keeping existing log queue of size " << m_asyncLogDispatcher->getQueueSize());
+            if (m_asyncLogDispatcher->getOverflowPolicy() != overflowPolicy)
+                LOG_WARN(CONTEXT_FRAMEWORK, "RamsesLogger::enableAsyncLogging: keeping existing log queue overflow policy "
+                    << (m_asyncLogDispatcher->getOverflowPolicy() == EAsyncLogOverflowPolicy::Block ? "block" : "drop"));
+        }
+        else
+        {
+            m_asyncLogDispatcher.reset(new AsyncLogDispatcher(queueSize, overflowPolicy, [this](const LogMessage& msg) { dispatchToAppenders(msg); }));
+        }
+        m_asyncLoggingEnabled = true;
+    }
+
+    void RamsesLogger::disableAsyncLogging()
+    {
+        m_asyncLoggingEnabled = false;
+        if (m_asyncLogDispatcher)
+            m_asyncLogDispatcher->flush();
+    }
+
+    bool RamsesLogger::isAsyncLoggingEnabled() const
+    {
+        return m_asyncLoggingEnabled;
+    }
+
+    UInt64 RamsesLogger::getDroppedLogMessageCount() const
+    {
+        return m_asyncLogDispatcher ? m_asyncLogDispatcher->getDroppedMessageCount() : 0u;
+    }
+
     const char* RamsesLogger::GetLogLevelText(ELogLevel logLevel)
     {
         switch (logLevel)
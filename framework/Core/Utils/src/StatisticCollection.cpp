@@ -53,6 +53,8 @@ namespace ramses_internal
         statResourcesReceivedNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+        statEffectCompilationCacheHits.reset();
+        statEffectCompilationCacheMisses.reset();
     }
 
     void StatisticCollectionFramework::resetSummaries()
@@ -71,6 +73,8 @@ namespace ramses_internal
         statResourcesReceivedNumber.getSummary().reset();
         statResourcesLoadedFromFileNumber.getSummary().reset();
         statResourcesLoadedFromFileSize.getSummary().reset();
+        statEffectCompilationCacheHits.getSummary().reset();
+        statEffectCompilationCacheMisses.getSummary().reset();
     }
 
     void StatisticCollectionFramework::nextTimeInterval()
@@ -88,6 +92,8 @@ namespace ramses_internal
         statResourcesReceivedNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileSize.updateSummaryAndResetCounter();
+        statEffectCompilationCacheHits.updateSummaryAndResetCounter();
+        statEffectCompilationCacheMisses.updateSummaryAndResetCounter();
 
         statResourcesNumber.incCounter(resourcesCreated);
         statResourcesNumber.decCounter(resourcesDestroyed);
@@ -109,6 +115,8 @@ namespace ramses_internal
         statSceneActionsSentSkipped.reset();
         statSceneActionsGenerated.reset();
         statSceneActionsGeneratedSize.reset();
+        statSceneActionsCoalesced.reset();
+        statSceneActionsCoalescedSize.reset();
     }
 
     void StatisticCollectionScene::resetSummaries()
@@ -126,6 +134,8 @@ namespace ramses_internal
         statSceneActionsSentSkipped.getSummary().reset();
         statSceneActionsGenerated.getSummary().reset();
         statSceneActionsGeneratedSize.getSummary().reset();
+        statSceneActionsCoalesced.getSummary().reset();
+        statSceneActionsCoalescedSize.getSummary().reset();
     }
 
     void StatisticCollectionScene::nextTimeInterval()
@@ -142,6 +152,8 @@ namespace ramses_internal
         statSceneActionsSentSkipped.updateSummaryAndResetCounter();
         statSceneActionsGenerated.updateSummaryAndResetCounter();
         statSceneActionsGeneratedSize.updateSummaryAndResetCounter();
+        statSceneActionsCoalesced.updateSummaryAndResetCounter();
+        statSceneActionsCoalescedSize.updateSummaryAndResetCounter();
 
         statObjectsNumber.incCounter(objectsCreated);
         statObjectsNumber.decCounter(objectsDestroyed);
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogDispatcher.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogContext.h"
+#include "gtest/gtest.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string>
+
+namespace ramses_internal
+{
+    class AnAsyncLogDispatcher : public ::testing::Test
+    {
+    protected:
+        AsyncLogDispatcher::DispatchFunction createDispatchFunction()
+        {
+            return [this](const LogMessage& msg)
+            {
+                std::unique_lock<std::mutex> l(m_lock);
+                m_condition.wait(l, [this] { return !m_dispatchBlocked; });
+                m_dispatchedMessages.push_back(msg.getStream().data());
+                m_dispatchThreads.push_back(std::this_thread::get_id());
+                m_dispatchedContexts.push_back(&msg.getContext());
+            };
+        }
+
+        void log(AsyncLogDispatcher& dispatcher, const std::string& text, ELogLevel logLevel = ELogLevel::Info)
+        {
+            dispatcher.push(LogMessage(m_context, logLevel, StringOutputStream(text)));
+        }
+
+        void setDispatchBlocked(bool blocked)
+        {
+            std::lock_guard<std::mutex> l(m_lock);
+            m_dispatchBlocked = blocked;
+            m_condition.notify_all();
+        }
+
+        std::vector<std::string> getDispatchedMessages()
+        {
+            std::lock_guard<std::mutex> l(m_lock);
+            return m_dispatchedMessages;
+        }
+
+        LogContext m_context{ "Async Test Context", "ASYN" };
+
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        bool m_dispatchBlocked = false;
+        std::vector<std::string> m_dispatchedMessages;
+        std::vector<std::thread::id> m_dispatchThreads;
+        std::vector<const LogContext*> m_dispatchedContexts;
+    };
+
+    TEST_F(AnAsyncLogDispatcher, roundsUpQueueSizeToPowerOfTwo)
+    {
+        AsyncLogDispatcher dispatcher(100u, EAsyncLogOverflowPolicy::Drop, createDispatchFunction());
+        EXPECT_EQ(128u, dispatcher.getQueueSize());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, reportsOverflowPolicy)
+    {
+        EXPECT_EQ(EAsyncLogOverflowPolicy::Drop, AsyncLogDispatcher(16u, EAsyncLogOverflowPolicy::Drop, createDispatchFunction()).getOverflowPolicy());
+        EXPECT_EQ(EAsyncLogOverflowPolicy::Block, AsyncLogDispatcher(16u, EAsyncLogOverflowPolicy::Block, createDispatchFunction()).getOverflowPolicy());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dispatchesMessagesInOrderOnLoggerThread)
+    {
+        AsyncLogDispatcher dispatcher(16u, EAsyncLogOverflowPolicy::Drop, createDispatchFunction());
+        log(dispatcher, "foo");
+        log(dispatcher, "bar");
+        log(dispatcher, "baz");
+        dispatcher.flush();
+
+        EXPECT_EQ(std::vector<std::string>({ "foo", "bar", "baz" }), getDispatchedMessages());
+        ASSERT_EQ(3u, m_dispatchThreads.size());
+        EXPECT_NE(std::this_thread::get_id(), m_dispatchThreads[0]);
+        EXPECT_EQ(&m_context, m_dispatchedContexts[0]);
+        EXPECT_EQ(0u, dispatcher.getDroppedMessageCount());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dispatchesRemainingMessagesWhenDestroyed)
+    {
+        {
+            AsyncLogDispatcher dispatcher(16u, EAsyncLogOverflowPolicy::Drop, createDispatchFunction());
+            for (int i = 0; i < 10; ++i)
+                log(dispatcher, std::to_string(i));
+        }
+        EXPECT_EQ(10u, getDispatchedMessages().size());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dropsMessagesWhenQueueIsFullAndReportsThem)
+    {
+        AsyncLogDispatcher dispatcher(4u, EAsyncLogOverflowPolicy::Drop, createDispatchFunction());
+        setDispatchBlocked(true);
+
+        // logger thread takes at most one message before blocking in dispatch, queue holds 4 more
+        for (int i = 0; i < 10; ++i)
+            log(dispatcher, std::to_string(i));
+        const UInt64 dropped = dispatcher.getDroppedMessageCount();
+        EXPECT_GE(dropped, 5u);
+        EXPECT_LE(dropped, 6u);
+
+        setDispatchBlocked(false);
+        dispatcher.flush();
+        log(dispatcher, "last");
+        dispatcher.flush();
+
+        const auto messages = getDispatchedMessages();
+        ASSERT_EQ(10u - dropped + 2u, messages.size());
+        EXPECT_EQ("0", messages.front());
+        EXPECT_NE(std::string::npos, messages[messages.size() - 2u].find("log messages dropped"));
+        EXPECT_EQ("last", messages.back());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, blocksLoggingThreadsWhenQueueIsFullAndDeliversAllMessages)
+    {
+        AsyncLogDispatcher dispatcher(4u, EAsyncLogOverflowPolicy::Block, createDispatchFunction());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for (int i = 0; i < 250; ++i)
+                    log(dispatcher, std::to_string(t));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        dispatcher.flush();
+
+        EXPECT_EQ(1000u, getDispatchedMessages().size());
+        EXPECT_EQ(0u, dispatcher.getDroppedMessageCount());
+    }
+}
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Utils/LogMacros.h"
+#include "Utils/RamsesLogger.h"
 #include "gtest/gtest.h"
 
 namespace ramses_internal
@@ -40,6 +41,18 @@ namespace ramses_internal
         }));
         LOG_INFO_PF(CONTEXT_FRAMEWORK, ([&](auto& out) { fmt::format_to(out, "Foo {} {}", 123, 456.f); }));
     }
+
+    TEST(ALogMacro, canLogAsynchronously)
+    {
+        RamsesLogger& logger = GetRamsesLogger();
+        logger.enableAsyncLogging(64u, EAsyncLogOverflowPolicy::Block);
+        EXPECT_TRUE(logger.isAsyncLoggingEnabled());
+        for (int i = 0; i < 100; ++i)
+            LOG_INFO(CONTEXT_FRAMEWORK, "Foo " << i);
+        logger.disableAsyncLogging();
+        EXPECT_FALSE(logger.isAsyncLoggingEnabled());
+        EXPECT_EQ(0u, logger.getDroppedLogMessageCount());
+    }
 }
 
 namespace ramses
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class AMemoryMappedFile : public testing::Test
+    {
+    public:
+        AMemoryMappedFile()
+            : m_file("TestMappedFile.bin")
+        {
+            EXPECT_TRUE(m_file.open(File::Mode::WriteNewBinary));
+            EXPECT_TRUE(m_file.write(m_content.data(), m_content.size()));
+            m_file.close();
+        }
+
+        ~AMemoryMappedFile()
+        {
+            m_file.close();
+            m_file.remove();
+        }
+
+    protected:
+        const std::vector<Byte> m_content{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        File m_file;
+    };
+
+    TEST_F(AMemoryMappedFile, mapsWholeFileContent)
+    {
+        MemoryMappedFile mappedFile(m_file.getPath());
+        ASSERT_TRUE(mappedFile.isMapped());
+        ASSERT_EQ(m_content.size(), mappedFile.size());
+        EXPECT_EQ(m_content, std::vector<Byte>(mappedFile.data(), mappedFile.data() + mappedFile.size()));
+    }
+
+    TEST_F(AMemoryMappedFile, isNotMappedIfFileDoesNotExist)
+    {
+        MemoryMappedFile mappedFile("some/non/existing/path");
+        EXPECT_FALSE(mappedFile.isMapped());
+        EXPECT_EQ(nullptr, mappedFile.data());
+        EXPECT_EQ(0u, mappedFile.size());
+    }
+
+    TEST_F(AMemoryMappedFile, isNotMappedIfFileIsEmpty)
+    {
+        File emptyFile("TestEmptyMappedFile.bin");
+        ASSERT_TRUE(emptyFile.createFile());
+
+        {
+            MemoryMappedFile mappedFile(emptyFile.getPath());
+            EXPECT_FALSE(mappedFile.isMapped());
+        }
+
+        emptyFile.remove();
+    }
+}
@@ -0,0 +1,75 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/RawBinaryInputStream.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Collections/String.h"
+#include "gtest/gtest.h"
+
+namespace ramses_internal
+{
+    TEST(ARawBinaryInputStream, hasExpectedDefaultValues)
+    {
+        const std::vector<Byte> buffer(10);
+        RawBinaryInputStream is(buffer.data(), buffer.size());
+
+        EXPECT_EQ(EStatus::Ok, is.getState());
+        EXPECT_EQ(0u, is.getBytesRead());
+        EXPECT_EQ(10u, is.getSize());
+    }
+
+    TEST(ARawBinaryInputStream, canReadWrittenData)
+    {
+        BinaryOutputStream os;
+        os << 123u << 1.5f << String("foo") << static_cast<uint16_t>(7u);
+
+        RawBinaryInputStream is(os.getData(), os.getSize());
+        uint32_t u32 = 0u;
+        float f = 0.f;
+        String str;
+        uint16_t u16 = 0u;
+        is >> u32 >> f >> str >> u16;
+
+        EXPECT_EQ(123u, u32);
+        EXPECT_EQ(1.5f, f);
+        EXPECT_EQ(String("foo"), str);
+        EXPECT_EQ(7u, u16);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+        EXPECT_EQ(os.getSize(), is.getBytesRead());
+    }
+
+    TEST(ARawBinaryInputStream, canDoZeroReadFromEmptyMemory)
+    {
+        RawBinaryInputStream is(nullptr, 0u);
+        is.read(nullptr, 0u);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+        EXPECT_EQ(0u, is.getBytesRead());
+    }
+
+    TEST(ARawBinaryInputStream, failsReadBeyondEndWithoutTouchingTarget)
+    {
+        const std::vector<Byte> buffer = { 1u, 2u, 3u, 4u, 5u, 6u };
+        RawBinaryInputStream is(buffer.data(), buffer.size());
+
+        uint32_t u32 = 0u;
+        is >> u32;
+        EXPECT_EQ(EStatus::Ok, is.getState());
+
+        uint32_t notRead = 42u;
+        is >> notRead;
+        EXPECT_EQ(EStatus::Eof, is.getState());
+        EXPECT_EQ(42u, notRead);
+        EXPECT_EQ(4u, is.getBytesRead());
+
+        // stays in error state, even for data which would still fit
+        uint16_t u16 = 42u;
+        is >> u16;
+        EXPECT_EQ(EStatus::Eof, is.getState());
+        EXPECT_EQ(42u, u16);
+    }
+}
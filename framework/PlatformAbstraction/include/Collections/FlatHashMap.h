@@ -0,0 +1,682 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_COLLECTIONS_FLATHASHMAP_H
+#define RAMSES_COLLECTIONS_FLATHASHMAP_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformError.h"
+#include "PlatformAbstraction/Macros.h"
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <cassert>
+#include <cstring>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSES_FLATHASHMAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ramses_internal
+{
+    namespace internal
+    {
+        // every slot of FlatHashMap has one control byte, either one of the special values below
+        // or (for used slots) the lowest 7 bits of hash of stored key
+        namespace FlatHashMapCtrl
+        {
+            constexpr int8_t Empty = -128;
+            constexpr int8_t Deleted = -2;
+            constexpr int8_t Sentinel = -1; // marks end of control bytes for iteration
+        }
+
+        inline uint32_t LowestSetBitIndex(uint32_t mask)
+        {
+            assert(mask != 0u);
+#if defined(_MSC_VER)
+            unsigned long idx = 0;
+            _BitScanForward(&idx, mask);
+            return static_cast<uint32_t>(idx);
+#else
+            return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+        }
+
+        // control bytes of a group of slots which are compared at once, returned masks have bit i set for matching slot i
+        class FlatHashMapGroup
+        {
+        public:
+            static constexpr size_t Width = 16u;
+
+            explicit FlatHashMapGroup(const int8_t* ctrl)
+#if defined(RAMSES_FLATHASHMAP_SSE2)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+#else
+                : m_ctrl(ctrl)
+#endif
+            {
+            }
+
+            uint32_t match(int8_t hashBits) const
+            {
+#if defined(RAMSES_FLATHASHMAP_SSE2)
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_ctrl, _mm_set1_epi8(hashBits))));
+#else
+                uint32_t mask = 0u;
+                for (uint32_t i = 0u; i < Width; ++i)
+                    mask |= static_cast<uint32_t>(m_ctrl[i] == hashBits) << i;
+                return mask;
+#endif
+            }
+
+            uint32_t matchEmpty() const
+            {
+                return match(FlatHashMapCtrl::Empty);
+            }
+
+            uint32_t matchEmptyOrDeleted() const
+            {
+#if defined(RAMSES_FLATHASHMAP_SSE2)
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(m_ctrl, _mm_set1_epi8(FlatHashMapCtrl::Sentinel))));
+#else
+                uint32_t mask = 0u;
+                for (uint32_t i = 0u; i < Width; ++i)
+                    mask |= static_cast<uint32_t>(m_ctrl[i] < FlatHashMapCtrl::Sentinel) << i;
+                return mask;
+#endif
+            }
+
+        private:
+#if defined(RAMSES_FLATHASHMAP_SSE2)
+            __m128i m_ctrl;
+#else
+            const int8_t* m_ctrl;
+#endif
+        };
+    }
+
+    /**
+     * Hash map storing its entries inline in one flat array (open addressing) instead of chaining entries.
+     * Slots are probed in groups of 16 which are compared against a 7 bit hash fragment at once,
+     * so that lookups touch very few cache lines and rarely have to compare keys which do not match.
+     *
+     * Interface is compatible with HashMap, but unlike HashMap iteration order is unspecified
+     * and every insertion may invalidate iterators and pointers to values.
+     */
+    template <class Key, class T>
+    class FlatHashMap final
+    {
+    public:
+        class Pair
+        {
+        public:
+            Pair(const Key& key_, const T& value_)
+                : key(key_)
+                , value(value_)
+            {
+            }
+
+            Pair(const Key& key_, T&& value_)
+                : key(key_)
+                , value(std::move(value_))
+            {
+            }
+
+            const Key key;
+            T value;
+        };
+
+        template <typename PairType>
+        class IteratorT
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Pair;
+            using difference_type = std::ptrdiff_t;
+            using pointer = PairType*;
+            using reference = PairType&;
+
+            IteratorT(const int8_t* ctrl, PairType* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+            }
+
+            // conversion from non-const to const iterator
+            template <typename OtherPairType>
+            IteratorT(const IteratorT<OtherPairType>& other)  // NOLINT(google-explicit-constructor) non-const to const iterator should be implicit
+                : m_ctrl(other.m_ctrl)
+                , m_slot(other.m_slot)
+            {
+            }
+
+            PairType& operator*() const
+            {
+                return *m_slot;
+            }
+
+            PairType* operator->() const
+            {
+                return m_slot;
+            }
+
+            bool operator==(const IteratorT& other) const
+            {
+                return m_slot == other.m_slot;
+            }
+
+            bool operator!=(const IteratorT& other) const
+            {
+                return m_slot != other.m_slot;
+            }
+
+            IteratorT& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skipUnusedSlots();
+                return *this;
+            }
+
+            IteratorT operator++(int)
+            {
+                IteratorT oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            template <typename> friend class IteratorT;
+            friend class FlatHashMap;
+
+            void skipUnusedSlots()
+            {
+                // empty and deleted are smaller than sentinel, used slots are not negative
+                while (*m_ctrl < internal::FlatHashMapCtrl::Sentinel)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const int8_t* m_ctrl;
+            PairType* m_slot;
+        };
+
+        using Iterator = IteratorT<Pair>;
+        using ConstIterator = IteratorT<const Pair>;
+
+        FlatHashMap() = default;
+        explicit FlatHashMap(size_t capacity);
+        FlatHashMap(const FlatHashMap& other);
+        FlatHashMap(FlatHashMap&& other) noexcept;
+        ~FlatHashMap();
+
+        FlatHashMap& operator=(const FlatHashMap& other);
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+
+        /**
+         * Returns value stored for key, a default constructed value is added if key is not in map yet.
+         */
+        T& operator[](const Key& key);
+
+        /**
+         * Adds or overwrites value for key.
+         * @return iterator to stored entry
+         */
+        Iterator put(const Key& key, const T& value);
+
+        EStatus get(const Key& key, T& value) const;
+        RNODISCARD T* get(const Key& key) const;
+
+        RNODISCARD Iterator find(const Key& key);
+        RNODISCARD ConstIterator find(const Key& key) const;
+        RNODISCARD bool contains(const Key& key) const;
+
+        /**
+         * Removes entry with given key.
+         * @param value_old optional buffer to receive value of removed entry
+         * @return true if entry was found and removed
+         */
+        bool remove(const Key& key, T* value_old = nullptr);
+
+        /**
+         * Removes entry iterator points to, other iterators stay valid.
+         * @return iterator to entry following the removed one
+         */
+        Iterator remove(Iterator iter, T* value_old = nullptr);
+
+        RNODISCARD size_t size() const;
+        void clear();
+
+        RNODISCARD Iterator begin();
+        RNODISCARD ConstIterator begin() const;
+        RNODISCARD Iterator end();
+        RNODISCARD ConstIterator end() const;
+
+        /**
+         * Makes sure given number of entries can be stored without rehashing.
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * Number of entries which can be stored without rehashing.
+         */
+        RNODISCARD size_t capacity() const;
+
+        void swap(FlatHashMap& other);
+
+    private:
+        using Group = internal::FlatHashMapGroup;
+
+        static size_t HashKey(const Key& key);
+        static int8_t HashBits(size_t hash);
+        static size_t MaxLoad(size_t slotCount);
+        static size_t SlotCountForCapacity(size_t capacity);
+
+        size_t findSlot(const Key& key) const;
+        size_t findFreeSlot(size_t hash) const;
+        size_t insertNew(const Key& key, T&& value);
+        void eraseSlot(size_t slot);
+        void resize(size_t slotCount);
+        void destructAll();
+
+        int8_t* m_ctrl = nullptr;   // slot count + 1 control bytes, last is sentinel
+        Pair* m_slots = nullptr;    // uninitialized memory for slot count entries
+        size_t m_slotCount = 0u;    // 0 or power of two, multiple of group width
+        size_t m_size = 0u;
+        size_t m_growthLeft = 0u;   // number of empty slots which may still be used before rehash
+    };
+
+    template <class Key, class T>
+    inline void swap(FlatHashMap<Key, T>& first, FlatHashMap<Key, T>& second)
+    {
+        first.swap(second);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::FlatHashMap(size_t capacity)
+    {
+        reserve(capacity);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::FlatHashMap(const FlatHashMap& other)
+    {
+        reserve(other.size());
+        for (const auto& entry : other)
+            insertNew(entry.key, T(entry.value));
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::FlatHashMap(FlatHashMap&& other) noexcept
+    {
+        swap(other);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::~FlatHashMap()
+    {
+        destructAll();
+        delete[] m_ctrl;
+        ::operator delete(m_slots);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>& FlatHashMap<Key, T>::operator=(const FlatHashMap& other)
+    {
+        if (&other != this)
+        {
+            FlatHashMap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>& FlatHashMap<Key, T>::operator=(FlatHashMap&& other) noexcept
+    {
+        if (&other != this)
+        {
+            swap(other);
+            other.clear();
+        }
+        return *this;
+    }
+
+    template <class Key, class T>
+    inline T& FlatHashMap<Key, T>::operator[](const Key& key)
+    {
+        size_t slot = findSlot(key);
+        if (slot == m_slotCount)
+            slot = insertNew(key, T());
+        return m_slots[slot].value;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::put(const Key& key, const T& value)
+    {
+        size_t slot = findSlot(key);
+        if (slot == m_slotCount)
+            slot = insertNew(key, T(value));
+        else
+            m_slots[slot].value = value;
+        return Iterator(m_ctrl + slot, m_slots + slot);
+    }
+
+    template <class Key, class T>
+    inline EStatus FlatHashMap<Key, T>::get(const Key& key, T& value) const
+    {
+        const size_t slot = findSlot(key);
+        if (slot == m_slotCount)
+            return EStatus::NotExist;
+        value = m_slots[slot].value;
+        return EStatus::Ok;
+    }
+
+    template <class Key, class T>
+    inline T* FlatHashMap<Key, T>::get(const Key& key) const
+    {
+        const size_t slot = findSlot(key);
+        if (slot == m_slotCount)
+            return nullptr;
+        return &m_slots[slot].value;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::find(const Key& key)
+    {
+        const size_t slot = findSlot(key);
+        return Iterator(m_ctrl + slot, m_slots + slot);
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::find(const Key& key) const
+    {
+        const size_t slot = findSlot(key);
+        return ConstIterator(m_ctrl + slot, m_slots + slot);
+    }
+
+    template <class Key, class T>
+    inline bool FlatHashMap<Key, T>::contains(const Key& key) const
+    {
+        return findSlot(key) != m_slotCount;
+    }
+
+    template <class Key, class T>
+    inline bool FlatHashMap<Key, T>::remove(const Key& key, T* value_old)
+    {
+        const size_t slot = findSlot(key);
+        if (slot == m_slotCount)
+            return false;
+        if (value_old)
+            *value_old = std::move(m_slots[slot].value);
+        eraseSlot(slot);
+        return true;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::remove(Iterator iter, T* value_old)
+    {
+        assert(iter != end());
+        if (value_old)
+            *value_old = std::move(iter->value);
+        eraseSlot(static_cast<size_t>(iter.m_slot - m_slots));
+        return ++iter;
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::size() const
+    {
+        return m_size;
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::clear()
+    {
+        if (m_size == 0u)
+            return;
+        destructAll();
+        std::memset(m_ctrl, internal::FlatHashMapCtrl::Empty, m_slotCount);
+        m_size = 0u;
+        m_growthLeft = MaxLoad(m_slotCount);
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::begin()
+    {
+        if (m_size == 0u)
+            return end();
+        Iterator it(m_ctrl, m_slots);
+        it.skipUnusedSlots();
+        return it;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::begin() const
+    {
+        if (m_size == 0u)
+            return end();
+        ConstIterator it(m_ctrl, m_slots);
+        it.skipUnusedSlots();
+        return it;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::end()
+    {
+        return Iterator(m_ctrl + m_slotCount, m_slots + m_slotCount);
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::end() const
+    {
+        return ConstIterator(m_ctrl + m_slotCount, m_slots + m_slotCount);
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::reserve(size_t capacity)
+    {
+        const size_t slotCount = SlotCountForCapacity(capacity);
+        if (slotCount > m_slotCount)
+            resize(slotCount);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::capacity() const
+    {
+        return MaxLoad(m_slotCount);
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::swap(FlatHashMap& other)
+    {
+        std::swap(m_ctrl, other.m_ctrl);
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_slotCount, other.m_slotCount);
+        std::swap(m_size, other.m_size);
+        std::swap(m_growthLeft, other.m_growthLeft);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::HashKey(const Key& key)
+    {
+        // std::hash is identity for many key types (e.g. handles), mix bits so that both
+        // group index (upper bits) and hash fragment in control byte (lowest 7 bits) are well distributed
+        uint64_t hash = static_cast<uint64_t>(std::hash<Key>()(key));
+        hash ^= hash >> 33u;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33u;
+        return static_cast<size_t>(hash);
+    }
+
+    template <class Key, class T>
+    inline int8_t FlatHashMap<Key, T>::HashBits(size_t hash)
+    {
+        return static_cast<int8_t>(hash & 0x7fu);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::MaxLoad(size_t slotCount)
+    {
+        // at most 7/8 of slots are used, so that probing always finds empty slot quickly
+        return slotCount - slotCount / 8u;
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::SlotCountForCapacity(size_t capacity)
+    {
+        if (capacity == 0u)
+            return 0u;
+        size_t slotCount = Group::Width;
+        while (MaxLoad(slotCount) < capacity)
+            slotCount *= 2u;
+        return slotCount;
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::findSlot(const Key& key) const
+    {
+        if (m_size == 0u)
+            return m_slotCount;
+
+        const size_t hash = HashKey(key);
+        const int8_t hashBits = HashBits(hash);
+        const size_t groupMask = m_slotCount / Group::Width - 1u;
+        size_t groupIdx = (hash >> 7u) & groupMask;
+        // triangular probing visits every group once because group count is power of two
+        for (size_t step = 1u; ; ++step)
+        {
+            const size_t groupOffset = groupIdx * Group::Width;
+            const Group group(m_ctrl + groupOffset);
+            for (uint32_t mask = group.match(hashBits); mask != 0u; mask &= mask - 1u)
+            {
+                const size_t slot = groupOffset + internal::LowestSetBitIndex(mask);
+                if (m_slots[slot].key == key)
+                    return slot;
+            }
+            // key would have been stored in this group if it was in map
+            if (group.matchEmpty() != 0u)
+                return m_slotCount;
+            groupIdx = (groupIdx + step) & groupMask;
+        }
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::findFreeSlot(size_t hash) const
+    {
+        const size_t groupMask = m_slotCount / Group::Width - 1u;
+        size_t groupIdx = (hash >> 7u) & groupMask;
+        for (size_t step = 1u; ; ++step)
+        {
+            const size_t groupOffset = groupIdx * Group::Width;
+            const uint32_t mask = Group(m_ctrl + groupOffset).matchEmptyOrDeleted();
+            if (mask != 0u)
+                return groupOffset + internal::LowestSetBitIndex(mask);
+            groupIdx = (groupIdx + step) & groupMask;
+        }
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::insertNew(const Key& key, T&& value)
+    {
+        if (m_growthLeft == 0u)
+        {
+            // many deleted slots: rehash in place to get rid of them, otherwise grow
+            if (m_slotCount == 0u)
+                resize(Group::Width);
+            else if (m_size * 2u <= MaxLoad(m_slotCount))
+                resize(m_slotCount);
+            else
+                resize(m_slotCount * 2u);
+        }
+
+        const size_t hash = HashKey(key);
+        const size_t slot = findFreeSlot(hash);
+        if (m_ctrl[slot] == internal::FlatHashMapCtrl::Empty)
+            --m_growthLeft;
+        m_ctrl[slot] = HashBits(hash);
+        new (m_slots + slot) Pair(key, std::move(value));
+        ++m_size;
+        return slot;
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::eraseSlot(size_t slot)
+    {
+        m_slots[slot].~Pair();
+        --m_size;
+
+        // a probe for other key continues after a group only if the group had no empty slot, so if this group has one
+        // no probe can pass through it and slot can become empty again, otherwise it must be marked as deleted
+        const size_t groupOffset = slot & ~(Group::Width - 1u);
+        if (Group(m_ctrl + groupOffset).matchEmpty() != 0u)
+        {
+            m_ctrl[slot] = internal::FlatHashMapCtrl::Empty;
+            ++m_growthLeft;
+        }
+        else
+        {
+            m_ctrl[slot] = internal::FlatHashMapCtrl::Deleted;
+        }
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::resize(size_t slotCount)
+    {
+        static_assert(alignof(Pair) <= alignof(std::max_align_t), "FlatHashMap does not support over-aligned types");
+
+        int8_t* oldCtrl = m_ctrl;
+        Pair* oldSlots = m_slots;
+        const size_t oldSlotCount = m_slotCount;
+
+        m_ctrl = new int8_t[slotCount + 1u];
+        std::memset(m_ctrl, internal::FlatHashMapCtrl::Empty, slotCount);
+        m_ctrl[slotCount] = internal::FlatHashMapCtrl::Sentinel;
+        m_slots = static_cast<Pair*>(::operator new(slotCount * sizeof(Pair)));
+        m_slotCount = slotCount;
+        m_growthLeft = MaxLoad(slotCount) - m_size;
+
+        for (size_t i = 0u; i < oldSlotCount; ++i)
+        {
+            if (oldCtrl[i] >= 0)
+            {
+                Pair& oldEntry = oldSlots[i];
+                const size_t hash = HashKey(oldEntry.key);
+                const size_t slot = findFreeSlot(hash);
+                m_ctrl[slot] = HashBits(hash);
+                new (m_slots + slot) Pair(oldEntry.key, std::move(oldEntry.value));
+                oldEntry.~Pair();
+            }
+        }
+
+        delete[] oldCtrl;
+        ::operator delete(oldSlots);
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::destructAll()
+    {
+        if (m_size == 0u)
+            return;
+        for (size_t i = 0u; i < m_slotCount; ++i)
+        {
+            if (m_ctrl[i] >= 0)
+                m_slots[i].~Pair();
+        }
+    }
+}
+
+#endif
@@ -25,6 +25,8 @@ namespace ramses_internal
     public:
         explicit HeapArray(UInt size = 0, const T* data = nullptr);
         HeapArray(UInt size, HeapArray&& other);
+        // references external memory instead of owning a copy of it, owner keeps memory alive for lifetime of array
+        HeapArray(UInt size, T* externalData, std::shared_ptr<const void> externalOwner);
 
         HeapArray(const HeapArray&) = delete;
         HeapArray& operator=(const HeapArray&) = delete;
@@ -36,23 +38,27 @@ namespace ramses_internal
         RNODISCARD T* data();
         RNODISCARD const T* data() const;
         RNODISCARD absl::Span<const T> span() const;
+        RNODISCARD bool isExternal() const;
 
         void setZero();
 
     private:
         UInt m_size;
-        std::unique_ptr<T[]> m_data;
+        std::unique_ptr<T[]> m_ownedData;
+        std::shared_ptr<const void> m_externalOwner;
+        T* m_data;
     };
 
     template <typename T, typename _uniqueId>
     inline
     HeapArray<T, _uniqueId>::HeapArray(UInt size, const T* data)
         : m_size(size)
-        , m_data(m_size > 0 ? new T[m_size] : nullptr)
+        , m_ownedData(m_size > 0 ? new T[m_size] : nullptr)
+        , m_data(m_ownedData.get())
     {
         if (m_data && data)
         {
-            PlatformMemory::Copy(m_data.get(), data, size * sizeof(T));
+            PlatformMemory::Copy(m_data, data, size * sizeof(T));
         }
     }
 
@@ -60,20 +66,35 @@ namespace ramses_internal
     inline
     HeapArray<T, _uniqueId>::HeapArray(UInt size, HeapArray&& other)
         : m_size(size)
-        , m_data(std::move(other.m_data))
+        , m_ownedData(std::move(other.m_ownedData))
+        , m_externalOwner(std::move(other.m_externalOwner))
+        , m_data(other.m_data)
     {
         static_assert(std::is_nothrow_move_constructible<HeapArray>::value, "HeapArray must be movable");
         other.m_size = 0;
+        other.m_data = nullptr;
+    }
+
+    template <typename T, typename _uniqueId>
+    inline
+    HeapArray<T, _uniqueId>::HeapArray(UInt size, T* externalData, std::shared_ptr<const void> externalOwner)
+        : m_size(size)
+        , m_externalOwner(std::move(externalOwner))
+        , m_data(externalData)
+    {
     }
 
     template <typename T, typename _uniqueId>
     inline
     HeapArray<T, _uniqueId>::HeapArray(HeapArray&& o) noexcept
         : m_size(o.m_size)
-        , m_data(std::move(o.m_data))
+        , m_ownedData(std::move(o.m_ownedData))
+        , m_externalOwner(std::move(o.m_externalOwner))
+        , m_data(o.m_data)
     {
         static_assert(std::is_nothrow_move_assignable<HeapArray>::value, "HeapArray must be movable");
         o.m_size = 0;
+        o.m_data = nullptr;
     }
 
     template <typename T, typename _uniqueId>
@@ -83,8 +104,11 @@ namespace ramses_internal
         if (&o != this)
         {
             m_size = o.m_size;
-            m_data = std::move(o.m_data);
+            m_ownedData = std::move(o.m_ownedData);
+            m_externalOwner = std::move(o.m_externalOwner);
+            m_data = o.m_data;
             o.m_size = 0;
+            o.m_data = nullptr;
         }
         return *this;
     }
@@ -100,21 +124,28 @@ namespace ramses_internal
     inline
     T* HeapArray<T, _uniqueId>::data()
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename _uniqueId>
     inline
     const T* HeapArray<T, _uniqueId>::data() const
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename _uniqueId>
     inline
     absl::Span<const T> HeapArray<T, _uniqueId>::span() const
     {
-        return {m_data.get(), m_size};
+        return {m_data, m_size};
+    }
+
+    template <typename T, typename _uniqueId>
+    inline
+    bool HeapArray<T, _uniqueId>::isExternal() const
+    {
+        return m_externalOwner != nullptr;
     }
 
     template <typename T, typename _uniqueId>
@@ -123,7 +154,7 @@ namespace ramses_internal
     {
         if (m_data)
         {
-            PlatformMemory::Set(m_data.get(), 0, m_size * sizeof(T));
+            PlatformMemory::Set(m_data, 0, m_size * sizeof(T));
         }
     }
 }
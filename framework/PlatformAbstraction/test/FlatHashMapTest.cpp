@@ -0,0 +1,304 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Collections/FlatHashMap.h"
+#include "ComplexTestType.h"
+#include "gtest/gtest.h"
+#include <unordered_map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ramses_internal
+{
+    using RCKey = ComplexTestType<struct FlatKeyTag>;
+    using RCValue = ComplexTestType<struct FlatValueTag>;
+
+    class AFlatHashMap : public ::testing::Test
+    {
+    public:
+        AFlatHashMap()
+        {
+            RCKey::Reset();
+            RCValue::Reset();
+        }
+
+        void expectRefCnt(int32_t refCnt)
+        {
+            EXPECT_EQ(refCnt, RCKey::RefCnt());
+            EXPECT_EQ(refCnt, RCValue::RefCnt());
+        }
+    };
+
+    TEST_F(AFlatHashMap, isEmptyWithoutAllocationWhenDefaultConstructed)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(0u, map.capacity());
+        EXPECT_TRUE(map.begin() == map.end());
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_EQ(nullptr, map.get(1));
+        EXPECT_TRUE(map.find(1) == map.end());
+        EXPECT_FALSE(map.remove(1));
+    }
+
+    TEST_F(AFlatHashMap, putsAndGetsValues)
+    {
+        FlatHashMap<int32_t, std::string> map;
+        map.put(1, "one");
+        map.put(2, "two");
+
+        EXPECT_EQ(2u, map.size());
+        ASSERT_NE(nullptr, map.get(1));
+        EXPECT_EQ("one", *map.get(1));
+        std::string value;
+        EXPECT_EQ(EStatus::Ok, map.get(2, value));
+        EXPECT_EQ("two", value);
+        EXPECT_EQ(EStatus::NotExist, map.get(3, value));
+        EXPECT_EQ("two", value);
+    }
+
+    TEST_F(AFlatHashMap, putOverwritesValueOfExistingKey)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        map.put(1, 10);
+        auto it = map.put(1, 11);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(1, it->key);
+        EXPECT_EQ(11, it->value);
+        EXPECT_EQ(11, map[1]);
+    }
+
+    TEST_F(AFlatHashMap, subscriptOperatorAddsDefaultValueIfKeyNotContained)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        EXPECT_EQ(0, map[5]);
+        map[5] = 6;
+        ++map[5];
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(7, *map.get(5));
+    }
+
+    TEST_F(AFlatHashMap, removesByKeyAndReturnsOldValue)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        map.put(1, 10);
+        map.put(2, 20);
+
+        int32_t oldValue = 0;
+        EXPECT_TRUE(map.remove(1, &oldValue));
+        EXPECT_EQ(10, oldValue);
+        EXPECT_FALSE(map.remove(1));
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_TRUE(map.contains(2));
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, removesWhileIterating)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        for (int32_t i = 0; i < 100; ++i)
+            map.put(i, i * 10);
+
+        auto it = map.begin();
+        while (it != map.end())
+        {
+            if (it->key % 2 == 0)
+                it = map.remove(it);
+            else
+                ++it;
+        }
+
+        EXPECT_EQ(50u, map.size());
+        for (int32_t i = 0; i < 100; ++i)
+            EXPECT_EQ(i % 2 != 0, map.contains(i));
+    }
+
+    TEST_F(AFlatHashMap, iteratesAllEntriesOnce)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            map.put(i, i + 1u);
+
+        std::vector<uint32_t> visited(1000u, 0u);
+        const auto& constMap = map;
+        for (const auto& entry : constMap)
+        {
+            EXPECT_EQ(entry.key + 1u, entry.value);
+            ++visited[entry.key];
+        }
+        for (auto count : visited)
+            EXPECT_EQ(1u, count);
+    }
+
+    TEST_F(AFlatHashMap, canModifyValuesViaIterator)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        map.put(1, 1);
+        map.put(2, 2);
+        for (auto& entry : map)
+            entry.value *= 10;
+        EXPECT_EQ(10, map[1]);
+        EXPECT_EQ(20, map[2]);
+
+        FlatHashMap<int32_t, int32_t>::ConstIterator constIt = map.find(2);
+        EXPECT_EQ(20, constIt->value);
+    }
+
+    TEST_F(AFlatHashMap, keepsAllEntriesWhenGrowing)
+    {
+        FlatHashMap<uint64_t, uint64_t> map;
+        for (uint64_t i = 0u; i < 10000u; ++i)
+            map.put(i * 7919u, i);
+
+        EXPECT_EQ(10000u, map.size());
+        EXPECT_GE(map.capacity(), map.size());
+        for (uint64_t i = 0u; i < 10000u; ++i)
+            EXPECT_EQ(i, *map.get(i * 7919u));
+        EXPECT_FALSE(map.contains(1u));
+    }
+
+    TEST_F(AFlatHashMap, doesNotGrowWhenReservedToCapacity)
+    {
+        FlatHashMap<int32_t, int32_t> map(100u);
+        const size_t capacity = map.capacity();
+        EXPECT_GE(capacity, 100u);
+        for (int32_t i = 0; i < 100; ++i)
+            map.put(i, i);
+        EXPECT_EQ(capacity, map.capacity());
+
+        map.reserve(10u);
+        EXPECT_EQ(capacity, map.capacity());
+    }
+
+    TEST_F(AFlatHashMap, doesNotGrowWhenRepeatedlyAddingAndRemovingEntries)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        for (int32_t i = 0; i < 10; ++i)
+            map.put(i, i);
+        const size_t capacity = map.capacity();
+
+        // deleted slots get reused by rehashing in place
+        for (int32_t i = 10; i < 10000; ++i)
+        {
+            map.put(i, i);
+            EXPECT_TRUE(map.remove(i - 10));
+        }
+        EXPECT_EQ(10u, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+        for (int32_t i = 9990; i < 10000; ++i)
+            EXPECT_TRUE(map.contains(i));
+    }
+
+    TEST_F(AFlatHashMap, behavesLikeStdUnorderedMapForRandomOperations)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        std::unordered_map<uint32_t, uint32_t> reference;
+        std::mt19937 gen(42u);
+        std::uniform_int_distribution<uint32_t> keyDist(0u, 2000u);
+
+        for (uint32_t i = 0u; i < 50000u; ++i)
+        {
+            const uint32_t key = keyDist(gen);
+            if (gen() % 3u == 0u)
+            {
+                EXPECT_EQ(reference.erase(key) == 1u, map.remove(key));
+            }
+            else
+            {
+                map.put(key, i);
+                reference[key] = i;
+            }
+        }
+
+        EXPECT_EQ(reference.size(), map.size());
+        for (const auto& entry : reference)
+        {
+            ASSERT_TRUE(map.contains(entry.first));
+            EXPECT_EQ(entry.second, *map.get(entry.first));
+        }
+    }
+
+    TEST_F(AFlatHashMap, copiesAndMoves)
+    {
+        FlatHashMap<int32_t, int32_t> map;
+        map.put(1, 10);
+        map.put(2, 20);
+
+        FlatHashMap<int32_t, int32_t> copy(map);
+        map.put(3, 30);
+        EXPECT_EQ(2u, copy.size());
+        EXPECT_EQ(20, copy[2]);
+
+        copy = map;
+        EXPECT_EQ(3u, copy.size());
+
+        FlatHashMap<int32_t, int32_t> moved(std::move(copy));
+        EXPECT_EQ(3u, moved.size());
+        EXPECT_EQ(30, moved[3]);
+
+        FlatHashMap<int32_t, int32_t> moveAssigned;
+        moveAssigned = std::move(moved);
+        EXPECT_EQ(3u, moveAssigned.size());
+        EXPECT_EQ(10, moveAssigned[1]);
+    }
+
+    TEST_F(AFlatHashMap, swapsContent)
+    {
+        FlatHashMap<int32_t, int32_t> map1;
+        map1.put(1, 10);
+        FlatHashMap<int32_t, int32_t> map2;
+        map2.put(2, 20);
+        map2.put(3, 30);
+
+        swap(map1, map2);
+        EXPECT_EQ(2u, map1.size());
+        EXPECT_TRUE(map1.contains(3));
+        EXPECT_EQ(1u, map2.size());
+        EXPECT_TRUE(map2.contains(1));
+    }
+
+    TEST_F(AFlatHashMap, clearDestructsAllElementsAndKeepsCapacity)
+    {
+        {
+            FlatHashMap<RCKey, RCValue> map;
+            for (size_t i = 0u; i < 100u; ++i)
+                map.put(RCKey(i), RCValue(i));
+            expectRefCnt(100);
+
+            const size_t capacity = map.capacity();
+            map.clear();
+            expectRefCnt(0);
+            EXPECT_EQ(0u, map.size());
+            EXPECT_EQ(capacity, map.capacity());
+            EXPECT_TRUE(map.begin() == map.end());
+
+            map.put(RCKey(1u), RCValue(2u));
+            EXPECT_EQ(2u, map[RCKey(1u)].value);
+        }
+        expectRefCnt(0);
+    }
+
+    TEST_F(AFlatHashMap, destructsElementsOnRemoveRehashAndDestruction)
+    {
+        {
+            FlatHashMap<RCKey, RCValue> map;
+            for (size_t i = 0u; i < 1000u; ++i)
+                map.put(RCKey(i), RCValue(i));
+            expectRefCnt(1000);
+
+            for (size_t i = 0u; i < 500u; ++i)
+                EXPECT_TRUE(map.remove(RCKey(i)));
+            expectRefCnt(500);
+
+            FlatHashMap<RCKey, RCValue> copy = map;
+            expectRefCnt(1000);
+        }
+        expectRefCnt(0);
+    }
+}
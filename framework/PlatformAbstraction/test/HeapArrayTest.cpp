@@ -8,6 +8,8 @@
 
 #include "Collections/HeapArray.h"
 #include "gtest/gtest.h"
+#include <memory>
+#include <vector>
 
 
 namespace ramses_internal
@@ -100,6 +102,36 @@ namespace ramses_internal
         EXPECT_EQ(2u, b.size());
     }
 
+    TYPED_TEST(AHeapArray, canReferenceExternalMemoryAndKeepItsOwnerAlive)
+    {
+        auto owner = std::make_shared<std::vector<TypeParam>>(std::vector<TypeParam>{ 1, 2, 3, 4 });
+        HeapArray<TypeParam> a(3, owner->data() + 1, owner);
+        EXPECT_TRUE(a.isExternal());
+        EXPECT_EQ(owner->data() + 1, a.data());
+
+        std::weak_ptr<std::vector<TypeParam>> weakOwner = owner;
+        owner.reset();
+        HeapArray<TypeParam> b;
+        b = std::move(a);
+        EXPECT_FALSE(a.isExternal());
+        EXPECT_EQ(nullptr, a.data());
+        EXPECT_FALSE(weakOwner.expired());
+        const TypeParam expected[3] = { 2, 3, 4 };
+        EXPECT_EQ(absl::MakeSpan(expected), b.span());
+
+        HeapArray<TypeParam> c(std::move(b));
+        EXPECT_TRUE(c.isExternal());
+        EXPECT_EQ(absl::MakeSpan(expected), c.span());
+        c = HeapArray<TypeParam>();
+        EXPECT_TRUE(weakOwner.expired());
+    }
+
+    TYPED_TEST(AHeapArray, doesNotReferenceExternalMemoryWhenOwningData)
+    {
+        HeapArray<TypeParam> a(4);
+        EXPECT_FALSE(a.isExternal());
+    }
+
     TYPED_TEST(AHeapArray, canGetAsSpan)
     {
         TypeParam data[4] = {1, 2, 3, 4};
@@ -22,8 +22,13 @@ namespace ramses_internal
             High
         };
 
+        // data larger than chunk size is compressed as independent chunks (in parallel),
+        // chunked and plain single block data are both recognized when decompressing
+        static constexpr uint32_t ChunkSize = 256u * 1024u;
+
         CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level);
         ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize);
+        bool isChunked(const CompressedResourceBlob& compressedData);
     }
 }
 #endif
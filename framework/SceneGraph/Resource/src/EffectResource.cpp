@@ -127,7 +127,7 @@ namespace ramses_internal
 
     void EffectResource::ReadInputVector(IInputStream& stream, EffectInputInformationVector& inputVector)
     {
-        UInt32 length;
+        UInt32 length = 0u;
         stream >> length;
         inputVector.reserve(length);
         for (UInt32 i = 0; i < length; ++i)
@@ -7,39 +7,216 @@
 //  -------------------------------------------------------------------------
 
 #include "Resource/LZ4CompressionUtils.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
 #include "lz4.h"
 #include "lz4hc.h"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
 
 namespace ramses_internal
 {
     namespace LZ4CompressionUtils
     {
-        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level)
+        // Chunked format: magic, chunk size, chunk count, compressed size of every chunk, compressed chunks.
+        // A plain LZ4 block of non-empty data always starts with token having non-zero literal length,
+        // so leading zero byte of magic tells both formats apart.
+        static const Byte ChunkedFormatMagic[4] = { 0x00, 'C', 'L', '4' };
+        static constexpr uint32_t ChunkedHeaderSize = sizeof(ChunkedFormatMagic) + 2u * sizeof(uint32_t);
+        static constexpr uint32_t MaxWorkerThreads = 3u;
+
+        // Processes chunks by index in calling thread and in tasks of process wide thread pool, each picks next unprocessed chunk.
+        // Calling thread processes chunks as well, so progress never depends on pool threads being available.
+        class ChunkProcessingTask : public ITask
         {
-            const int plainSize = static_cast<int>(plainBuffer.size());
-            if (!plainSize)
-                return CompressedResourceBlob();
+        public:
+            ChunkProcessingTask(uint32_t numChunks, std::function<bool(uint32_t)> processChunk)
+                : m_numChunks(numChunks)
+                , m_processChunk(std::move(processChunk))
+            {
+            }
 
-            CompressedResourceBlob compressedBuffer(LZ4_compressBound(plainSize));
-            int realCompressedSize = 0;
+            virtual void execute() override
+            {
+                // chunks are skipped after failure but still counted, caller waits until all chunks are done
+                for (uint32_t chunkIdx = m_nextChunkIdx++; chunkIdx < m_numChunks; chunkIdx = m_nextChunkIdx++)
+                {
+                    if (!m_failed && !m_processChunk(chunkIdx))
+                        m_failed = true;
+
+                    std::lock_guard<std::mutex> guard(m_lock);
+                    if (++m_numChunksDone == m_numChunks)
+                        m_allChunksDone.notify_all();
+                }
+            }
+
+            bool processAll(ITaskQueue& taskQueue)
+            {
+                const uint32_t numPoolTasks = std::min(MaxWorkerThreads, m_numChunks - 1u);
+                for (uint32_t i = 0u; i < numPoolTasks; ++i)
+                    taskQueue.enqueue(*this);
+                execute();
+
+                // pool tasks executed after this only see all chunks taken and do not touch caller data anymore
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_allChunksDone.wait(lock, [this]() { return m_numChunksDone == m_numChunks; });
+                return !m_failed;
+            }
+
+        private:
+            const uint32_t m_numChunks;
+            std::function<bool(uint32_t)> m_processChunk;
+            std::atomic<uint32_t> m_nextChunkIdx{ 0u };
+            std::atomic<bool> m_failed{ false };
+            std::mutex m_lock;
+            std::condition_variable m_allChunksDone;
+            uint32_t m_numChunksDone = 0u;
+        };
+
+        static bool ProcessChunks(uint32_t numChunks, std::function<bool(uint32_t)> processChunk)
+        {
+            // created on first use and shared by all (de)compressions, so that threads are not started for every resource
+            static ThreadedTaskExecutor chunkTaskExecutor{ static_cast<UInt16>(MaxWorkerThreads) };
 
+            ChunkProcessingTask* task = new ChunkProcessingTask(numChunks, std::move(processChunk));
+            const bool success = task->processAll(chunkTaskExecutor);
+            task->release();
+            return success;
+        }
+
+        static int CompressBlock(const Byte* src, int srcSize, Byte* dst, int dstCapacity, CompressionLevel level)
+        {
             if (level == CompressionLevel::Fast)
+                return LZ4_compress_default(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst), srcSize, dstCapacity);
+
+            // using higher compression causes too excessive times to be able to use
+            return LZ4_compress_HC(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst), srcSize, dstCapacity, LZ4HC_CLEVEL_DEFAULT);
+        }
+
+        static uint32_t GetNumChunks(UInt plainSize)
+        {
+            return static_cast<uint32_t>((plainSize + ChunkSize - 1u) / ChunkSize);
+        }
+
+        static uint32_t ReadUInt32(const Byte* src)
+        {
+            uint32_t value = 0u;
+            std::memcpy(&value, src, sizeof(value));
+            return value;
+        }
+
+        static void WriteUInt32(Byte* dst, uint32_t value)
+        {
+            std::memcpy(dst, &value, sizeof(value));
+        }
+
+        static CompressedResourceBlob CompressChunked(const ResourceBlob& plainBuffer, CompressionLevel level)
+        {
+            const uint32_t numChunks = GetNumChunks(plainBuffer.size());
+            std::vector<CompressedResourceBlob> compressedChunks(numChunks);
+            std::vector<uint32_t> compressedChunkSizes(numChunks, 0u);
+
+            const bool success = ProcessChunks(numChunks, [&](uint32_t chunkIdx)
             {
-                realCompressedSize = LZ4_compress_default(reinterpret_cast<const char*>(plainBuffer.data()),
-                    reinterpret_cast<char*>(compressedBuffer.data()),
-                    plainSize,
-                    static_cast<int>(compressedBuffer.size()));
+                const UInt offset = UInt(chunkIdx) * ChunkSize;
+                const int plainChunkSize = static_cast<int>(std::min<UInt>(ChunkSize, plainBuffer.size() - offset));
+                CompressedResourceBlob& compressedChunk = compressedChunks[chunkIdx];
+                compressedChunk = CompressedResourceBlob(LZ4_compressBound(plainChunkSize));
+                const int compressedSize = CompressBlock(plainBuffer.data() + offset, plainChunkSize, compressedChunk.data(), static_cast<int>(compressedChunk.size()), level);
+                compressedChunkSizes[chunkIdx] = static_cast<uint32_t>(std::max(compressedSize, 0));
+                return compressedSize > 0;
+            });
+            if (!success)
+                return CompressedResourceBlob();
+
+            UInt totalSize = ChunkedHeaderSize + numChunks * sizeof(uint32_t);
+            for (const auto chunkSize : compressedChunkSizes)
+                totalSize += chunkSize;
+
+            CompressedResourceBlob result(totalSize);
+            Byte* dst = result.data();
+            std::memcpy(dst, ChunkedFormatMagic, sizeof(ChunkedFormatMagic));
+            dst += sizeof(ChunkedFormatMagic);
+            WriteUInt32(dst, ChunkSize);
+            dst += sizeof(uint32_t);
+            WriteUInt32(dst, numChunks);
+            dst += sizeof(uint32_t);
+            for (const auto chunkSize : compressedChunkSizes)
+            {
+                WriteUInt32(dst, chunkSize);
+                dst += sizeof(uint32_t);
+            }
+            for (uint32_t i = 0u; i < numChunks; ++i)
+            {
+                std::memcpy(dst, compressedChunks[i].data(), compressedChunkSizes[i]);
+                dst += compressedChunkSizes[i];
             }
-            else
+            assert(dst == result.data() + result.size());
+
+            return result;
+        }
+
+        static ResourceBlob DecompressChunked(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize)
+        {
+            const Byte* src = compressedData.data();
+            const UInt srcSize = compressedData.size();
+            if (srcSize < ChunkedHeaderSize)
+                return ResourceBlob();
+
+            const uint32_t chunkSize = ReadUInt32(src + sizeof(ChunkedFormatMagic));
+            const uint32_t numChunks = ReadUInt32(src + sizeof(ChunkedFormatMagic) + sizeof(uint32_t));
+            if (chunkSize == 0u || numChunks != (UInt(uncompressedSize) + chunkSize - 1u) / chunkSize)
+                return ResourceBlob();
+
+            const UInt chunkTableSize = UInt(numChunks) * sizeof(uint32_t);
+            if (srcSize < ChunkedHeaderSize + chunkTableSize)
+                return ResourceBlob();
+
+            // resolve start of every compressed chunk up front so that chunks can be decompressed independently
+            std::vector<UInt> compressedChunkOffsets(numChunks + 1u);
+            compressedChunkOffsets[0] = ChunkedHeaderSize + chunkTableSize;
+            for (uint32_t i = 0u; i < numChunks; ++i)
             {
-                realCompressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(plainBuffer.data()),
-                    reinterpret_cast<char*>(compressedBuffer.data()),
-                    plainSize,
-                    static_cast<int>(compressedBuffer.size()),
-                    // using higher compression causes too excessive times to be able to use
-                    LZ4HC_CLEVEL_DEFAULT);
+                compressedChunkOffsets[i + 1u] = compressedChunkOffsets[i] + ReadUInt32(src + ChunkedHeaderSize + i * sizeof(uint32_t));
+                if (compressedChunkOffsets[i + 1u] > srcSize)
+                    return ResourceBlob();
             }
 
+            ResourceBlob plainBuffer(uncompressedSize);
+            const bool success = ProcessChunks(numChunks, [&](uint32_t chunkIdx)
+            {
+                const UInt offset = UInt(chunkIdx) * chunkSize;
+                const int plainChunkSize = static_cast<int>(std::min<UInt>(chunkSize, uncompressedSize - offset));
+                const int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(src + compressedChunkOffsets[chunkIdx]),
+                    reinterpret_cast<char*>(plainBuffer.data() + offset),
+                    static_cast<int>(compressedChunkOffsets[chunkIdx + 1u] - compressedChunkOffsets[chunkIdx]),
+                    plainChunkSize);
+                return bytesDecompressed == plainChunkSize;
+            });
+            if (!success)
+                return ResourceBlob();
+
+            return plainBuffer;
+        }
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level)
+        {
+            const int plainSize = static_cast<int>(plainBuffer.size());
+            if (!plainSize)
+                return CompressedResourceBlob();
+
+            if (plainBuffer.size() > ChunkSize)
+                return CompressChunked(plainBuffer, level);
+
+            CompressedResourceBlob compressedBuffer(LZ4_compressBound(plainSize));
+            const int realCompressedSize = CompressBlock(plainBuffer.data(), plainSize, compressedBuffer.data(), static_cast<int>(compressedBuffer.size()), level);
+
             if (realCompressedSize <= 0)
                 return CompressedResourceBlob();
 
@@ -52,6 +229,9 @@ namespace ramses_internal
             if (!compressedData.size() || !uncompressedSize)
                 return ResourceBlob();
 
+            if (isChunked(compressedData))
+                return DecompressChunked(compressedData, uncompressedSize);
+
             ResourceBlob plainBuffer(uncompressedSize);
             int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
                                                         reinterpret_cast<char*>(plainBuffer.data()),
@@ -63,5 +243,10 @@ namespace ramses_internal
 
             return plainBuffer;
         }
+
+        bool isChunked(const CompressedResourceBlob& compressedData)
+        {
+            return compressedData.size() >= sizeof(ChunkedFormatMagic) && std::memcmp(compressedData.data(), ChunkedFormatMagic, sizeof(ChunkedFormatMagic)) == 0;
+        }
     }
 }
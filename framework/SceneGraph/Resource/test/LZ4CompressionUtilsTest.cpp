@@ -69,4 +69,44 @@ namespace ramses_internal
         std::iota(big.begin(), big.end(), static_cast<uint8_t>(5));
         checkCompressionDecompression(big);
     }
+
+    TEST(LZ4CompressionUtilsTest, TestDataOfChunkSizeIsNotChunked)
+    {
+        std::vector<UInt8> data(LZ4CompressionUtils::ChunkSize);
+        std::iota(data.begin(), data.end(), static_cast<uint8_t>(5));
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(data.size(), data.data()), LZ4CompressionUtils::CompressionLevel::Fast);
+        EXPECT_FALSE(LZ4CompressionUtils::isChunked(compBlob));
+        checkCompressionDecompression(data);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataLargerThanChunkSizeIsChunked)
+    {
+        // several full chunks and a partial last one
+        std::vector<UInt8> data(LZ4CompressionUtils::ChunkSize * 5 + 123);
+        for (size_t i = 0u; i < data.size(); ++i)
+            data[i] = static_cast<UInt8>((i * 7u) ^ (i >> 11u));
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(data.size(), data.data()), LZ4CompressionUtils::CompressionLevel::High);
+        EXPECT_TRUE(LZ4CompressionUtils::isChunked(compBlob));
+        checkCompressionDecompression(data);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDecompressionFailsForChunkedDataWithWrongUncompressedSize)
+    {
+        std::vector<UInt8> data(LZ4CompressionUtils::ChunkSize * 3);
+        std::iota(data.begin(), data.end(), static_cast<uint8_t>(5));
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(data.size(), data.data()), LZ4CompressionUtils::CompressionLevel::Fast);
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(data.size() + LZ4CompressionUtils::ChunkSize)).size());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(data.size() - 1u)).size());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDecompressionFailsForTruncatedChunkedData)
+    {
+        std::vector<UInt8> data(LZ4CompressionUtils::ChunkSize * 3);
+        std::iota(data.begin(), data.end(), static_cast<uint8_t>(5));
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(data.size(), data.data()), LZ4CompressionUtils::CompressionLevel::Fast);
+        ASSERT_TRUE(LZ4CompressionUtils::isChunked(compBlob));
+
+        const CompressedResourceBlob truncatedBlob(compBlob.size() - 10u, compBlob.data());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(truncatedBlob, static_cast<uint32_t>(data.size())).size());
+    }
 }
@@ -13,6 +13,7 @@
 
 namespace ramses_internal
 {
+    // Data of instance is owned by scene's DataInstanceArena, instance only refers to it
     class DataInstance
     {
     public:
@@ -20,29 +21,31 @@ namespace ramses_internal
         {
         }
 
-        DataInstance(DataLayoutHandle dataLayoutHandle, UInt32 size)
+        DataInstance(DataLayoutHandle dataLayoutHandle, Byte* data, UInt32 size)
             : m_dataLayoutHandle(dataLayoutHandle)
-            , m_data(size)
+            , m_data(data)
+            , m_size(size)
         {
         }
 
-        DataInstance(const DataInstance&) = default;
-        DataInstance& operator=(const  DataInstance&) = default;
+        DataInstance(const DataInstance&) = delete;
+        DataInstance& operator=(const  DataInstance&) = delete;
         DataInstance(DataInstance&&) noexcept = default;
         DataInstance& operator=(DataInstance&&) noexcept = default;
 
         template <typename DATATYPE>
         const DATATYPE* getTypedDataPointer(UInt32 fieldOffset) const
         {
-            return reinterpret_cast<const DATATYPE*>(&m_data[fieldOffset]);
+            assert(fieldOffset < m_size);
+            return reinterpret_cast<const DATATYPE*>(m_data + fieldOffset);
         }
 
         template <typename DATATYPE>
         void setTypedData(UInt32 fieldOffset, UInt32 elementCount, const DATATYPE* value)
         {
             const UInt32 fieldSizeInByte = sizeof(DATATYPE) * elementCount;
-            assert(fieldOffset + fieldSizeInByte <= m_data.size());
-            void* dest = &m_data[fieldOffset];
+            assert(fieldOffset + fieldSizeInByte <= m_size);
+            void* dest = m_data + fieldOffset;
             if (dest != value)
             {
                 PlatformMemory::Copy(dest, value, fieldSizeInByte);
@@ -54,9 +57,15 @@ namespace ramses_internal
             return m_dataLayoutHandle;
         }
 
+        Byte* getData() const
+        {
+            return m_data;
+        }
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
-        std::vector<Byte> m_data;
+        Byte* m_data = nullptr;
+        UInt32 m_size = 0u;
     };
 
     static_assert(std::is_nothrow_move_constructible<DataInstance>::value, "DataInstance must be movable");
@@ -0,0 +1,70 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DATAINSTANCEARENA_H
+#define RAMSES_DATAINSTANCEARENA_H
+
+#include "SceneAPI/Handles.h"
+#include <vector>
+#include <memory>
+
+namespace ramses_internal
+{
+    // Provides memory for data of all data instances of a scene, so that not every instance needs its own heap allocation.
+    // Data of instances with same data layout is stored in chunks of slots, chunks of a layout grow geometrically
+    // up to a limit and never move, so pointers to instance data stay valid until the instance is released.
+    // Chunks which become empty are freed (except last one of layout which is kept for reuse until layout is released).
+    class DataInstanceArena
+    {
+    public:
+        DataInstanceArena() = default;
+
+        DataInstanceArena(const DataInstanceArena&) = delete;
+        DataInstanceArena& operator=(const DataInstanceArena&) = delete;
+
+        // expected total number of data instances, bigger scenes use bigger chunks
+        void preallocate(UInt32 instanceCount);
+
+        // returns zero initialized memory of given size, all allocations for same layout must have same size
+        Byte* allocate(DataLayoutHandle layout, UInt32 size);
+        void release(DataLayoutHandle layout, Byte* data);
+        // frees remaining memory kept for layout if it has no instance allocated
+        void releaseLayout(DataLayoutHandle layout);
+
+        UInt32 getNumberOfChunks() const;
+        size_t getAllocatedMemorySize() const;
+
+        static constexpr UInt32 InitialSlotsPerChunk = 8u;
+        static constexpr UInt32 DefaultMaxSlotsPerChunk = 256u;
+        static constexpr UInt32 MaxSlotsPerChunkLimit = 4096u;
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<Byte[]> memory;
+            UInt32 slotCount = 0u;
+            UInt32 usedSlotCount = 0u;
+            UInt32 nextUnusedSlot = 0u;
+            std::vector<UInt32> releasedSlots;
+        };
+
+        struct LayoutChunks
+        {
+            UInt32 slotSize = 0u;
+            UInt32 nextChunkSlotCount = InitialSlotsPerChunk;
+            std::vector<Chunk> chunks;
+        };
+
+        static UInt32 GetSlotSize(UInt32 size);
+
+        std::vector<LayoutChunks> m_layouts;
+        UInt32 m_maxSlotsPerChunk = DefaultMaxSlotsPerChunk;
+    };
+}
+
+#endif
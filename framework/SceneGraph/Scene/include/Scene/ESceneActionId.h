@@ -194,6 +194,9 @@ namespace ramses_internal
 
         Incomplete,
 
+        // actions added later are appended so that IDs of existing actions stay compatible with other peers and files
+        SetRenderPassFrustumCulling,
+
         NUMBER_OF_TYPES
     };
 
@@ -385,6 +388,8 @@ case ENUMVALUE: return #ENUMVALUE
 
             CreateNameForEnumID(ESceneActionId::Incomplete);
 
+            CreateNameForEnumID(ESceneActionId::SetRenderPassFrustumCulling);
+
         case ESceneActionId::NUMBER_OF_TYPES:
             break;
         }
@@ -32,6 +32,8 @@ namespace ramses_internal
         Matrix44f       m_matrix     [ETransformationMatrixType_COUNT];
         bool            m_matrixDirty[ETransformationMatrixType_COUNT];
         bool            m_isIdentity;
+        // transform attached to the node, kept here to avoid lookup by node when computing matrices
+        TransformHandle m_transform;
     };
 }
 
@@ -11,6 +11,8 @@
 
 #include "Scene/TransformationCachedScene.h"
 #include "Scene/ResourceChanges.h"
+#include "Collections/FlatHashMap.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -23,11 +25,16 @@ namespace ramses_internal
         bool                                haveResourcesChanged() const;
         void                                resetResourceChanges();
 
+        // client resources which became used or unused since last reset, both sorted
+        void                                collectClientResourceChanges(ResourceChanges& changes) const;
+
         // functions which affect client resources
         virtual void                        releaseRenderable(RenderableHandle renderableHandle) override;
         virtual void                        setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
         virtual void                        setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visibility) override;
 
+        virtual DataInstanceHandle          allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle = DataInstanceHandle::Invalid()) override;
+        virtual void                        releaseDataInstance(DataInstanceHandle containerHandle) override;
         virtual void                        setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor, UInt16 offsetWithinElementInBytes, UInt16 stride) override;
         virtual void                        setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
 
@@ -61,9 +68,29 @@ namespace ramses_internal
         virtual void                        updateTextureBuffer(TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data) override;
 
     private:
+        void addRenderableUsage(RenderableHandle renderableHandle);
+        void removeRenderableUsage(RenderableHandle renderableHandle);
+        void addDataInstanceUsage(DataInstanceHandle handle);
+        void removeDataInstanceUsage(DataInstanceHandle handle);
+        void addTextureSamplerUsage(TextureSamplerHandle handle);
+        void removeTextureSamplerUsage(TextureSamplerHandle handle);
+        void addDataInstanceResources(DataInstanceHandle handle);
+        void removeDataInstanceResources(DataInstanceHandle handle);
+        void addClientResourceUsage(const ResourceContentHash& hash);
+        void removeClientResourceUsage(const ResourceContentHash& hash);
+        bool isDataInstanceUsed(DataInstanceHandle handle) const;
+        bool isTextureSamplerUsed(TextureSamplerHandle handle) const;
 
         SceneResourceActionVector   m_sceneResourceActions;
         bool                        m_resourcesChanged = false;
+
+        // Client resources in use are reference counted incrementally, so that changes are known at flush time
+        // without traversing the scene. Data instances (resp. texture samplers) contribute their resources only if
+        // allocated and referenced by a visible renderable (resp. a contributing data instance).
+        FlatHashMap<ResourceContentHash, UInt32> m_clientResourceUsage;
+        FlatHashMap<ResourceContentHash, bool>   m_clientResourceUsedAtLastReset;
+        std::vector<UInt32>                      m_dataInstanceUsage;
+        std::vector<UInt32>                      m_textureSamplerUsage;
     };
 }
 
@@ -31,6 +31,7 @@
 #include "Scene/TopologyTransform.h"
 #include "Scene/DataLayout.h"
 #include "Scene/DataInstance.h"
+#include "Scene/DataInstanceArena.h"
 
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
@@ -257,6 +258,7 @@ namespace ramses_internal
         virtual void                    setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         virtual void                    setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         virtual void                    retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        virtual void                    setRenderPassFrustumCulling     (RenderPassHandle passHandle, bool enable) override;
         virtual void                    addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order) override;
         virtual void                    removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         virtual const RenderPass&       getRenderPass                   (RenderPassHandle passHandle) const override final;
@@ -369,6 +371,7 @@ namespace ramses_internal
         TransformMemoryPool         m_transforms;
         DataLayoutMemoryPool        m_dataLayoutMemory;
         DataInstanceMemoryPool      m_dataInstanceMemory;
+        DataInstanceArena           m_dataInstanceArena;
         RenderGroupMemoryPool       m_renderGroups;
         RenderPassMemoryPool        m_renderPasses;
         BlitPassMemoryPool          m_blitPasses;
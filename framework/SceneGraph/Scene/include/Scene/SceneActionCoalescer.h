@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEACTIONCOALESCER_H
+#define RAMSES_SCENEACTIONCOALESCER_H
+
+#include "Scene/SceneActionCollection.h"
+#include "Collections/FlatHashMap.h"
+#include "PlatformAbstraction/Hash.h"
+#include <array>
+#include <vector>
+
+namespace ramses_internal
+{
+    // identifies the property of a scene object written by a setter scene action,
+    // i.e. action type and its leading arguments (object handle, field, element count, ...)
+    struct SceneActionSetterKey
+    {
+        ESceneActionId type;
+        std::array<UInt32, 3> arguments;
+
+        bool operator==(const SceneActionSetterKey& other) const
+        {
+            return type == other.type && arguments == other.arguments;
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<ramses_internal::SceneActionSetterKey>
+    {
+        size_t operator()(const ramses_internal::SceneActionSetterKey& key) const
+        {
+            return ramses_internal::HashValue(static_cast<uint32_t>(key.type), key.arguments[0], key.arguments[1], key.arguments[2]);
+        }
+    };
+}
+
+namespace ramses_internal
+{
+    // Removes setter actions which are followed by another action of same type setting the same property
+    // of the same object, only the last write of each property is kept. Remaining actions keep their order,
+    // so allocations and releases are still applied in between the kept setters.
+    class SceneActionCoalescer
+    {
+    public:
+        struct Result
+        {
+            UInt32 numRemovedActions = 0u;
+            UInt32 numRemovedBytes = 0u;
+        };
+
+        Result coalesce(SceneActionCollection& actions);
+
+        static bool GetSetterKey(const SceneActionCollection::SceneActionReader& action, SceneActionSetterKey& key);
+        static bool IsCoalescingBarrier(ESceneActionId type);
+
+    private:
+        // keep container memory allocated
+        FlatHashMap<SceneActionSetterKey, bool> m_keysWrittenLater;
+        std::vector<bool> m_eraseFlags;
+    };
+}
+
+#endif
@@ -81,6 +81,8 @@ namespace ramses_internal
         void appendRawData(const Byte* data, UInt dataSize);
         std::vector<Byte>& getRawDataForDirectWriting();
         void addRawSceneActionInformation(ESceneActionId type, UInt32 offset);
+        // removes all actions flagged in eraseFlags (one flag per action), order of remaining actions is kept
+        void eraseActions(const std::vector<bool>& eraseFlags);
 
         // blob read access
         const std::vector<Byte>& collectionData() const;
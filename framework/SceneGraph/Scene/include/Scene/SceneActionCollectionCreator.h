@@ -146,6 +146,7 @@ namespace ramses_internal
         void setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled);
         void setRenderPassRenderOnce(RenderPassHandle pass, bool enabled);
         void retriggerRenderPassRenderOnce(RenderPassHandle pass);
+        void setRenderPassFrustumCulling(RenderPassHandle pass, bool enabled);
         void addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order);
         void removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle);
 
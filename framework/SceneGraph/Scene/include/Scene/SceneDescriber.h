@@ -25,6 +25,10 @@ namespace ramses_internal
         template <typename T>
         static void describeScene(const T& source, SceneActionCollectionCreator& collector);
 
+        // describes only objects which are not part of binary scene snapshot (see ScenePersistation),
+        // i.e. everything except nodes, transforms, renderables, states, data layouts, data instances and cameras
+        static void describeObjectsNotInSnapshot(const IScene& source, SceneActionCollectionCreator& collector);
+
     private:
         static void RecreateNodes(const IScene& source, SceneActionCollectionCreator& collector);
         static void RecreateCameras(const IScene& source, SceneActionCollectionCreator& collector);
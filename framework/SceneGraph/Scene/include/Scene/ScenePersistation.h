@@ -25,12 +25,18 @@ namespace ramses_internal
     {
     public:
         static void WriteSceneMetadataToStream(IOutputStream& outStream, const IScene& scene);
+        // writes scene as binary snapshot, objects of main scene pools are stored as arrays per type
         static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene);
+        // writes scene in legacy format where whole scene is stored as scene actions, it can still be read by ReadSceneFromStream
+        static void WriteSceneActionsToStream(IOutputStream& outStream, const ClientScene& scene);
         static void WriteSceneToFile(const String& filename, const ClientScene& scene);
 
         static void ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo);
         static void ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
         static void ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
+
+    private:
+        static void ReadSceneSnapshotFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory);
     };
 }
 
@@ -11,9 +11,11 @@
 
 #include "Scene/Scene.h"
 #include "Scene/MatrixCacheEntry.h"
+#include "Math3d/Matrix33f.h"
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
 #include "PlatformAbstraction/PlatformTypes.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -46,6 +48,9 @@ namespace ramses_internal
         virtual void                    setScaling(TransformHandle transform, const Vector3& scaling) override;
 
         Matrix44f                       updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const;
+        // Updates world matrix caches of all given nodes at once, dirty nodes on their parent chains are flattened
+        // into a topologically sorted batch which is then computed in one pass using vectorized matrix kernel
+        void                            updateWorldMatrixCaches(const NodeHandleVector& nodes) const;
         bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
     protected:
@@ -53,7 +58,7 @@ namespace ramses_internal
         bool                        markDirty(NodeHandle node) const;
 
         const Matrix44f&            findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(ETransformationMatrixType matrixType, NodeHandle node, NodeHandleVector& dirtyNodes) const;
-        void                        computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const;
+        void                        computeMatrixForNode(ETransformationMatrixType matrixType, const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const;
         void                        setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const Matrix44f& matrix) const;
 
         // A (local) member variable used by propagateDirty(...) and propagateDirtyToConsumers(...).,
@@ -63,19 +68,32 @@ namespace ramses_internal
     private:
         void                        updateMatrixCacheForDirtyNodes(ETransformationMatrixType matrixType, Matrix44f& chainMatrix, const NodeHandleVector& dirtyNodes) const;
 
-        void                        computeWorldMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const;
-        void                        computeObjectMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const;
+        void                        computeWorldMatrixForNode(const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const;
+        void                        computeObjectMatrixForNode(const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
+        void                        appendToWorldMatrixBatch(MatrixCacheEntry& matrixCache, const Matrix44f& parentMatrix) const;
 
         // Cache
         using MatrixCachePool = MEMORYPOOL<MatrixCacheEntry, NodeHandle>;
         mutable MatrixCachePool m_matrixCachePool;
 
-        HashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
-
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        // Flattened batch of dirty nodes used by updateWorldMatrixCaches, stored as structure of arrays.
+        // Parents are always stored before their children, so matrices can be computed in order.
+        struct WorldMatrixBatch
+        {
+            void clear();
+
+            std::vector<Vector3>            translations;
+            std::vector<Vector3>            scalings;
+            std::vector<Matrix33f>          rotations;
+            std::vector<const Matrix44f*>   parentMatrices;
+            std::vector<Matrix44f*>         worldMatrices;
+        };
+        mutable WorldMatrixBatch m_worldMatrixBatch;
     };
 }
 
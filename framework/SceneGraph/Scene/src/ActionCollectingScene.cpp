@@ -478,6 +478,12 @@ namespace ramses_internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassFrustumCulling(RenderPassHandle passHandle, bool enable)
+    {
+        ResourceChangeCollectingScene::setRenderPassFrustumCulling(passHandle, enable);
+        m_creator.setRenderPassFrustumCulling(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         ResourceChangeCollectingScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
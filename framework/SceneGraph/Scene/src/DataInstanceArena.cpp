@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstanceArena.h"
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#include <cstddef>
+
+namespace ramses_internal
+{
+    void DataInstanceArena::preallocate(UInt32 instanceCount)
+    {
+        // aim for circa 16 chunks if all instances had same layout
+        UInt32 maxSlotsPerChunk = DefaultMaxSlotsPerChunk;
+        while (maxSlotsPerChunk < MaxSlotsPerChunkLimit && maxSlotsPerChunk * 16u < instanceCount)
+            maxSlotsPerChunk *= 2u;
+        m_maxSlotsPerChunk = std::max(m_maxSlotsPerChunk, maxSlotsPerChunk);
+    }
+
+    Byte* DataInstanceArena::allocate(DataLayoutHandle layout, UInt32 size)
+    {
+        if (size == 0u)
+            return nullptr;
+
+        const MemoryHandle layoutIdx = layout.asMemoryHandle();
+        if (layoutIdx >= m_layouts.size())
+            m_layouts.resize(layoutIdx + 1u);
+        LayoutChunks& layoutChunks = m_layouts[layoutIdx];
+
+        const UInt32 slotSize = GetSlotSize(size);
+        if (layoutChunks.slotSize != slotSize)
+        {
+            // layout handle was reused for different layout, all its instances must have been released already
+            assert(std::all_of(layoutChunks.chunks.cbegin(), layoutChunks.chunks.cend(), [](const Chunk& c) { return c.usedSlotCount == 0u; }));
+            layoutChunks = LayoutChunks{};
+            layoutChunks.slotSize = slotSize;
+        }
+
+        // newest chunk is most likely to have free slots
+        auto chunkIt = std::find_if(layoutChunks.chunks.rbegin(), layoutChunks.chunks.rend(), [](const Chunk& c) { return c.usedSlotCount < c.slotCount; });
+        Chunk* chunk = nullptr;
+        if (chunkIt != layoutChunks.chunks.rend())
+        {
+            chunk = &*chunkIt;
+        }
+        else
+        {
+            Chunk newChunk;
+            newChunk.slotCount = std::min(layoutChunks.nextChunkSlotCount, m_maxSlotsPerChunk);
+            newChunk.memory.reset(new Byte[static_cast<size_t>(newChunk.slotCount) * slotSize]);
+            layoutChunks.nextChunkSlotCount = std::min(newChunk.slotCount * 2u, m_maxSlotsPerChunk);
+            layoutChunks.chunks.push_back(std::move(newChunk));
+            chunk = &layoutChunks.chunks.back();
+        }
+
+        UInt32 slot = 0u;
+        if (!chunk->releasedSlots.empty())
+        {
+            slot = chunk->releasedSlots.back();
+            chunk->releasedSlots.pop_back();
+        }
+        else
+        {
+            assert(chunk->nextUnusedSlot < chunk->slotCount);
+            slot = chunk->nextUnusedSlot++;
+        }
+        ++chunk->usedSlotCount;
+
+        Byte* data = chunk->memory.get() + static_cast<size_t>(slot) * slotSize;
+        std::memset(data, 0, slotSize);
+        return data;
+    }
+
+    void DataInstanceArena::release(DataLayoutHandle layout, Byte* data)
+    {
+        if (data == nullptr)
+            return;
+
+        assert(layout.asMemoryHandle() < m_layouts.size());
+        LayoutChunks& layoutChunks = m_layouts[layout.asMemoryHandle()];
+        const size_t slotSize = layoutChunks.slotSize;
+
+        auto chunkIt = std::find_if(layoutChunks.chunks.begin(), layoutChunks.chunks.end(), [&](const Chunk& c)
+        {
+            return data >= c.memory.get() && data < c.memory.get() + c.slotCount * slotSize;
+        });
+        assert(chunkIt != layoutChunks.chunks.end());
+
+        Chunk& chunk = *chunkIt;
+        assert(chunk.usedSlotCount > 0u);
+        --chunk.usedSlotCount;
+        if (chunk.usedSlotCount == 0u && layoutChunks.chunks.size() > 1u)
+        {
+            layoutChunks.chunks.erase(chunkIt);
+        }
+        else if (chunk.usedSlotCount == 0u)
+        {
+            // only chunk of layout is kept, reset it so that it gets filled from start again
+            chunk.nextUnusedSlot = 0u;
+            chunk.releasedSlots.clear();
+        }
+        else
+        {
+            chunk.releasedSlots.push_back(static_cast<UInt32>((data - chunk.memory.get()) / slotSize));
+        }
+    }
+
+    void DataInstanceArena::releaseLayout(DataLayoutHandle layout)
+    {
+        if (layout.asMemoryHandle() >= m_layouts.size())
+            return;
+
+        // memory is kept if there are still instances using it
+        LayoutChunks& layoutChunks = m_layouts[layout.asMemoryHandle()];
+        if (std::all_of(layoutChunks.chunks.cbegin(), layoutChunks.chunks.cend(), [](const Chunk& c) { return c.usedSlotCount == 0u; }))
+            layoutChunks = LayoutChunks{};
+    }
+
+    UInt32 DataInstanceArena::getNumberOfChunks() const
+    {
+        size_t numChunks = 0u;
+        for (const auto& layoutChunks : m_layouts)
+            numChunks += layoutChunks.chunks.size();
+        return static_cast<UInt32>(numChunks);
+    }
+
+    size_t DataInstanceArena::getAllocatedMemorySize() const
+    {
+        size_t memorySize = 0u;
+        for (const auto& layoutChunks : m_layouts)
+        {
+            for (const auto& chunk : layoutChunks.chunks)
+                memorySize += static_cast<size_t>(chunk.slotCount) * layoutChunks.slotSize;
+        }
+        return memorySize;
+    }
+
+    UInt32 DataInstanceArena::GetSlotSize(UInt32 size)
+    {
+        // every slot starts at address aligned for any data type, same as separately allocated memory would be
+        constexpr UInt32 alignment = alignof(std::max_align_t);
+        return (size + alignment - 1u) / alignment * alignment;
+    }
+}
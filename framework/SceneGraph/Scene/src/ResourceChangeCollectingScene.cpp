@@ -8,6 +8,8 @@
 
 #include "Scene/ResourceChangeCollectingScene.h"
 #include "Utils/MemoryPoolExplicit.h"
+#include "Scene/DataLayout.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -30,41 +32,101 @@ namespace ramses_internal
     {
         m_sceneResourceActions.clear();
         m_resourcesChanged = false;
+        m_clientResourceUsedAtLastReset.clear();
     }
 
+    void ResourceChangeCollectingScene::collectClientResourceChanges(ResourceChanges& changes) const
+    {
+        for (const auto& entry : m_clientResourceUsedAtLastReset)
+        {
+            const bool isUsed = m_clientResourceUsage.contains(entry.key);
+            if (isUsed && !entry.value)
+                changes.m_resourcesAdded.push_back(entry.key);
+            else if (!isUsed && entry.value)
+                changes.m_resourcesRemoved.push_back(entry.key);
+        }
+
+        std::sort(changes.m_resourcesAdded.begin(), changes.m_resourcesAdded.end());
+        std::sort(changes.m_resourcesRemoved.begin(), changes.m_resourcesRemoved.end());
+    }
 
     void ResourceChangeCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
         m_resourcesChanged = true;
+        removeRenderableUsage(renderableHandle);
         TransformationCachedScene::releaseRenderable(renderableHandle);
-
     }
 
     void ResourceChangeCollectingScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         m_resourcesChanged = true;
+        const bool isVisible = getRenderable(renderableHandle).visibilityMode != EVisibilityMode::Off;
+        if (isVisible)
+            removeDataInstanceUsage(getRenderable(renderableHandle).dataInstances[slot]);
         TransformationCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        if (isVisible)
+            addDataInstanceUsage(newDataInstance);
     }
 
     void ResourceChangeCollectingScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visibility)
     {
         auto oldVisibility = getRenderable(renderableHandle).visibilityMode;
-        if (oldVisibility != visibility && (oldVisibility == EVisibilityMode::Off || visibility == EVisibilityMode::Off))
+        const bool usageChanges = oldVisibility != visibility && (oldVisibility == EVisibilityMode::Off || visibility == EVisibilityMode::Off);
+        if (usageChanges)
+        {
             m_resourcesChanged = true;
+            if (visibility == EVisibilityMode::Off)
+                removeRenderableUsage(renderableHandle);
+        }
 
         TransformationCachedScene::setRenderableVisibility(renderableHandle, visibility);
+
+        if (usageChanges && oldVisibility == EVisibilityMode::Off)
+            addRenderableUsage(renderableHandle);
+    }
+
+    DataInstanceHandle ResourceChangeCollectingScene::allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle)
+    {
+        const DataInstanceHandle newHandle = TransformationCachedScene::allocateDataInstance(finishedLayoutHandle, instanceHandle);
+        // a renderable might already refer to this handle
+        if (isDataInstanceUsed(newHandle))
+        {
+            m_resourcesChanged = true;
+            addDataInstanceResources(newHandle);
+        }
+        return newHandle;
+    }
+
+    void ResourceChangeCollectingScene::releaseDataInstance(DataInstanceHandle containerHandle)
+    {
+        if (isDataInstanceUsed(containerHandle))
+        {
+            m_resourcesChanged = true;
+            removeDataInstanceResources(containerHandle);
+        }
+        TransformationCachedScene::releaseDataInstance(containerHandle);
     }
 
     void ResourceChangeCollectingScene::setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor, UInt16 offsetWithinElementInBytes, UInt16 stride)
     {
         m_resourcesChanged = true;
+        const bool isUsed = isDataInstanceUsed(dataInstanceHandle);
+        if (isUsed)
+            removeClientResourceUsage(getDataResource(dataInstanceHandle, field).hash);
         TransformationCachedScene::setDataResource(dataInstanceHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
+        if (isUsed)
+            addClientResourceUsage(hash);
     }
 
     void ResourceChangeCollectingScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
     {
         m_resourcesChanged = true;
+        const bool isUsed = isDataInstanceUsed(containerHandle);
+        if (isUsed)
+            removeTextureSamplerUsage(getDataTextureSamplerHandle(containerHandle, field));
         TransformationCachedScene::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
+        if (isUsed)
+            addTextureSamplerUsage(samplerHandle);
     }
 
     ramses_internal::TextureSamplerHandle ResourceChangeCollectingScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle /*= TextureSamplerHandle::Invalid()*/)
@@ -72,13 +134,20 @@ namespace ramses_internal
         if (sampler.textureResource.isValid())
             m_resourcesChanged = true;
 
-        return TransformationCachedScene::allocateTextureSampler(sampler, handle);
+        const TextureSamplerHandle newHandle = TransformationCachedScene::allocateTextureSampler(sampler, handle);
+        // a data instance might already refer to this handle
+        if (isTextureSamplerUsed(newHandle))
+            addClientResourceUsage(sampler.textureResource);
+        return newHandle;
     }
 
     void ResourceChangeCollectingScene::releaseTextureSampler(TextureSamplerHandle handle)
     {
-        if (getTextureSampler(handle).textureResource.isValid())
+        const ResourceContentHash& textureHash = getTextureSampler(handle).textureResource;
+        if (textureHash.isValid())
             m_resourcesChanged = true;
+        if (isTextureSamplerUsed(handle))
+            removeClientResourceUsage(textureHash);
 
         TransformationCachedScene::releaseTextureSampler(handle);
     }
@@ -87,12 +156,15 @@ namespace ramses_internal
     {
         if (dataSlot.attachedTexture.isValid())
             m_resourcesChanged = true;
+        addClientResourceUsage(dataSlot.attachedTexture);
         return TransformationCachedScene::allocateDataSlot(dataSlot, handle);
     }
 
     void ResourceChangeCollectingScene::setDataSlotTexture(DataSlotHandle providerHandle, const ResourceContentHash& texture)
     {
         m_resourcesChanged = true;
+        removeClientResourceUsage(getDataSlot(providerHandle).attachedTexture);
+        addClientResourceUsage(texture);
         TransformationCachedScene::setDataSlotTexture(providerHandle, texture);
     }
 
@@ -101,6 +173,7 @@ namespace ramses_internal
         const ResourceContentHash& textureHash = getDataSlot(handle).attachedTexture;
         if (textureHash.isValid())
             m_resourcesChanged = true;
+        removeClientResourceUsage(textureHash);
 
         TransformationCachedScene::releaseDataSlot(handle);
     }
@@ -134,6 +207,7 @@ namespace ramses_internal
     StreamTextureHandle ResourceChangeCollectingScene::allocateStreamTexture(WaylandIviSurfaceId streamSource, const ResourceContentHash& fallbackTextureHash, StreamTextureHandle streamTextureHandle)
     {
         m_resourcesChanged = true;
+        addClientResourceUsage(fallbackTextureHash);
 
         StreamTextureHandle newHandle = TransformationCachedScene::allocateStreamTexture(streamSource, fallbackTextureHash, streamTextureHandle);
         m_sceneResourceActions.push_back({ newHandle.asMemoryHandle(), ESceneResourceAction_CreateStreamTexture });
@@ -143,6 +217,7 @@ namespace ramses_internal
     void ResourceChangeCollectingScene::releaseStreamTexture(StreamTextureHandle handle)
     {
         m_resourcesChanged = true;
+        removeClientResourceUsage(getStreamTexture(handle).fallbackTexture);
 
         TransformationCachedScene::releaseStreamTexture(handle);
         m_sceneResourceActions.push_back({ handle.asMemoryHandle(), ESceneResourceAction_DestroyStreamTexture });
@@ -198,4 +273,134 @@ namespace ramses_internal
         TransformationCachedScene::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
         m_sceneResourceActions.push_back({ handle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer });
     }
+
+    void ResourceChangeCollectingScene::addRenderableUsage(RenderableHandle renderableHandle)
+    {
+        for (const auto instanceHandle : getRenderable(renderableHandle).dataInstances)
+            addDataInstanceUsage(instanceHandle);
+    }
+
+    void ResourceChangeCollectingScene::removeRenderableUsage(RenderableHandle renderableHandle)
+    {
+        const Renderable& renderable = getRenderable(renderableHandle);
+        if (renderable.visibilityMode == EVisibilityMode::Off)
+            return;
+
+        for (const auto instanceHandle : renderable.dataInstances)
+            removeDataInstanceUsage(instanceHandle);
+    }
+
+    void ResourceChangeCollectingScene::addDataInstanceUsage(DataInstanceHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        if (handle.asMemoryHandle() >= m_dataInstanceUsage.size())
+            m_dataInstanceUsage.resize(handle.asMemoryHandle() + 1u, 0u);
+
+        if (m_dataInstanceUsage[handle.asMemoryHandle()]++ == 0u && isDataInstanceAllocated(handle))
+            addDataInstanceResources(handle);
+    }
+
+    void ResourceChangeCollectingScene::removeDataInstanceUsage(DataInstanceHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        assert(handle.asMemoryHandle() < m_dataInstanceUsage.size() && m_dataInstanceUsage[handle.asMemoryHandle()] > 0u);
+        if (--m_dataInstanceUsage[handle.asMemoryHandle()] == 0u && isDataInstanceAllocated(handle))
+            removeDataInstanceResources(handle);
+    }
+
+    void ResourceChangeCollectingScene::addTextureSamplerUsage(TextureSamplerHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        if (handle.asMemoryHandle() >= m_textureSamplerUsage.size())
+            m_textureSamplerUsage.resize(handle.asMemoryHandle() + 1u, 0u);
+
+        if (m_textureSamplerUsage[handle.asMemoryHandle()]++ == 0u && isTextureSamplerAllocated(handle))
+            addClientResourceUsage(getTextureSampler(handle).textureResource);
+    }
+
+    void ResourceChangeCollectingScene::removeTextureSamplerUsage(TextureSamplerHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        assert(handle.asMemoryHandle() < m_textureSamplerUsage.size() && m_textureSamplerUsage[handle.asMemoryHandle()] > 0u);
+        if (--m_textureSamplerUsage[handle.asMemoryHandle()] == 0u && isTextureSamplerAllocated(handle))
+            removeClientResourceUsage(getTextureSampler(handle).textureResource);
+    }
+
+    void ResourceChangeCollectingScene::addDataInstanceResources(DataInstanceHandle handle)
+    {
+        const DataLayoutHandle layoutHandle = getLayoutOfDataInstance(handle);
+        if (!isDataLayoutAllocated(layoutHandle))
+            return;
+
+        const DataLayout& layout = getDataLayout(layoutHandle);
+        addClientResourceUsage(layout.getEffectHash());
+        for (DataFieldHandle fieldHandle(0u); fieldHandle < layout.getFieldCount(); ++fieldHandle)
+        {
+            const EDataType fieldType = layout.getField(fieldHandle).dataType;
+            if (IsBufferDataType(fieldType))
+                addClientResourceUsage(getDataResource(handle, fieldHandle).hash);
+            else if (IsTextureSamplerType(fieldType))
+                addTextureSamplerUsage(getDataTextureSamplerHandle(handle, fieldHandle));
+        }
+    }
+
+    void ResourceChangeCollectingScene::removeDataInstanceResources(DataInstanceHandle handle)
+    {
+        const DataLayoutHandle layoutHandle = getLayoutOfDataInstance(handle);
+        if (!isDataLayoutAllocated(layoutHandle))
+            return;
+
+        const DataLayout& layout = getDataLayout(layoutHandle);
+        removeClientResourceUsage(layout.getEffectHash());
+        for (DataFieldHandle fieldHandle(0u); fieldHandle < layout.getFieldCount(); ++fieldHandle)
+        {
+            const EDataType fieldType = layout.getField(fieldHandle).dataType;
+            if (IsBufferDataType(fieldType))
+                removeClientResourceUsage(getDataResource(handle, fieldHandle).hash);
+            else if (IsTextureSamplerType(fieldType))
+                removeTextureSamplerUsage(getDataTextureSamplerHandle(handle, fieldHandle));
+        }
+    }
+
+    void ResourceChangeCollectingScene::addClientResourceUsage(const ResourceContentHash& hash)
+    {
+        if (!hash.isValid())
+            return;
+
+        if (m_clientResourceUsage[hash]++ == 0u && !m_clientResourceUsedAtLastReset.contains(hash))
+            m_clientResourceUsedAtLastReset.put(hash, false);
+    }
+
+    void ResourceChangeCollectingScene::removeClientResourceUsage(const ResourceContentHash& hash)
+    {
+        if (!hash.isValid())
+            return;
+
+        auto it = m_clientResourceUsage.find(hash);
+        assert(it != m_clientResourceUsage.end() && it->value > 0u);
+        if (--it->value == 0u)
+        {
+            m_clientResourceUsage.remove(it);
+            if (!m_clientResourceUsedAtLastReset.contains(hash))
+                m_clientResourceUsedAtLastReset.put(hash, true);
+        }
+    }
+
+    bool ResourceChangeCollectingScene::isDataInstanceUsed(DataInstanceHandle handle) const
+    {
+        return handle.asMemoryHandle() < m_dataInstanceUsage.size() && m_dataInstanceUsage[handle.asMemoryHandle()] > 0u && isDataInstanceAllocated(handle);
+    }
+
+    bool ResourceChangeCollectingScene::isTextureSamplerUsed(TextureSamplerHandle handle) const
+    {
+        return handle.asMemoryHandle() < m_textureSamplerUsage.size() && m_textureSamplerUsage[handle.asMemoryHandle()] > 0u && isTextureSamplerAllocated(handle);
+    }
 }
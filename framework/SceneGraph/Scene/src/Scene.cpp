@@ -122,6 +122,12 @@ namespace ramses_internal
         // implemented on renderer side only in a derived scene
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassFrustumCulling(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isFrustumCullingEnabled = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
@@ -958,9 +964,9 @@ namespace ramses_internal
         const DataLayout& layout = *m_dataLayoutMemory.getMemory(layoutHandle);
         const DataInstanceHandle containerHandle = m_dataInstanceMemory.allocate(instanceHandle);
 
-        UInt32 dataInstanceSize = layout.getTotalSize();
+        const UInt32 dataInstanceSize = layout.getTotalSize();
         DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
-        *instance = DataInstance(layoutHandle, dataInstanceSize);
+        *instance = DataInstance(layoutHandle, m_dataInstanceArena.allocate(layoutHandle, dataInstanceSize), dataInstanceSize);
 
         // initialize data instance fields
         // TODO violin this can be generalized further, e.g. via templated static inplace contructor
@@ -1006,13 +1012,16 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataInstance(DataInstanceHandle containerHandle)
     {
-        assert(isDataLayoutAllocated(m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle()));
+        DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
+        assert(isDataLayoutAllocated(instance->getLayoutHandle()));
+        m_dataInstanceArena.release(instance->getLayoutHandle(), instance->getData());
         m_dataInstanceMemory.release(containerHandle);
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataLayout(DataLayoutHandle layoutHandle)
     {
+        m_dataInstanceArena.releaseLayout(layoutHandle);
         m_dataLayoutMemory.release(layoutHandle);
     }
 
@@ -1090,6 +1099,7 @@ namespace ramses_internal
         m_transforms.preallocateSize(sizeInfo.transformCount);
         m_dataLayoutMemory.preallocateSize(sizeInfo.datalayoutCount);
         m_dataInstanceMemory.preallocateSize(sizeInfo.datainstanceCount);
+        m_dataInstanceArena.preallocate(sizeInfo.datainstanceCount);
         m_renderGroups.preallocateSize(sizeInfo.renderGroupCount);
         m_renderPasses.preallocateSize(sizeInfo.renderPassCount);
         m_blitPasses.preallocateSize(sizeInfo.blitPassCount);
@@ -787,6 +787,15 @@ namespace ramses_internal
             scene.retriggerRenderPassRenderOnce(passHandle);
             break;
         }
+        case ESceneActionId::SetRenderPassFrustumCulling:
+        {
+            RenderPassHandle passHandle;
+            bool enabled;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassFrustumCulling(passHandle, enabled);
+            break;
+        }
         case ESceneActionId::AddRenderGroupToRenderPass:
         {
             RenderPassHandle passHandle;
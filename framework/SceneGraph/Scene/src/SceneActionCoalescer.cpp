@@ -0,0 +1,139 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneActionCoalescer.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // number of leading 32 bit arguments identifying the property written by a setter action,
+        // 0 for actions which are not idempotent setters and therefore never removed
+        UInt32 GetNumSetterKeyArguments(ESceneActionId type)
+        {
+            switch (type)
+            {
+            case ESceneActionId::SetRenderableStartIndex:
+            case ESceneActionId::SetRenderableIndexCount:
+            case ESceneActionId::SetRenderableVisibility:
+            case ESceneActionId::SetRenderableInstanceCount:
+            case ESceneActionId::SetRenderableStartVertex:
+            case ESceneActionId::SetRenderableState:
+            case ESceneActionId::SetStateStencilOps:
+            case ESceneActionId::SetStateStencilFunc:
+            case ESceneActionId::SetStateDepthWrite:
+            case ESceneActionId::SetStateDepthFunc:
+            case ESceneActionId::SetStateScissorTest:
+            case ESceneActionId::SetStateCullMode:
+            case ESceneActionId::SetStateDrawMode:
+            case ESceneActionId::SetStateBlendOperations:
+            case ESceneActionId::SetStateBlendFactors:
+            case ESceneActionId::SetStateBlendColor:
+            case ESceneActionId::SetStateColorWriteMask:
+            case ESceneActionId::SetRenderPassClearColor:
+            case ESceneActionId::SetRenderPassClearFlag:
+            case ESceneActionId::SetRenderPassCamera:
+            case ESceneActionId::SetRenderPassRenderTarget:
+            case ESceneActionId::SetRenderPassRenderOrder:
+            case ESceneActionId::SetRenderPassEnabled:
+            case ESceneActionId::SetRenderPassFrustumCulling:
+            case ESceneActionId::SetBlitPassRenderOrder:
+            case ESceneActionId::SetBlitPassEnabled:
+            case ESceneActionId::SetBlitPassRegions:
+            case ESceneActionId::SetPickableObjectId:
+            case ESceneActionId::SetPickableObjectCamera:
+            case ESceneActionId::SetPickableObjectEnabled:
+            case ESceneActionId::SetForceFallback:
+            case ESceneActionId::SetDataSlotTexture:
+            case ESceneActionId::SetSceneReferenceRenderOrder:
+                // object handle
+                return 1u;
+            case ESceneActionId::SetTransformComponent:
+                // property type, transform handle
+            case ESceneActionId::SetRenderableDataInstance:
+                // renderable handle, slot
+            case ESceneActionId::SetDataResource:
+            case ESceneActionId::SetDataTextureSamplerHandle:
+            case ESceneActionId::SetDataReference:
+                // data instance handle, field
+                return 2u;
+            case ESceneActionId::SetDataIntegerArray:
+            case ESceneActionId::SetDataFloatArray:
+            case ESceneActionId::SetDataVector2fArray:
+            case ESceneActionId::SetDataVector3fArray:
+            case ESceneActionId::SetDataVector4fArray:
+            case ESceneActionId::SetDataVector2iArray:
+            case ESceneActionId::SetDataVector3iArray:
+            case ESceneActionId::SetDataVector4iArray:
+            case ESceneActionId::SetDataMatrix22fArray:
+            case ESceneActionId::SetDataMatrix33fArray:
+            case ESceneActionId::SetDataMatrix44fArray:
+                // data instance handle, field, element count - arrays are written from first element,
+                // a write with less elements does not overwrite all of a previous write
+                return 3u;
+            default:
+                return 0u;
+            }
+        }
+    }
+
+    bool SceneActionCoalescer::GetSetterKey(const SceneActionCollection::SceneActionReader& action, SceneActionSetterKey& key)
+    {
+        const UInt32 numArguments = GetNumSetterKeyArguments(action.type());
+        if (numArguments == 0u)
+            return false;
+
+        assert(action.size() >= numArguments * sizeof(UInt32));
+        key.type = action.type();
+        key.arguments = {};
+        PlatformMemory::Copy(key.arguments.data(), action.data(), numArguments * sizeof(UInt32));
+        return true;
+    }
+
+    bool SceneActionCoalescer::IsCoalescingBarrier(ESceneActionId type)
+    {
+        // animation systems bind to data instance fields, do not make any assumptions on when those are read
+        return type >= ESceneActionId::AddAnimationSystem && type <= ESceneActionId::AnimationSystemRemoveAnimation;
+    }
+
+    SceneActionCoalescer::Result SceneActionCoalescer::coalesce(SceneActionCollection& actions)
+    {
+        Result result;
+        const UInt32 numActions = actions.numberOfActions();
+        m_eraseFlags.assign(numActions, false);
+        m_keysWrittenLater.clear();
+
+        // walk backwards, a setter is redundant if same property is written again later without a barrier in between
+        SceneActionSetterKey key;
+        for (UInt32 actionIdx = numActions; actionIdx > 0u; --actionIdx)
+        {
+            const auto action = actions[actionIdx - 1u];
+            if (IsCoalescingBarrier(action.type()))
+            {
+                m_keysWrittenLater.clear();
+            }
+            else if (GetSetterKey(action, key))
+            {
+                if (m_keysWrittenLater.contains(key))
+                {
+                    m_eraseFlags[actionIdx - 1u] = true;
+                    ++result.numRemovedActions;
+                    result.numRemovedBytes += action.size();
+                }
+                else
+                    m_keysWrittenLater.put(key, true);
+            }
+        }
+
+        if (result.numRemovedActions > 0u)
+            actions.eraseActions(m_eraseFlags);
+
+        return result;
+    }
+}
@@ -7,8 +7,36 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/SceneActionCollection.h"
+#include <cstring>
 
 namespace ramses_internal
 {
     const UInt8 SceneActionCollection::MaxStringLength;
+
+    void SceneActionCollection::eraseActions(const std::vector<bool>& eraseFlags)
+    {
+        assert(eraseFlags.size() == m_actionInfo.size());
+        if (m_actionInfo.empty())
+            return;
+
+        UInt32 writeOffset = m_actionInfo.front().offset;
+        size_t writeIndex = 0u;
+        for (size_t readIndex = 0u; readIndex < m_actionInfo.size(); ++readIndex)
+        {
+            const UInt32 actionBegin = m_actionInfo[readIndex].offset;
+            const UInt32 actionEnd = (readIndex + 1u < m_actionInfo.size()) ? m_actionInfo[readIndex + 1u].offset : static_cast<UInt32>(m_data.size());
+            if (eraseFlags[readIndex])
+                continue;
+
+            const UInt32 actionSize = actionEnd - actionBegin;
+            if (actionBegin != writeOffset)
+                std::memmove(m_data.data() + writeOffset, m_data.data() + actionBegin, actionSize);
+            m_actionInfo[writeIndex] = { m_actionInfo[readIndex].type, writeOffset };
+            ++writeIndex;
+            writeOffset += actionSize;
+        }
+
+        m_actionInfo.resize(writeIndex);
+        m_data.resize(writeOffset);
+    }
 }
@@ -41,6 +41,11 @@ namespace ramses_internal
         RecreateDataLayouts(             source, collector);
         RecreateDataInstances(           source, collector);
         RecreateCameras(                 source, collector);
+        describeObjectsNotInSnapshot(    source, collector);
+    }
+
+    void SceneDescriber::describeObjectsNotInSnapshot(const IScene& source, SceneActionCollectionCreator& collector)
+    {
         RecreateAnimationSystems(        source, collector);
         RecreateRenderGroups(            source, collector);
         RecreateRenderPasses(            source, collector);
@@ -396,6 +401,8 @@ namespace ramses_internal
                 collector.setRenderPassEnabled(renderPass, rp.isEnabled);
                 if (rp.isRenderOnce)
                     collector.setRenderPassRenderOnce(renderPass, true);
+                if (rp.isFrustumCullingEnabled)
+                    collector.setRenderPassFrustumCulling(renderPass, true);
                 for (const auto& rgEntry : rp.renderGroups)
                     collector.addRenderGroupToRenderPass(renderPass, rgEntry.renderGroup, rgEntry.order);
             }
@@ -15,13 +15,20 @@
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/LogMacros.h"
+#include "Utils/MemoryUtils.h"
+#include "Math3d/Matrix22f.h"
+#include "Math3d/Matrix33f.h"
+#include "Math3d/Matrix44f.h"
 #include "Collections/String.h"
 #include <array>
+#include <type_traits>
 #include "Scene/ClientScene.h"
 
 namespace ramses_internal
 {
     static const UInt32 gSceneMarker = 0x534d4152;  // {'R', 'A', 'M', 'S'}
+    // layout of snapshot is versioned by file format version of the file it is stored in
+    static const UInt32 gSceneSnapshotMarker = 0x50414e53;  // {'S', 'N', 'A', 'P'}
 
     void ScenePersistation::ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo)
     {
@@ -74,16 +81,133 @@ namespace ramses_internal
         outStream << scene.getName();
     }
 
-    void ScenePersistation::WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene)
+    // Records of pools with plain data written as contiguous arrays in scene snapshot,
+    // members are 32bit wide or, as RenderState, free of implicit padding so that there is no padding written to file.
+    struct SnapshotTransform
     {
-        SceneActionCollection collection;
-        SceneActionCollectionCreator creator(collection);
-        creator.preallocateSceneSize(scene.getSceneSizeInformation());
-        SceneDescriber::describeScene<ClientScene>(scene, creator);
+        TransformHandle handle;
+        NodeHandle node;
+        Vector3 translation;
+        Vector3 rotation;
+        Vector3 scaling;
+        UInt32 rotationConvention;
+    };
+
+    struct SnapshotRenderable
+    {
+        RenderableHandle handle;
+        NodeHandle node;
+        UInt32 visibilityMode;
+        UInt32 startIndex;
+        UInt32 indexCount;
+        UInt32 instanceCount;
+        UInt32 startVertex;
+        DataInstanceHandle geometryInstance;
+        DataInstanceHandle uniformInstance;
+        RenderStateHandle renderState;
+    };
+
+    struct SnapshotRenderState
+    {
+        RenderStateHandle handle;
+        RenderState state;
+    };
+    static_assert(sizeof(SnapshotRenderState) == sizeof(RenderStateHandle) + sizeof(RenderState), "SnapshotRenderState must not contain padding");
+
+    struct SnapshotCamera
+    {
+        CameraHandle handle;
+        UInt32 projectionType;
+        NodeHandle node;
+        DataInstanceHandle dataInstance;
+    };
+
+    template <typename T>
+    static void WriteArray(IOutputStream& outStream, const std::vector<T>& elements)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be written as array");
+        outStream << static_cast<UInt32>(elements.size());
+        if (!elements.empty())
+            outStream.write(elements.data(), elements.size() * sizeof(T));
+    }
+
+    template <typename T>
+    static void ReadArray(IInputStream& inStream, std::vector<T>& elements)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be read as array");
+        UInt32 count = 0u;
+        inStream >> count;
+        elements.resize(count);
+        if (!elements.empty())
+            inStream.read(elements.data(), elements.size() * sizeof(T));
+    }
 
+    template <typename HANDLE>
+    static void WriteHandle(IOutputStream& outStream, HANDLE handle)
+    {
+        outStream << handle.asMemoryHandle();
+    }
+
+    template <typename HANDLE>
+    static HANDLE ReadHandle(IInputStream& inStream)
+    {
+        MemoryHandle handle = 0u;
+        inStream >> handle;
+        return HANDLE(handle);
+    }
+
+    static void WriteSceneSizeInformation(IOutputStream& outStream, const SceneSizeInformation& sizeInfo)
+    {
+        outStream << sizeInfo.nodeCount;
+        outStream << sizeInfo.cameraCount;
+        outStream << sizeInfo.transformCount;
+        outStream << sizeInfo.renderableCount;
+        outStream << sizeInfo.renderStateCount;
+        outStream << sizeInfo.datalayoutCount;
+        outStream << sizeInfo.datainstanceCount;
+        outStream << sizeInfo.renderGroupCount;
+        outStream << sizeInfo.renderPassCount;
+        outStream << sizeInfo.blitPassCount;
+        outStream << sizeInfo.renderTargetCount;
+        outStream << sizeInfo.renderBufferCount;
+        outStream << sizeInfo.textureSamplerCount;
+        outStream << sizeInfo.streamTextureCount;
+        outStream << sizeInfo.dataSlotCount;
+        outStream << sizeInfo.dataBufferCount;
+        outStream << sizeInfo.animationSystemCount;
+        outStream << sizeInfo.textureBufferCount;
+        outStream << sizeInfo.pickableObjectCount;
+        outStream << sizeInfo.sceneReferenceCount;
+    }
+
+    static void ReadSceneSizeInformation(IInputStream& inStream, SceneSizeInformation& sizeInfo)
+    {
+        inStream >> sizeInfo.nodeCount;
+        inStream >> sizeInfo.cameraCount;
+        inStream >> sizeInfo.transformCount;
+        inStream >> sizeInfo.renderableCount;
+        inStream >> sizeInfo.renderStateCount;
+        inStream >> sizeInfo.datalayoutCount;
+        inStream >> sizeInfo.datainstanceCount;
+        inStream >> sizeInfo.renderGroupCount;
+        inStream >> sizeInfo.renderPassCount;
+        inStream >> sizeInfo.blitPassCount;
+        inStream >> sizeInfo.renderTargetCount;
+        inStream >> sizeInfo.renderBufferCount;
+        inStream >> sizeInfo.textureSamplerCount;
+        inStream >> sizeInfo.streamTextureCount;
+        inStream >> sizeInfo.dataSlotCount;
+        inStream >> sizeInfo.dataBufferCount;
+        inStream >> sizeInfo.animationSystemCount;
+        inStream >> sizeInfo.textureBufferCount;
+        inStream >> sizeInfo.pickableObjectCount;
+        inStream >> sizeInfo.sceneReferenceCount;
+    }
+
+    static void WriteSceneActionCollection(IOutputStream& outStream, const SceneActionCollection& collection)
+    {
         const std::vector<Byte>& actionData = collection.collectionData();
 
-        outStream << static_cast<UInt32>(gSceneMarker);
         outStream << static_cast<UInt32>(collection.numberOfActions());
         outStream << static_cast<UInt32>(actionData.size());
 
@@ -98,6 +222,499 @@ namespace ramses_internal
         }
     }
 
+    static void ReadSceneActionCollection(IInputStream& inStream, SceneActionCollection& actions, std::array<uint32_t, NumOfSceneActionTypes>& objectCounts)
+    {
+        UInt32 numberOfSceneActionsToRead = 0;
+        inStream >> numberOfSceneActionsToRead;
+        UInt32 sizeOfAllSceneActions = 0;
+        inStream >> sizeOfAllSceneActions;
+
+        actions.reserveAdditionalCapacity(0u, numberOfSceneActionsToRead);
+
+        // read data
+        std::vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
+        rawActionData.resize(sizeOfAllSceneActions);
+        inStream.read(reinterpret_cast<char*>(rawActionData.data()), static_cast<UInt32>(rawActionData.size()));
+
+        // read types and offsets
+        for (UInt32 i = 0; i < numberOfSceneActionsToRead; ++i)
+        {
+            UInt32 actionType = 0;
+            inStream >> actionType;
+            UInt32 offsetInCollection = 0;
+            inStream >> offsetInCollection;
+            if (actionType >= NumOfSceneActionTypes)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream: invalid scene action type " << actionType);
+                actions.clear();
+                return;
+            }
+            actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
+            ++objectCounts[actionType];
+        }
+    }
+
+    static const Byte* GetDataFieldValue(const IScene& scene, DataInstanceHandle instance, DataFieldHandle field, EDataType dataType)
+    {
+        switch (dataType)
+        {
+        case EDataType::Float:     return reinterpret_cast<const Byte*>(scene.getDataFloatArray(instance, field));
+        case EDataType::Vector2F:  return reinterpret_cast<const Byte*>(scene.getDataVector2fArray(instance, field));
+        case EDataType::Vector3F:  return reinterpret_cast<const Byte*>(scene.getDataVector3fArray(instance, field));
+        case EDataType::Vector4F:  return reinterpret_cast<const Byte*>(scene.getDataVector4fArray(instance, field));
+        case EDataType::Matrix22F: return reinterpret_cast<const Byte*>(scene.getDataMatrix22fArray(instance, field));
+        case EDataType::Matrix33F: return reinterpret_cast<const Byte*>(scene.getDataMatrix33fArray(instance, field));
+        case EDataType::Matrix44F: return reinterpret_cast<const Byte*>(scene.getDataMatrix44fArray(instance, field));
+        case EDataType::Int32:     return reinterpret_cast<const Byte*>(scene.getDataIntegerArray(instance, field));
+        case EDataType::Vector2I:  return reinterpret_cast<const Byte*>(scene.getDataVector2iArray(instance, field));
+        case EDataType::Vector3I:  return reinterpret_cast<const Byte*>(scene.getDataVector3iArray(instance, field));
+        case EDataType::Vector4I:  return reinterpret_cast<const Byte*>(scene.getDataVector4iArray(instance, field));
+        default:
+            assert(false);
+            return nullptr;
+        }
+    }
+
+    static void SetDataFieldValue(IScene& scene, DataInstanceHandle instance, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* data)
+    {
+        switch (dataType)
+        {
+        case EDataType::Float:     scene.setDataFloatArray(instance, field, elementCount, reinterpret_cast<const Float*>(data)); break;
+        case EDataType::Vector2F:  scene.setDataVector2fArray(instance, field, elementCount, reinterpret_cast<const Vector2*>(data)); break;
+        case EDataType::Vector3F:  scene.setDataVector3fArray(instance, field, elementCount, reinterpret_cast<const Vector3*>(data)); break;
+        case EDataType::Vector4F:  scene.setDataVector4fArray(instance, field, elementCount, reinterpret_cast<const Vector4*>(data)); break;
+        case EDataType::Matrix22F: scene.setDataMatrix22fArray(instance, field, elementCount, reinterpret_cast<const Matrix22f*>(data)); break;
+        case EDataType::Matrix33F: scene.setDataMatrix33fArray(instance, field, elementCount, reinterpret_cast<const Matrix33f*>(data)); break;
+        case EDataType::Matrix44F: scene.setDataMatrix44fArray(instance, field, elementCount, reinterpret_cast<const Matrix44f*>(data)); break;
+        case EDataType::Int32:     scene.setDataIntegerArray(instance, field, elementCount, reinterpret_cast<const Int32*>(data)); break;
+        case EDataType::Vector2I:  scene.setDataVector2iArray(instance, field, elementCount, reinterpret_cast<const Vector2i*>(data)); break;
+        case EDataType::Vector3I:  scene.setDataVector3iArray(instance, field, elementCount, reinterpret_cast<const Vector3i*>(data)); break;
+        case EDataType::Vector4I:  scene.setDataVector4iArray(instance, field, elementCount, reinterpret_cast<const Vector4i*>(data)); break;
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    static void WriteSnapshotNodes(IOutputStream& outStream, const IScene& scene)
+    {
+        std::vector<NodeHandle> nodes;
+        std::vector<UInt32> childCounts;
+        std::vector<NodeHandle> children;
+        nodes.reserve(scene.getNodeCount());
+        childCounts.reserve(scene.getNodeCount());
+        children.reserve(scene.getNodeCount());
+        for (NodeHandle n(0u); n < scene.getNodeCount(); ++n)
+        {
+            if (scene.isNodeAllocated(n))
+            {
+                const UInt32 childCount = scene.getChildCount(n);
+                nodes.push_back(n);
+                childCounts.push_back(childCount);
+                for (UInt32 child = 0u; child < childCount; ++child)
+                    children.push_back(scene.getChild(n, child));
+            }
+        }
+
+        WriteArray(outStream, nodes);
+        WriteArray(outStream, childCounts);
+        WriteArray(outStream, children);
+    }
+
+    static bool ReadSnapshotNodes(IInputStream& inStream, IScene& scene)
+    {
+        std::vector<NodeHandle> nodes;
+        std::vector<UInt32> childCounts;
+        std::vector<NodeHandle> children;
+        ReadArray(inStream, nodes);
+        ReadArray(inStream, childCounts);
+        ReadArray(inStream, children);
+        if (inStream.getState() != EStatus::Ok || nodes.size() != childCounts.size())
+            return false;
+
+        for (size_t i = 0u; i < nodes.size(); ++i)
+            scene.allocateNode(childCounts[i], nodes[i]);
+
+        size_t childIdx = 0u;
+        for (size_t i = 0u; i < nodes.size(); ++i)
+        {
+            if (children.size() - childIdx < childCounts[i])
+                return false;
+            for (UInt32 child = 0u; child < childCounts[i]; ++child)
+                scene.addChildToNode(nodes[i], children[childIdx++]);
+        }
+
+        return true;
+    }
+
+    static void WriteSnapshotTransforms(IOutputStream& outStream, const IScene& scene)
+    {
+        std::vector<SnapshotTransform> transforms;
+        transforms.reserve(scene.getTransformCount());
+        for (TransformHandle t(0u); t < scene.getTransformCount(); ++t)
+        {
+            if (scene.isTransformAllocated(t))
+            {
+                transforms.push_back({ t, scene.getTransformNode(t), scene.getTranslation(t), scene.getRotation(t), scene.getScaling(t),
+                    static_cast<UInt32>(scene.getRotationConvention(t)) });
+            }
+        }
+
+        WriteArray(outStream, transforms);
+    }
+
+    static bool ReadSnapshotTransforms(IInputStream& inStream, IScene& scene)
+    {
+        std::vector<SnapshotTransform> transforms;
+        ReadArray(inStream, transforms);
+        if (inStream.getState() != EStatus::Ok)
+            return false;
+
+        for (const auto& t : transforms)
+        {
+            scene.allocateTransform(t.node, t.handle);
+            if (t.translation != Vector3(0.f))
+                scene.setTranslation(t.handle, t.translation);
+            if (t.rotation != Vector3(0.f))
+                scene.setRotation(t.handle, t.rotation, static_cast<ERotationConvention>(t.rotationConvention));
+            if (t.scaling != Vector3(1.f))
+                scene.setScaling(t.handle, t.scaling);
+        }
+
+        return true;
+    }
+
+    static void WriteSnapshotRenderables(IOutputStream& outStream, const IScene& scene)
+    {
+        std::vector<SnapshotRenderable> renderables;
+        renderables.reserve(scene.getRenderableCount());
+        for (RenderableHandle r(0u); r < scene.getRenderableCount(); ++r)
+        {
+            if (scene.isRenderableAllocated(r))
+            {
+                const Renderable& renderable = scene.getRenderable(r);
+                renderables.push_back({ r, renderable.node, static_cast<UInt32>(renderable.visibilityMode), renderable.startIndex, renderable.indexCount,
+                    renderable.instanceCount, renderable.startVertex, renderable.dataInstances[ERenderableDataSlotType_Geometry],
+                    renderable.dataInstances[ERenderableDataSlotType_Uniforms], renderable.renderState });
+            }
+        }
+
+        WriteArray(outStream, renderables);
+    }
+
+    static bool ReadSnapshotRenderables(IInputStream& inStream, IScene& scene)
+    {
+        std::vector<SnapshotRenderable> renderables;
+        ReadArray(inStream, renderables);
+        if (inStream.getState() != EStatus::Ok)
+            return false;
+
+        static_assert(ERenderableDataSlotType_MAX_SLOTS == 2u, "Expected ERenderableDataSlotType containing 2 elements, adjust scene snapshot");
+        for (const auto& r : renderables)
+        {
+            scene.allocateRenderable(r.node, r.handle);
+            if (r.startIndex != 0u)
+                scene.setRenderableStartIndex(r.handle, r.startIndex);
+            scene.setRenderableIndexCount(r.handle, r.indexCount);
+            scene.setRenderableRenderState(r.handle, r.renderState);
+            if (static_cast<EVisibilityMode>(r.visibilityMode) != EVisibilityMode::Visible)
+                scene.setRenderableVisibility(r.handle, static_cast<EVisibilityMode>(r.visibilityMode));
+            if (r.instanceCount != 1u)
+                scene.setRenderableInstanceCount(r.handle, r.instanceCount);
+            if (r.startVertex != 0u)
+                scene.setRenderableStartVertex(r.handle, r.startVertex);
+            scene.setRenderableDataInstance(r.handle, ERenderableDataSlotType_Geometry, r.geometryInstance);
+            scene.setRenderableDataInstance(r.handle, ERenderableDataSlotType_Uniforms, r.uniformInstance);
+        }
+
+        return true;
+    }
+
+    static void WriteSnapshotRenderStates(IOutputStream& outStream, const IScene& scene)
+    {
+        std::vector<SnapshotRenderState> states;
+        states.reserve(scene.getRenderStateCount());
+        for (RenderStateHandle s(0u); s < scene.getRenderStateCount(); ++s)
+        {
+            if (scene.isRenderStateAllocated(s))
+                states.push_back({ s, scene.getRenderState(s) });
+        }
+
+        WriteArray(outStream, states);
+    }
+
+    static bool ReadSnapshotRenderStates(IInputStream& inStream, IScene& scene)
+    {
+        std::vector<SnapshotRenderState> states;
+        ReadArray(inStream, states);
+        if (inStream.getState() != EStatus::Ok)
+            return false;
+
+        for (const auto& s : states)
+        {
+            const RenderState& rs = s.state;
+            scene.allocateRenderState(s.handle);
+            scene.setRenderStateBlendFactors(s.handle, rs.blendFactorSrcColor, rs.blendFactorDstColor, rs.blendFactorSrcAlpha, rs.blendFactorDstAlpha);
+            scene.setRenderStateBlendOperations(s.handle, rs.blendOperationColor, rs.blendOperationAlpha);
+            scene.setRenderStateBlendColor(s.handle, rs.blendColor);
+            scene.setRenderStateCullMode(s.handle, rs.cullMode);
+            scene.setRenderStateDrawMode(s.handle, rs.drawMode);
+            scene.setRenderStateDepthWrite(s.handle, rs.depthWrite);
+            scene.setRenderStateDepthFunc(s.handle, rs.depthFunc);
+            scene.setRenderStateScissorTest(s.handle, rs.scissorTest, rs.scissorRegion);
+            scene.setRenderStateStencilFunc(s.handle, rs.stencilFunc, rs.stencilRefValue, rs.stencilMask);
+            scene.setRenderStateStencilOps(s.handle, rs.stencilOpFail, rs.stencilOpDepthFail, rs.stencilOpDepthPass);
+            scene.setRenderStateColorWriteMask(s.handle, rs.colorWriteMask);
+        }
+
+        return true;
+    }
+
+    static void WriteSnapshotDataLayouts(IOutputStream& outStream, const ClientScene& scene)
+    {
+        UInt32 layoutCount = 0u;
+        for (DataLayoutHandle l(0u); l < scene.getDataLayoutCount(); ++l)
+        {
+            if (scene.isDataLayoutAllocated(l))
+                ++layoutCount;
+        }
+
+        outStream << layoutCount;
+        for (DataLayoutHandle l(0u); l < scene.getDataLayoutCount(); ++l)
+        {
+            if (scene.isDataLayoutAllocated(l))
+            {
+                // client scene compacts data layouts, every reference must be restored
+                const DataLayout& layout = scene.getDataLayout(l);
+                WriteHandle(outStream, l);
+                outStream << scene.getNumDataLayoutReferences(l);
+                outStream << layout.getEffectHash();
+                outStream << static_cast<UInt32>(layout.getFieldCount());
+                for (const auto& field : layout.getDataFields())
+                {
+                    outStream << static_cast<UInt32>(field.dataType);
+                    outStream << field.elementCount;
+                    outStream << static_cast<UInt32>(field.semantics);
+                }
+            }
+        }
+    }
+
+    static bool ReadSnapshotDataLayouts(IInputStream& inStream, IScene& scene)
+    {
+        UInt32 layoutCount = 0u;
+        inStream >> layoutCount;
+
+        DataFieldInfoVector fields;
+        for (UInt32 i = 0u; i < layoutCount && inStream.getState() == EStatus::Ok; ++i)
+        {
+            const auto handle = ReadHandle<DataLayoutHandle>(inStream);
+            UInt32 numReferences = 0u;
+            inStream >> numReferences;
+            ResourceContentHash effectHash;
+            inStream >> effectHash;
+            UInt32 fieldCount = 0u;
+            inStream >> fieldCount;
+
+            fields.clear();
+            for (UInt32 f = 0u; f < fieldCount && inStream.getState() == EStatus::Ok; ++f)
+            {
+                UInt32 dataType = 0u;
+                UInt32 elementCount = 0u;
+                UInt32 semantics = 0u;
+                inStream >> dataType >> elementCount >> semantics;
+                fields.emplace_back(static_cast<EDataType>(dataType), elementCount, static_cast<EFixedSemantics>(semantics));
+            }
+
+            if (inStream.getState() != EStatus::Ok)
+                return false;
+
+            for (UInt32 r = 0u; r < numReferences; ++r)
+                scene.allocateDataLayout(fields, effectHash, handle);
+        }
+
+        return inStream.getState() == EStatus::Ok;
+    }
+
+    static void WriteSnapshotDataInstances(IOutputStream& outStream, const IScene& scene)
+    {
+        UInt32 instanceCount = 0u;
+        for (DataInstanceHandle i(0u); i < scene.getDataInstanceCount(); ++i)
+        {
+            if (scene.isDataInstanceAllocated(i))
+                ++instanceCount;
+        }
+
+        outStream << instanceCount;
+        for (DataInstanceHandle i(0u); i < scene.getDataInstanceCount(); ++i)
+        {
+            if (!scene.isDataInstanceAllocated(i))
+                continue;
+
+            const DataLayoutHandle layoutHandle = scene.getLayoutOfDataInstance(i);
+            WriteHandle(outStream, i);
+            WriteHandle(outStream, layoutHandle);
+
+            // field values are written in layout order, reader knows their types and sizes from layout
+            const DataLayout& layout = scene.getDataLayout(layoutHandle);
+            for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
+            {
+                const DataFieldInfo& field = layout.getField(f);
+                switch (field.dataType)
+                {
+                case EDataType::TextureSampler2D:
+                case EDataType::TextureSampler2DMS:
+                case EDataType::TextureSampler3D:
+                case EDataType::TextureSamplerCube:
+                    WriteHandle(outStream, scene.getDataTextureSamplerHandle(i, f));
+                    break;
+                case EDataType::DataReference:
+                    WriteHandle(outStream, scene.getDataReference(i, f));
+                    break;
+                case EDataType::Indices:
+                case EDataType::UInt16Buffer:
+                case EDataType::FloatBuffer:
+                case EDataType::Vector2Buffer:
+                case EDataType::Vector3Buffer:
+                case EDataType::Vector4Buffer:
+                {
+                    const ResourceField& dataResource = scene.getDataResource(i, f);
+                    outStream << dataResource.hash;
+                    WriteHandle(outStream, dataResource.dataBuffer);
+                    outStream << dataResource.instancingDivisor << dataResource.offsetWithinElementInBytes << dataResource.stride;
+                    break;
+                }
+                default:
+                    outStream.write(GetDataFieldValue(scene, i, f, field.dataType), field.elementCount * EnumToSize(field.dataType));
+                    break;
+                }
+            }
+        }
+    }
+
+    static bool ReadSnapshotDataInstances(IInputStream& inStream, IScene& scene)
+    {
+        UInt32 instanceCount = 0u;
+        inStream >> instanceCount;
+
+        std::vector<Byte> valueBuffer;
+        for (UInt32 idx = 0u; idx < instanceCount && inStream.getState() == EStatus::Ok; ++idx)
+        {
+            const auto i = ReadHandle<DataInstanceHandle>(inStream);
+            const auto layoutHandle = ReadHandle<DataLayoutHandle>(inStream);
+            if (inStream.getState() != EStatus::Ok || !scene.isDataLayoutAllocated(layoutHandle))
+                return false;
+
+            scene.allocateDataInstance(layoutHandle, i);
+
+            const DataLayout& layout = scene.getDataLayout(layoutHandle);
+            for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
+            {
+                const DataFieldInfo& field = layout.getField(f);
+                switch (field.dataType)
+                {
+                case EDataType::TextureSampler2D:
+                case EDataType::TextureSampler2DMS:
+                case EDataType::TextureSampler3D:
+                case EDataType::TextureSamplerCube:
+                    scene.setDataTextureSamplerHandle(i, f, ReadHandle<TextureSamplerHandle>(inStream));
+                    break;
+                case EDataType::DataReference:
+                    scene.setDataReference(i, f, ReadHandle<DataInstanceHandle>(inStream));
+                    break;
+                case EDataType::Indices:
+                case EDataType::UInt16Buffer:
+                case EDataType::FloatBuffer:
+                case EDataType::Vector2Buffer:
+                case EDataType::Vector3Buffer:
+                case EDataType::Vector4Buffer:
+                {
+                    ResourceField dataResource;
+                    inStream >> dataResource.hash;
+                    dataResource.dataBuffer = ReadHandle<DataBufferHandle>(inStream);
+                    inStream >> dataResource.instancingDivisor >> dataResource.offsetWithinElementInBytes >> dataResource.stride;
+                    if (dataResource.hash.isValid() || dataResource.dataBuffer.isValid())
+                        scene.setDataResource(i, f, dataResource.hash, dataResource.dataBuffer, dataResource.instancingDivisor, dataResource.offsetWithinElementInBytes, dataResource.stride);
+                    break;
+                }
+                default:
+                {
+                    // all values of field read at once, data instance memory is zero initialized so zeroes can be skipped
+                    valueBuffer.resize(field.elementCount * EnumToSize(field.dataType));
+                    inStream.read(valueBuffer.data(), valueBuffer.size());
+                    if (!valueBuffer.empty() && !MemoryUtils::AreAllBytesZero(valueBuffer.data(), static_cast<UInt32>(valueBuffer.size())))
+                        SetDataFieldValue(scene, i, f, field.dataType, field.elementCount, valueBuffer.data());
+                    break;
+                }
+                }
+            }
+        }
+
+        return inStream.getState() == EStatus::Ok;
+    }
+
+    static void WriteSnapshotCameras(IOutputStream& outStream, const IScene& scene)
+    {
+        std::vector<SnapshotCamera> cameras;
+        cameras.reserve(scene.getCameraCount());
+        for (CameraHandle c(0u); c < scene.getCameraCount(); ++c)
+        {
+            if (scene.isCameraAllocated(c))
+            {
+                const Camera& camera = scene.getCamera(c);
+                cameras.push_back({ c, static_cast<UInt32>(camera.projectionType), camera.node, camera.dataInstance });
+            }
+        }
+
+        WriteArray(outStream, cameras);
+    }
+
+    static bool ReadSnapshotCameras(IInputStream& inStream, IScene& scene)
+    {
+        std::vector<SnapshotCamera> cameras;
+        ReadArray(inStream, cameras);
+        if (inStream.getState() != EStatus::Ok)
+            return false;
+
+        for (const auto& c : cameras)
+            scene.allocateCamera(static_cast<ECameraProjectionType>(c.projectionType), c.node, c.dataInstance, c.handle);
+
+        return true;
+    }
+
+    void ScenePersistation::WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        outStream << gSceneSnapshotMarker;
+        WriteSceneSizeInformation(outStream, scene.getSceneSizeInformation());
+
+        // pools holding most of scene data are written as arrays of objects per type,
+        // this allows to presize the scene and restore objects without scene action round trip when loading
+        WriteSnapshotNodes(outStream, scene);
+        WriteSnapshotTransforms(outStream, scene);
+        WriteSnapshotRenderables(outStream, scene);
+        WriteSnapshotRenderStates(outStream, scene);
+        WriteSnapshotDataLayouts(outStream, scene);
+        WriteSnapshotDataInstances(outStream, scene);
+        WriteSnapshotCameras(outStream, scene);
+
+        // remaining objects (incl. animation systems which are polymorphic) are stored as scene actions
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator(collection);
+        SceneDescriber::describeObjectsNotInSnapshot(scene, creator);
+        WriteSceneActionCollection(outStream, collection);
+    }
+
+    void ScenePersistation::WriteSceneActionsToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator(collection);
+        creator.preallocateSceneSize(scene.getSceneSizeInformation());
+        SceneDescriber::describeScene<ClientScene>(scene, creator);
+
+        outStream << static_cast<UInt32>(gSceneMarker);
+        WriteSceneActionCollection(outStream, collection);
+    }
+
     void ScenePersistation::WriteSceneToFile(const String& filename, const ClientScene& scene)
     {
         File f(filename);
@@ -117,39 +734,24 @@ namespace ramses_internal
     {
         UInt32 sceneMarker = 0;
         inStream >> sceneMarker;
+        if (sceneMarker == gSceneSnapshotMarker)
+        {
+            ReadSceneSnapshotFromStream(inStream, scene, animSystemFactory);
+            return;
+        }
         if (sceneMarker != gSceneMarker)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
             return;
         }
 
-        UInt32 numberOfSceneActionsToRead = 0;
-        inStream >> numberOfSceneActionsToRead;
-        UInt32 sizeOfAllSceneActions = 0;
-        inStream >> sizeOfAllSceneActions;
-
-        SceneActionCollection actions(0, numberOfSceneActionsToRead);
-
-        // read data
-        std::vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
-        rawActionData.resize(sizeOfAllSceneActions);
-        inStream.read(reinterpret_cast<char*>(rawActionData.data()), static_cast<UInt32>(rawActionData.size()));
-
+        // legacy format, whole scene stored as scene actions
+        SceneActionCollection actions;
         std::array<uint32_t, NumOfSceneActionTypes> objectCounts = {};
-
-        // read types and offsets
-        for (UInt32 i = 0; i < numberOfSceneActionsToRead; ++i)
-        {
-            UInt32 actionType = 0;
-            inStream >> actionType;
-            UInt32 offsetInCollection = 0;
-            inStream >> offsetInCollection;
-            actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
-            ++objectCounts[actionType];
-        }
+        ReadSceneActionCollection(inStream, actions, objectCounts);
 
         LOG_DEBUG_F(ramses_internal::CONTEXT_PROFILING, ([&](ramses_internal::StringOutputStream& sos) {
-                    sos << "ScenePersistation::ReadSceneFromStream: SceneAction type counts for SceneID " << scene.getSceneId() << " (total: " << numberOfSceneActionsToRead << ")\n";
+                    sos << "ScenePersistation::ReadSceneFromStream: SceneAction type counts for SceneID " << scene.getSceneId() << " (total: " << actions.numberOfActions() << ")\n";
                     for (uint32_t i = 0; i < NumOfSceneActionTypes; i++)
                     {
                         if (objectCounts[i] > 0)
@@ -162,6 +764,45 @@ namespace ramses_internal
         SceneActionApplier::ApplyActionsOnScene(scene, actions, animSystemFactory);
     }
 
+    void ScenePersistation::ReadSceneSnapshotFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    {
+        SceneSizeInformation sizeInfo;
+        ReadSceneSizeInformation(inStream, sizeInfo);
+        if (inStream.getState() != EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream: failed to read scene snapshot header");
+            return;
+        }
+        scene.preallocateSceneSize(sizeInfo);
+
+        if (!ReadSnapshotNodes(inStream, scene) ||
+            !ReadSnapshotTransforms(inStream, scene) ||
+            !ReadSnapshotRenderables(inStream, scene) ||
+            !ReadSnapshotRenderStates(inStream, scene) ||
+            !ReadSnapshotDataLayouts(inStream, scene) ||
+            !ReadSnapshotDataInstances(inStream, scene) ||
+            !ReadSnapshotCameras(inStream, scene))
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream: failed to read scene snapshot, scene is incomplete");
+            return;
+        }
+
+        SceneActionCollection actions;
+        std::array<uint32_t, NumOfSceneActionTypes> objectCounts = {};
+        ReadSceneActionCollection(inStream, actions, objectCounts);
+        if (inStream.getState() != EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream: failed to read scene actions of scene snapshot, scene is incomplete");
+            return;
+        }
+
+        LOG_DEBUG(CONTEXT_PROFILING, "ScenePersistation::ReadSceneFromStream: restored scene snapshot for SceneID " << scene.getSceneId()
+            << " with " << scene.getNodeCount() << " nodes, " << scene.getRenderableCount() << " renderables, " << scene.getDataInstanceCount()
+            << " data instances and " << actions.numberOfActions() << " remaining scene actions");
+
+        SceneActionApplier::ApplyActionsOnScene(scene, actions, animSystemFactory);
+    }
+
     void ScenePersistation::ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory)
     {
         File f(filename);
@@ -10,8 +10,69 @@
 #include "Utils/MemoryPoolExplicit.h"
 #include "Utils/MemoryPool.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSES_TRANSFORMATION_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RAMSES_TRANSFORMATION_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace ramses_internal
 {
+    static Matrix33f GetRotationMatrix(const TopologyTransform& transform)
+    {
+        // most transforms only translate or scale, avoid trigonometric functions for them
+        if (transform.rotation == Vector3(0.f))
+            return Matrix33f::Identity;
+        return Matrix33f::RotationEuler(transform.rotation, transform.rotationConvention);
+    }
+
+    // Computes result = parent * Translation * Scaling * Rotation. The local matrix is affine, so every column of result
+    // is a linear combination of parent columns, computed for all 4 rows at once. Result may alias parent.
+    static void MultiplyWithLocalTransform(const Matrix44f& parent, const Vector3& t, const Vector3& s, const Matrix33f& r, Matrix44f& result)
+    {
+#if defined(RAMSES_TRANSFORMATION_SSE2)
+        const __m128 p0 = _mm_loadu_ps(&parent.data[0]);
+        const __m128 p1 = _mm_loadu_ps(&parent.data[4]);
+        const __m128 p2 = _mm_loadu_ps(&parent.data[8]);
+        const __m128 p3 = _mm_loadu_ps(&parent.data[12]);
+        const auto combine = [&](Float a, Float b, Float c) {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(p0, _mm_set1_ps(a)), _mm_mul_ps(p1, _mm_set1_ps(b))), _mm_mul_ps(p2, _mm_set1_ps(c)));
+        };
+        _mm_storeu_ps(&result.data[0], combine(s.x * r.m11, s.y * r.m21, s.z * r.m31));
+        _mm_storeu_ps(&result.data[4], combine(s.x * r.m12, s.y * r.m22, s.z * r.m32));
+        _mm_storeu_ps(&result.data[8], combine(s.x * r.m13, s.y * r.m23, s.z * r.m33));
+        _mm_storeu_ps(&result.data[12], _mm_add_ps(combine(t.x, t.y, t.z), p3));
+#elif defined(RAMSES_TRANSFORMATION_NEON)
+        const float32x4_t p0 = vld1q_f32(&parent.data[0]);
+        const float32x4_t p1 = vld1q_f32(&parent.data[4]);
+        const float32x4_t p2 = vld1q_f32(&parent.data[8]);
+        const float32x4_t p3 = vld1q_f32(&parent.data[12]);
+        const auto combine = [&](Float a, Float b, Float c) {
+            return vaddq_f32(vaddq_f32(vmulq_n_f32(p0, a), vmulq_n_f32(p1, b)), vmulq_n_f32(p2, c));
+        };
+        vst1q_f32(&result.data[0], combine(s.x * r.m11, s.y * r.m21, s.z * r.m31));
+        vst1q_f32(&result.data[4], combine(s.x * r.m12, s.y * r.m22, s.z * r.m32));
+        vst1q_f32(&result.data[8], combine(s.x * r.m13, s.y * r.m23, s.z * r.m33));
+        vst1q_f32(&result.data[12], vaddq_f32(combine(t.x, t.y, t.z), p3));
+#else
+        const Matrix44f p = parent;
+        const Float local[4][3] = {
+            { s.x * r.m11, s.y * r.m21, s.z * r.m31 },
+            { s.x * r.m12, s.y * r.m22, s.z * r.m32 },
+            { s.x * r.m13, s.y * r.m23, s.z * r.m33 },
+            { t.x,         t.y,         t.z } };
+        for (UInt32 column = 0u; column < 4u; ++column)
+        {
+            for (UInt32 row = 0u; row < 4u; ++row)
+                result.data[4u * column + row] = p.data[row] * local[column][0] + p.data[4u + row] * local[column][1] + p.data[8u + row] * local[column][2];
+        }
+        for (UInt32 row = 0u; row < 4u; ++row)
+            result.data[12u + row] += p.data[12u + row];
+#endif
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     TransformationCachedSceneT<MEMORYPOOL>::TransformationCachedSceneT(const SceneInfo& sceneInfo)
         : SceneT<MEMORYPOOL>(sceneInfo)
@@ -23,7 +84,6 @@ namespace ramses_internal
     {
         SceneT<MEMORYPOOL>::preallocateSceneSize(sizeInfo);
 
-        m_nodeToTransformMap.reserve(sizeInfo.transformCount);
         m_matrixCachePool.preallocateSize(sizeInfo.nodeCount);
     }
 
@@ -46,7 +106,7 @@ namespace ramses_internal
     {
         assert(nodeHandle.isValid());
         const TransformHandle actualHandle = SceneT<MEMORYPOOL>::allocateTransform(nodeHandle, handle);
-        m_nodeToTransformMap.put(nodeHandle, actualHandle);
+        getMatrixCacheEntry(nodeHandle).m_transform = actualHandle;
         propagateDirty(nodeHandle);
         return actualHandle;
     }
@@ -57,6 +117,9 @@ namespace ramses_internal
         const NodeHandle nodeHandle = this->getTransformNode(transform);
         assert(nodeHandle.isValid());
         SceneT<MEMORYPOOL>::releaseTransform(transform);
+        MatrixCacheEntry& matrixCache = getMatrixCacheEntry(nodeHandle);
+        if (matrixCache.m_transform == transform)
+            matrixCache.m_transform = TransformHandle::Invalid();
         propagateDirty(nodeHandle);
     }
 
@@ -102,7 +165,6 @@ namespace ramses_internal
     void TransformationCachedSceneT<MEMORYPOOL>::releaseNode(NodeHandle node)
     {
         m_matrixCachePool.release(node);
-        m_nodeToTransformMap.remove(node);
         SceneT<MEMORYPOOL>::releaseNode(node);
     }
 
@@ -143,7 +205,7 @@ namespace ramses_internal
             const NodeHandle dirtyNode = dirtyNodes[i];
             MatrixCacheEntry& matrixCache = getMatrixCacheEntry(dirtyNode);
             if (!matrixCache.m_isIdentity)
-                computeMatrixForNode(matrixType, dirtyNode, chainMatrix);
+                computeMatrixForNode(matrixType, matrixCache, chainMatrix);
             setMatrixCache(matrixType, matrixCache, chainMatrix);
         }
     }
@@ -159,16 +221,70 @@ namespace ramses_internal
 
 
     template <template<typename, typename> class MEMORYPOOL>
-    void TransformationCachedSceneT<MEMORYPOOL>::computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const
+    void TransformationCachedSceneT<MEMORYPOOL>::updateWorldMatrixCaches(const NodeHandleVector& nodes) const
+    {
+        m_worldMatrixBatch.clear();
+        for (const auto node : nodes)
+        {
+            const Matrix44f* parentMatrix = &findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(ETransformationMatrixType_World, node, m_dirtyNodes);
+            // dirty nodes are scheduled root first and marked clean right away, so that chains of following nodes end there
+            for (auto it = m_dirtyNodes.crbegin(); it != m_dirtyNodes.crend(); ++it)
+            {
+                MatrixCacheEntry& matrixCache = getMatrixCacheEntry(*it);
+                appendToWorldMatrixBatch(matrixCache, *parentMatrix);
+                matrixCache.m_matrixDirty[ETransformationMatrixType_World] = false;
+                parentMatrix = &matrixCache.m_matrix[ETransformationMatrixType_World];
+            }
+        }
+
+        const WorldMatrixBatch& batch = m_worldMatrixBatch;
+        const size_t batchSize = batch.worldMatrices.size();
+        for (size_t i = 0u; i < batchSize; ++i)
+            MultiplyWithLocalTransform(*batch.parentMatrices[i], batch.translations[i], batch.scalings[i], batch.rotations[i], *batch.worldMatrices[i]);
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::appendToWorldMatrixBatch(MatrixCacheEntry& matrixCache, const Matrix44f& parentMatrix) const
+    {
+        // nodes without transform are batched with identity transform to keep computation uniform
+        if (!matrixCache.m_isIdentity && matrixCache.m_transform.isValid())
+        {
+            const auto& transform = SceneT<MEMORYPOOL>::getTransform(matrixCache.m_transform);
+            m_worldMatrixBatch.translations.push_back(transform.translation);
+            m_worldMatrixBatch.scalings.push_back(transform.scaling);
+            m_worldMatrixBatch.rotations.push_back(GetRotationMatrix(transform));
+        }
+        else
+        {
+            m_worldMatrixBatch.translations.push_back(Vector3(0.f));
+            m_worldMatrixBatch.scalings.push_back(Vector3(1.f));
+            m_worldMatrixBatch.rotations.push_back(Matrix33f::Identity);
+        }
+        m_worldMatrixBatch.parentMatrices.push_back(&parentMatrix);
+        m_worldMatrixBatch.worldMatrices.push_back(&matrixCache.m_matrix[ETransformationMatrixType_World]);
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::WorldMatrixBatch::clear()
+    {
+        translations.clear();
+        scalings.clear();
+        rotations.clear();
+        parentMatrices.clear();
+        worldMatrices.clear();
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::computeMatrixForNode(ETransformationMatrixType matrixType, const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const
     {
         switch (matrixType)
         {
         case ETransformationMatrixType_World:
-            computeWorldMatrixForNode(node, chainMatrix);
+            computeWorldMatrixForNode(matrixCache, chainMatrix);
             break;
 
         case ETransformationMatrixType_Object:
-            computeObjectMatrixForNode(node, chainMatrix);
+            computeObjectMatrixForNode(matrixCache, chainMatrix);
             break;
         default:
             assert(false);
@@ -220,32 +336,31 @@ namespace ramses_internal
     }
 
     template <template<typename, typename> class MEMORYPOOL>
-    void TransformationCachedSceneT<MEMORYPOOL>::computeWorldMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const
+    void TransformationCachedSceneT<MEMORYPOOL>::computeWorldMatrixForNode(const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const
     {
-        const TransformHandle* transformHandlePtr = m_nodeToTransformMap.get(node);
-        if (transformHandlePtr != nullptr)
+        if (matrixCache.m_transform.isValid())
         {
-            const auto& transform = SceneT<MEMORYPOOL>::getTransform(*transformHandlePtr);
-            const Matrix44f matrix =
-                Matrix44f::Translation(transform.translation) *
-                Matrix44f::Scaling(transform.scaling) *
-                Matrix44f::RotationEuler(transform.rotation, transform.rotationConvention);
-
-            chainMatrix *= matrix;
+            const auto& transform = SceneT<MEMORYPOOL>::getTransform(matrixCache.m_transform);
+            MultiplyWithLocalTransform(chainMatrix, transform.translation, transform.scaling, GetRotationMatrix(transform), chainMatrix);
         }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
-    void TransformationCachedSceneT<MEMORYPOOL>::computeObjectMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const
+    void TransformationCachedSceneT<MEMORYPOOL>::computeObjectMatrixForNode(const MatrixCacheEntry& matrixCache, Matrix44f& chainMatrix) const
     {
-        const TransformHandle* transformHandlePtr = m_nodeToTransformMap.get(node);
-        if (transformHandlePtr != nullptr)
+        if (matrixCache.m_transform.isValid())
         {
-            const auto& transform = SceneT<MEMORYPOOL>::getTransform(*transformHandlePtr);
-            const Matrix44f matrix =
-                Matrix44f::RotationEuler(transform.rotation, transform.rotationConvention).transpose() *
-                Matrix44f::Scaling(transform.scaling.inverse()) *
-                Matrix44f::Translation(-transform.translation);
+            const auto& transform = SceneT<MEMORYPOOL>::getTransform(matrixCache.m_transform);
+
+            // Rotation^T * Scaling^-1 * Translation^-1 composed directly, inverse scaling scales columns of transposed rotation
+            const Vector3 s = transform.scaling.inverse();
+            const Vector3 t = -transform.translation;
+            const Matrix33f r = GetRotationMatrix(transform);
+            const Matrix44f matrix(
+                r.m11 * s.x, r.m21 * s.y, r.m31 * s.z, r.m11 * s.x * t.x + r.m21 * s.y * t.y + r.m31 * s.z * t.z,
+                r.m12 * s.x, r.m22 * s.y, r.m32 * s.z, r.m12 * s.x * t.x + r.m22 * s.y * t.y + r.m32 * s.z * t.z,
+                r.m13 * s.x, r.m23 * s.y, r.m33 * s.z, r.m13 * s.x * t.x + r.m23 * s.y * t.y + r.m33 * s.z * t.z,
+                0.f,         0.f,         0.f,         1.f);
 
             chainMatrix = matrix * chainMatrix;
         }
@@ -197,6 +197,7 @@ namespace ramses_internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        virtual void                        setRenderPassFrustumCulling     (RenderPassHandle passHandle, bool enable) override;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order) override;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         virtual const RenderPass&           getRenderPass                   (RenderPassHandle passHandle) const override;
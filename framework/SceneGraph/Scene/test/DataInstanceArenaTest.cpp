@@ -0,0 +1,138 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Scene/DataInstanceArena.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramses_internal
+{
+    class ADataInstanceArena : public testing::Test
+    {
+    protected:
+        DataInstanceArena arena;
+        const DataLayoutHandle layout1{ 1u };
+        const DataLayoutHandle layout2{ 3u };
+    };
+
+    TEST_F(ADataInstanceArena, returnsNullForEmptyData)
+    {
+        EXPECT_EQ(nullptr, arena.allocate(layout1, 0u));
+        EXPECT_EQ(0u, arena.getNumberOfChunks());
+        arena.release(layout1, nullptr);
+    }
+
+    TEST_F(ADataInstanceArena, providesZeroInitializedAlignedMemory)
+    {
+        Byte* data1 = arena.allocate(layout1, 20u);
+        ASSERT_NE(nullptr, data1);
+        EXPECT_TRUE(std::all_of(data1, data1 + 20u, [](Byte b) { return b == 0u; }));
+        std::fill(data1, data1 + 20u, Byte(0xAB));
+        arena.release(layout1, data1);
+
+        Byte* data2 = arena.allocate(layout1, 20u);
+        EXPECT_TRUE(std::all_of(data2, data2 + 20u, [](Byte b) { return b == 0u; }));
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(data2) % alignof(std::max_align_t));
+        arena.release(layout1, data2);
+    }
+
+    TEST_F(ADataInstanceArena, storesInstancesOfSameLayoutContiguously)
+    {
+        Byte* data1 = arena.allocate(layout1, 32u);
+        Byte* data2 = arena.allocate(layout2, 32u);
+        Byte* data3 = arena.allocate(layout1, 32u);
+
+        EXPECT_EQ(data1 + 32u, data3);
+        EXPECT_EQ(2u, arena.getNumberOfChunks());
+
+        arena.release(layout1, data1);
+        arena.release(layout2, data2);
+        arena.release(layout1, data3);
+    }
+
+    TEST_F(ADataInstanceArena, reusesReleasedSlots)
+    {
+        Byte* data1 = arena.allocate(layout1, 16u);
+        Byte* data2 = arena.allocate(layout1, 16u);
+        arena.release(layout1, data1);
+        EXPECT_EQ(data1, arena.allocate(layout1, 16u));
+        arena.release(layout1, data2);
+    }
+
+    TEST_F(ADataInstanceArena, growsChunksGeometricallyUpToLimit)
+    {
+        std::vector<Byte*> instances;
+        for (UInt32 i = 0u; i < 1000u; ++i)
+            instances.push_back(arena.allocate(layout1, 16u));
+
+        // 8 + 16 + 32 + 64 + 128 + 256 + 256 + 256 slots
+        EXPECT_EQ(8u, arena.getNumberOfChunks());
+        EXPECT_EQ(1016u * 16u, arena.getAllocatedMemorySize());
+
+        for (auto data : instances)
+            arena.release(layout1, data);
+    }
+
+    TEST_F(ADataInstanceArena, usesBiggerChunksWhenPreallocatedForManyInstances)
+    {
+        arena.preallocate(50000u);
+
+        std::vector<Byte*> instances;
+        for (UInt32 i = 0u; i < 50000u; ++i)
+            instances.push_back(arena.allocate(layout1, 16u));
+
+        // 8 + 16 + ... + 2048 slots, then 12 chunks of 4096 slots
+        EXPECT_EQ(21u, arena.getNumberOfChunks());
+
+        for (auto data : instances)
+            arena.release(layout1, data);
+    }
+
+    TEST_F(ADataInstanceArena, freesChunksWhichBecomeEmptyExceptLastOne)
+    {
+        std::vector<Byte*> instances;
+        for (UInt32 i = 0u; i < 30u; ++i)
+            instances.push_back(arena.allocate(layout1, 16u));
+        EXPECT_EQ(3u, arena.getNumberOfChunks());
+
+        // release all instances of first chunk
+        for (UInt32 i = 0u; i < 8u; ++i)
+            arena.release(layout1, instances[i]);
+        EXPECT_EQ(2u, arena.getNumberOfChunks());
+
+        for (UInt32 i = 8u; i < 30u; ++i)
+            arena.release(layout1, instances[i]);
+        EXPECT_EQ(1u, arena.getNumberOfChunks());
+
+        arena.releaseLayout(layout1);
+        EXPECT_EQ(0u, arena.getNumberOfChunks());
+        EXPECT_EQ(0u, arena.getAllocatedMemorySize());
+    }
+
+    TEST_F(ADataInstanceArena, keepsMemoryOfReleasedLayoutIfStillUsedByInstance)
+    {
+        Byte* data = arena.allocate(layout1, 16u);
+        arena.releaseLayout(layout1);
+        EXPECT_EQ(1u, arena.getNumberOfChunks());
+        arena.release(layout1, data);
+    }
+
+    TEST_F(ADataInstanceArena, canReuseLayoutHandleForDifferentSizeAfterAllInstancesReleased)
+    {
+        Byte* data = arena.allocate(layout1, 16u);
+        arena.release(layout1, data);
+
+        data = arena.allocate(layout1, 64u);
+        EXPECT_EQ(1u, arena.getNumberOfChunks());
+        EXPECT_EQ(8u * 64u, arena.getAllocatedMemorySize());
+        arena.release(layout1, data);
+    }
+}
@@ -75,8 +75,31 @@ namespace ramses_internal
             EXPECT_EQ(expectedSceneResourcesByteSize, fromSceneSceneResourcesByteSize);
         }
 
+        ResourceChanges collectClientResourceChanges() const
+        {
+            ResourceChanges changes;
+            scene.collectClientResourceChanges(changes);
+            return changes;
+        }
+
+        void expectSameClientResourceChangesAsDiffedFromScene()
+        {
+            ResourceContentHashVector resourcesInScene;
+            ResourceUtils::GetAllResourcesFromScene(resourcesInScene, scene);
+            ResourceChanges fromScene;
+            ResourceUtils::DiffResources(resourcesAtLastReset, resourcesInScene, fromScene);
+
+            const ResourceChanges collected = collectClientResourceChanges();
+            EXPECT_EQ(fromScene.m_resourcesAdded, collected.m_resourcesAdded);
+            EXPECT_EQ(fromScene.m_resourcesRemoved, collected.m_resourcesRemoved);
+
+            resourcesAtLastReset.swap(resourcesInScene);
+            scene.resetResourceChanges();
+        }
+
         ResourceChangeCollectingScene scene;
         const SceneResourceActionVector& sceneResourceActions;
+        ResourceContentHashVector resourcesAtLastReset;
 
         const DataLayoutHandle testUniformLayout;
         const DataLayoutHandle testGeometryLayout;
@@ -502,4 +525,101 @@ namespace ramses_internal
         scene.releaseStreamTexture(streamTex);
         EXPECT_TRUE(scene.haveResourcesChanged());
     }
+
+    TEST_F(AResourceChangeCollectingScene, collectsNoClientResourceChangesOnCreation)
+    {
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesAdded.empty());
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesRemoved.empty());
+    }
+
+    TEST_F(AResourceChangeCollectingScene, collectsDataResourceOfRenderableAsAddedAndAsRemovedWhenRenderableTurnedOff)
+    {
+        const ResourceContentHash hash(123u, 0u);
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle dataInstance = createVertexDataInstance(renderable);
+        scene.setDataResource(dataInstance, vertAttribField, hash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        EXPECT_EQ(ResourceContentHashVector{ hash }, collectClientResourceChanges().m_resourcesAdded);
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesRemoved.empty());
+        scene.resetResourceChanges();
+
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Off);
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesAdded.empty());
+        EXPECT_EQ(ResourceContentHashVector{ hash }, collectClientResourceChanges().m_resourcesRemoved);
+    }
+
+    TEST_F(AResourceChangeCollectingScene, doesNotCollectTextureOfSamplerNotUsedByAnyRenderable)
+    {
+        const ResourceContentHash hash(123u, 0u);
+        scene.allocateTextureSampler({ {}, hash });
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesAdded.empty());
+
+        const RenderableHandle renderable = createRenderable();
+        createUniformDataInstanceWithSampler(renderable, hash);
+        EXPECT_EQ(ResourceContentHashVector{ hash }, collectClientResourceChanges().m_resourcesAdded);
+    }
+
+    TEST_F(AResourceChangeCollectingScene, collectsNoChangeIfResourceRemovedAndAddedAgainBeforeReset)
+    {
+        const ResourceContentHash hash(123u, 0u);
+        const DataSlotHandle dataSlot = scene.allocateDataSlot({ EDataSlotType_TextureProvider, DataSlotId(0u), NodeHandle(), DataInstanceHandle(), hash, TextureSamplerHandle() });
+        scene.resetResourceChanges();
+
+        scene.setDataSlotTexture(dataSlot, { 456u, 0u });
+        scene.setDataSlotTexture(dataSlot, hash);
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesAdded.empty());
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesRemoved.empty());
+    }
+
+    TEST_F(AResourceChangeCollectingScene, collectsResourceAsRemovedOnlyWhenLastUserReleased)
+    {
+        const ResourceContentHash hash(123u, 0u);
+        const StreamTextureHandle streamTex = scene.allocateStreamTexture(WaylandIviSurfaceId{ 0u }, hash);
+        const DataSlotHandle dataSlot = scene.allocateDataSlot({ EDataSlotType_TextureProvider, DataSlotId(0u), NodeHandle(), DataInstanceHandle(), hash, TextureSamplerHandle() });
+        scene.resetResourceChanges();
+
+        scene.releaseStreamTexture(streamTex);
+        EXPECT_TRUE(collectClientResourceChanges().m_resourcesRemoved.empty());
+        scene.releaseDataSlot(dataSlot);
+        EXPECT_EQ(ResourceContentHashVector{ hash }, collectClientResourceChanges().m_resourcesRemoved);
+    }
+
+    TEST_F(AResourceChangeCollectingScene, collectsSameClientResourceChangesAsDiffedFromWholeScene)
+    {
+        const RenderableHandle renderable1 = createRenderable();
+        const RenderableHandle renderable2 = createRenderable();
+        const DataInstanceHandle uniforms = createUniformDataInstanceWithSampler(renderable1, { 1u, 0u });
+        scene.setRenderableDataInstance(renderable2, ERenderableDataSlotType_Uniforms, uniforms);
+        const DataInstanceHandle geometry = createVertexDataInstance(renderable1);
+        scene.setDataResource(geometry, indicesField, { 2u, 0u }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometry, vertAttribField, { 3u, 0u }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.allocateStreamTexture(WaylandIviSurfaceId{ 0u }, { 4u, 0u });
+        expectSameClientResourceChangesAsDiffedFromScene();
+
+        // sampler shared by two renderables
+        scene.setRenderableVisibility(renderable1, EVisibilityMode::Off);
+        expectSameClientResourceChangesAsDiffedFromScene();
+        scene.setRenderableVisibility(renderable2, EVisibilityMode::Off);
+        expectSameClientResourceChangesAsDiffedFromScene();
+        scene.setRenderableVisibility(renderable1, EVisibilityMode::Invisible);
+        expectSameClientResourceChangesAsDiffedFromScene();
+
+        // swap texture and vertex data of used data instances
+        const TextureSamplerHandle oldSampler = scene.getDataTextureSamplerHandle(uniforms, samplerField);
+        scene.setDataTextureSamplerHandle(uniforms, samplerField, scene.allocateTextureSampler({ {}, { 5u, 0u } }));
+        scene.releaseTextureSampler(oldSampler);
+        scene.setDataResource(geometry, vertAttribField, { 4u, 0u }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectSameClientResourceChangesAsDiffedFromScene();
+
+        // release data instance while still referenced by renderable, then reallocate it with same handle
+        scene.releaseDataInstance(geometry);
+        expectSameClientResourceChangesAsDiffedFromScene();
+        scene.allocateDataInstance(testGeometryLayout, geometry);
+        scene.setDataResource(geometry, vertAttribField, { 6u, 0u }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectSameClientResourceChangesAsDiffedFromScene();
+
+        scene.releaseRenderable(renderable1);
+        expectSameClientResourceChangesAsDiffedFromScene();
+        scene.setRenderableVisibility(renderable2, EVisibilityMode::Visible);
+        expectSameClientResourceChangesAsDiffedFromScene();
+    }
 }
@@ -463,4 +463,25 @@ namespace ramses_internal
         EXPECT_EQ(resultAdded, changes.m_resourcesAdded);
         EXPECT_EQ(resultRemoved, changes.m_resourcesRemoved);
     }
+
+    TEST(ASceneResourceUtilsApplyChangesFunction, outputsOldWithEmptyChanges)
+    {
+        const ResourceContentHashVector old{ {0, 111}, {0, 222}, {0, 333} };
+        ResourceContentHashVector current;
+
+        ResourceUtils::ApplyResourceChanges(old, ResourceChanges{}, current);
+        EXPECT_EQ(old, current);
+    }
+
+    TEST(ASceneResourceUtilsApplyChangesFunction, isInverseOfDiff)
+    {
+        const ResourceContentHashVector old{ {0, 111}, {0, 222}, {0, 333}, {0, 444}, {0, 555}, {0, 999} };
+        const ResourceContentHashVector expected{ {0, 333}, {0, 555}, {0, 666}, {0, 777}, {0, 888}, {0, 999} };
+        ResourceChanges changes;
+        ResourceUtils::DiffResources(old, expected, changes);
+
+        ResourceContentHashVector current;
+        ResourceUtils::ApplyResourceChanges(old, changes, current);
+        EXPECT_EQ(expected, current);
+    }
 }
@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneActionCoalescer.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "gtest/gtest.h"
+
+namespace ramses_internal
+{
+    class ASceneActionCoalescer : public ::testing::Test
+    {
+    public:
+        ASceneActionCoalescer()
+            : creator(collection)
+        {
+        }
+
+    protected:
+        void expectActionTypes(const std::vector<ESceneActionId>& expectedTypes) const
+        {
+            ASSERT_EQ(expectedTypes.size(), collection.numberOfActions());
+            for (UInt32 i = 0u; i < expectedTypes.size(); ++i)
+                EXPECT_EQ(expectedTypes[i], collection[i].type());
+        }
+
+        Vector3 readTransformValue(UInt32 actionIdx) const
+        {
+            auto reader = collection[actionIdx];
+            UInt32 component = 0u;
+            TransformHandle transform;
+            Vector3 value;
+            reader.read(component);
+            reader.read(transform);
+            reader.read(value.data);
+            return value;
+        }
+
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator;
+        SceneActionCoalescer coalescer;
+
+        const TransformHandle transform1{ 1u };
+        const TransformHandle transform2{ 2u };
+        const DataInstanceHandle dataInstance{ 3u };
+        const DataFieldHandle field{ 0u };
+    };
+
+    TEST_F(ASceneActionCoalescer, doesNotChangeEmptyCollection)
+    {
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(0u, result.numRemovedActions);
+        EXPECT_EQ(0u, result.numRemovedBytes);
+        EXPECT_TRUE(collection.empty());
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOnlyLastWriteOfSameProperty)
+    {
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(1.f), ERotationConvention::XYZ);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(2.f), ERotationConvention::XYZ);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(3.f), ERotationConvention::XYZ);
+        const UInt32 actionSize = collection[0].size();
+
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(2u, result.numRemovedActions);
+        EXPECT_EQ(2u * actionSize, result.numRemovedBytes);
+        expectActionTypes({ ESceneActionId::SetTransformComponent });
+        EXPECT_EQ(Vector3(3.f), readTransformValue(0u));
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsWritesOfDifferentPropertiesOrObjects)
+    {
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(1.f), ERotationConvention::XYZ);
+        creator.setTransformComponent(ETransformPropertyType_Scaling, transform1, Vector3(2.f), ERotationConvention::XYZ);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform2, Vector3(3.f), ERotationConvention::XYZ);
+
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(0u, result.numRemovedActions);
+        EXPECT_EQ(3u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOrderOfRemainingActions)
+    {
+        creator.allocateTransform(NodeHandle(0u), transform1);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(1.f), ERotationConvention::XYZ);
+        creator.releaseTransform(transform1);
+        creator.allocateTransform(NodeHandle(0u), transform1);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(2.f), ERotationConvention::XYZ);
+
+        coalescer.coalesce(collection);
+        expectActionTypes({ ESceneActionId::AllocateTransform, ESceneActionId::ReleaseTransform, ESceneActionId::AllocateTransform, ESceneActionId::SetTransformComponent });
+        EXPECT_EQ(Vector3(2.f), readTransformValue(3u));
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsArrayWritesWithDifferentElementCount)
+    {
+        const Float values[] = { 1.f, 2.f, 3.f };
+        creator.setDataFloatArray(dataInstance, field, 3u, values);
+        creator.setDataFloatArray(dataInstance, field, 1u, values);
+
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(0u, result.numRemovedActions);
+        EXPECT_EQ(2u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, removesArrayWritesWithSameElementCount)
+    {
+        const Float values[] = { 1.f, 2.f, 3.f };
+        creator.setDataFloatArray(dataInstance, field, 3u, values);
+        creator.setDataFloatArray(dataInstance, DataFieldHandle(1u), 3u, values);
+        creator.setDataFloatArray(dataInstance, field, 3u, values);
+
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(1u, result.numRemovedActions);
+        EXPECT_EQ(2u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNotRemoveWritesAcrossAnimationSystemActions)
+    {
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(1.f), ERotationConvention::XYZ);
+        collection.beginWriteSceneAction(ESceneActionId::AnimationSystemSetTime);
+        collection.write(0u);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(2.f), ERotationConvention::XYZ);
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(3.f), ERotationConvention::XYZ);
+
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(1u, result.numRemovedActions);
+        expectActionTypes({ ESceneActionId::SetTransformComponent, ESceneActionId::AnimationSystemSetTime, ESceneActionId::SetTransformComponent });
+        EXPECT_EQ(Vector3(1.f), readTransformValue(0u));
+        EXPECT_EQ(Vector3(3.f), readTransformValue(2u));
+    }
+
+    TEST_F(ASceneActionCoalescer, canBeReusedForMultipleCollections)
+    {
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(1.f), ERotationConvention::XYZ);
+        coalescer.coalesce(collection);
+
+        creator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(2.f), ERotationConvention::XYZ);
+        const auto result = coalescer.coalesce(collection);
+        EXPECT_EQ(1u, result.numRemovedActions);
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(Vector3(2.f), readTransformValue(0u));
+
+        SceneActionCollection otherCollection;
+        SceneActionCollectionCreator otherCreator(otherCollection);
+        otherCreator.setTransformComponent(ETransformPropertyType_Translation, transform1, Vector3(3.f), ERotationConvention::XYZ);
+        EXPECT_EQ(0u, coalescer.coalesce(otherCollection).numRemovedActions);
+        EXPECT_EQ(1u, otherCollection.numberOfActions());
+    }
+}
@@ -584,4 +584,52 @@ namespace ramses_internal
         EXPECT_EQ(size_3, reader_3.size());
         EXPECT_EQ(c.collectionData().data() + size_1 + size_2, reader_3.data());
     }
+
+    TEST_F(ASceneActionCollection, eraseActionsKeepsOrderAndDataOfRemainingActions)
+    {
+        SceneActionCollection c;
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(1u);
+        c.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        c.write(2u);
+        c.write(3u);
+        c.beginWriteSceneAction(ESceneActionId::AllocateRenderable);
+        c.write(4u);
+        c.beginWriteSceneAction(ESceneActionId::AllocateTransform);
+        c.write(5u);
+
+        c.eraseActions({ true, false, true, false });
+
+        ASSERT_EQ(2u, c.numberOfActions());
+        EXPECT_EQ(3u * sizeof(UInt32), c.collectionData().size());
+
+        UInt32 value = 0u;
+        SceneActionCollection::SceneActionReader reader_1(c[0]);
+        EXPECT_EQ(ESceneActionId::AllocateNode, reader_1.type());
+        EXPECT_EQ(0u, reader_1.offsetInCollection());
+        EXPECT_EQ(2u * sizeof(UInt32), reader_1.size());
+        reader_1.read(value);
+        EXPECT_EQ(2u, value);
+        reader_1.read(value);
+        EXPECT_EQ(3u, value);
+
+        SceneActionCollection::SceneActionReader reader_2(c[1]);
+        EXPECT_EQ(ESceneActionId::AllocateTransform, reader_2.type());
+        EXPECT_EQ(2u * sizeof(UInt32), reader_2.offsetInCollection());
+        reader_2.read(value);
+        EXPECT_EQ(5u, value);
+    }
+
+    TEST_F(ASceneActionCollection, eraseAllActionsLeavesEmptyCollection)
+    {
+        SceneActionCollection c;
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(1u);
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(2u);
+
+        c.eraseActions({ true, true });
+        EXPECT_TRUE(c.empty());
+        EXPECT_EQ(0u, c.collectionData().size());
+    }
 }
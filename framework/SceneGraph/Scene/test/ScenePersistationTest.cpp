@@ -12,6 +12,11 @@
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "TestingScene.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/File.h"
+#include <chrono>
 
 using namespace testing;
 
@@ -42,4 +47,113 @@ namespace ramses_internal
         ScenePersistation::ReadSceneFromFile("testfile", loadedScene, &animSystemFactory);
         scene.CheckEquivalentTo<IScene>(loadedScene);
     }
+
+    TEST(AScenePersistation, canReadMockSceneWrittenInLegacySceneActionsFormat)
+    {
+        TestingScene<ClientScene> scene;
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneActionsToStream(outStream, scene.getScene());
+
+        Scene loadedScene;
+        SceneActionCollection dummyCollection;
+        AnimationSystemFactory animSystemFactory(EAnimationSystemOwner_Client, &dummyCollection);
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene, &animSystemFactory);
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST(AScenePersistation, restoresAllReferencesOfCompactedDataLayoutsIntoClientScene)
+    {
+        ClientScene scene;
+        const DataFieldInfoVector fields{ DataFieldInfo(EDataType::Vector3F, 2u), DataFieldInfo(EDataType::Int32) };
+        const DataLayoutHandle layout = scene.allocateDataLayout(fields, ResourceContentHash(11u, 12u), {});
+        EXPECT_EQ(layout, scene.allocateDataLayout(fields, ResourceContentHash(11u, 12u), {}));
+        const DataInstanceHandle instance = scene.allocateDataInstance(layout, {});
+        const Vector3 values[] = { Vector3(1.f, 2.f, 3.f), Vector3(4.f, 5.f, 6.f) };
+        scene.setDataVector3fArray(instance, DataFieldHandle(0u), 2u, values);
+        scene.setDataSingleInteger(instance, DataFieldHandle(1u), 13);
+
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneToStream(outStream, scene);
+
+        ClientScene loadedScene;
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+
+        EXPECT_EQ(2u, loadedScene.getNumDataLayoutReferences(layout));
+        ASSERT_TRUE(loadedScene.isDataInstanceAllocated(instance));
+        EXPECT_EQ(values[0], loadedScene.getDataVector3fArray(instance, DataFieldHandle(0u))[0]);
+        EXPECT_EQ(values[1], loadedScene.getDataVector3fArray(instance, DataFieldHandle(0u))[1]);
+        EXPECT_EQ(13, loadedScene.getDataSingleInteger(instance, DataFieldHandle(1u)));
+    }
+
+    TEST(AScenePersistation, doesNotRestoreObjectsFromTruncatedSnapshot)
+    {
+        TestingScene<ClientScene> scene;
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneToStream(outStream, scene.getScene());
+
+        // marker, 20 pool sizes, node count and first node handle only
+        const size_t truncatedSize = sizeof(UInt32) + 20u * sizeof(UInt32) + 2u * sizeof(UInt32);
+        ASSERT_GT(outStream.getSize(), truncatedSize);
+        {
+            File file("truncatedScene");
+            BinaryFileOutputStream fileStream(file);
+            fileStream.write(outStream.getData(), truncatedSize);
+        }
+
+        Scene loadedScene;
+        ScenePersistation::ReadSceneFromFile("truncatedScene", loadedScene);
+        EXPECT_FALSE(loadedScene.isNodeAllocated(scene.parent));
+        EXPECT_FALSE(loadedScene.isRenderableAllocated(scene.renderable));
+        EXPECT_FALSE(loadedScene.isCameraAllocated(scene.camera));
+
+        File("truncatedScene").remove();
+    }
+
+    TEST(AScenePersistation, recordsLoadTimeOfSceneSnapshotComparedToSceneActionReplay)
+    {
+        const UInt32 objectCount = 20000u;
+
+        ClientScene scene;
+        const DataFieldInfoVector fields{ DataFieldInfo(EDataType::Matrix44F), DataFieldInfo(EDataType::Vector4F) };
+        const DataLayoutHandle layout = scene.allocateDataLayout(fields, ResourceContentHash(1u, 2u), {});
+        const RenderStateHandle state = scene.allocateRenderState();
+        const NodeHandle root = scene.allocateNode();
+        for (UInt32 i = 0u; i < objectCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode();
+            scene.addChildToNode(root, node);
+            const TransformHandle transform = scene.allocateTransform(node);
+            scene.setTranslation(transform, Vector3(static_cast<Float>(i), 1.f, 2.f));
+            const DataInstanceHandle uniforms = scene.allocateDataInstance(layout);
+            scene.setDataSingleVector4f(uniforms, DataFieldHandle(1u), Vector4(1.f, 2.f, 3.f, static_cast<Float>(i)));
+            const RenderableHandle renderable = scene.allocateRenderable(node);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            scene.setRenderableRenderState(renderable, state);
+            scene.setRenderableIndexCount(renderable, 3u * i);
+        }
+
+        BinaryOutputStream actionsStream;
+        ScenePersistation::WriteSceneActionsToStream(actionsStream, scene);
+        BinaryOutputStream snapshotStream;
+        ScenePersistation::WriteSceneToStream(snapshotStream, scene);
+
+        const auto measureLoadTimeUs = [&](const BinaryOutputStream& outStream)
+        {
+            ClientScene loadedScene;
+            BinaryInputStream inStream(outStream.getData());
+            const auto startTime = std::chrono::steady_clock::now();
+            ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+            const auto durationUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+            EXPECT_EQ(objectCount, loadedScene.getRenderableCount());
+            EXPECT_EQ(objectCount, loadedScene.getChildCount(root));
+            return static_cast<int>(durationUs);
+        };
+
+        RecordProperty("ReplayLoadTimeUs", measureLoadTimeUs(actionsStream));
+        RecordProperty("SnapshotLoadTimeUs", measureLoadTimeUs(snapshotStream));
+        RecordProperty("ReplaySizeBytes", static_cast<int>(actionsStream.getSize()));
+        RecordProperty("SnapshotSizeBytes", static_cast<int>(snapshotStream.getSize()));
+    }
 }
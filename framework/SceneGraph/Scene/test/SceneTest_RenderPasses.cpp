@@ -38,6 +38,7 @@ namespace ramses_internal
         EXPECT_FALSE(rp.renderTarget.isValid());
         EXPECT_EQ(0, rp.renderOrder);
         EXPECT_FALSE(rp.isRenderOnce);
+        EXPECT_FALSE(rp.isFrustumCullingEnabled);
     }
 
     TYPED_TEST(AScene, RenderPassReleased)
@@ -171,4 +172,13 @@ namespace ramses_internal
         this->m_scene.setRenderPassRenderOnce(pass, false);
         EXPECT_FALSE(this->m_scene.getRenderPass(pass).isRenderOnce);
     }
+
+    TYPED_TEST(AScene, canSetFrustumCulling)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass();
+        this->m_scene.setRenderPassFrustumCulling(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isFrustumCullingEnabled);
+        this->m_scene.setRenderPassFrustumCulling(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isFrustumCullingEnabled);
+    }
 }
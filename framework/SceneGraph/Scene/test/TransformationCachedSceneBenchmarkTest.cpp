@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Scene/TransformationCachedScene.h"
+#include "TestEqualHelper.h"
+#include <chrono>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Compares world matrix update of a scene with more than 10k animated nodes done lazily node by node
+    // with batched update of all dirty nodes. Results are recorded as test properties (microseconds per update),
+    // the test itself only checks that both ways give same matrices.
+    class ATransformationCachedSceneBenchmark : public testing::Test
+    {
+    public:
+        ATransformationCachedSceneBenchmark()
+        {
+            createHierarchy(lazyScene, lazyTransforms, lazyLeafNodes);
+            createHierarchy(batchedScene, batchedTransforms, batchedLeafNodes);
+        }
+
+    protected:
+        static constexpr UInt32 GroupCount = 100u;
+        static constexpr UInt32 LeavesPerGroup = 100u;
+        static constexpr UInt32 UpdateRounds = 20u;
+
+        // root node with group nodes below, every group node has leaf nodes, every node is transformed
+        static void createHierarchy(TransformationCachedScene& scene, std::vector<TransformHandle>& transforms, NodeHandleVector& leafNodes)
+        {
+            const NodeHandle root = scene.allocateNode();
+            transforms.push_back(scene.allocateTransform(root));
+            for (UInt32 g = 0u; g < GroupCount; ++g)
+            {
+                const NodeHandle group = scene.allocateNode();
+                scene.addChildToNode(root, group);
+                transforms.push_back(scene.allocateTransform(group));
+                for (UInt32 l = 0u; l < LeavesPerGroup; ++l)
+                {
+                    const NodeHandle leaf = scene.allocateNode();
+                    scene.addChildToNode(group, leaf);
+                    transforms.push_back(scene.allocateTransform(leaf));
+                    leafNodes.push_back(leaf);
+                }
+            }
+        }
+
+        static void animate(TransformationCachedScene& scene, const std::vector<TransformHandle>& transforms, UInt32 round)
+        {
+            for (size_t i = 0u; i < transforms.size(); ++i)
+            {
+                const Float value = static_cast<Float>(round) + static_cast<Float>(i % 7u) * 0.1f;
+                scene.setTranslation(transforms[i], { value, -value, 0.5f * value });
+                scene.setRotation(transforms[i], { value, 2.f * value, 0.f }, ERotationConvention::XYZ);
+                scene.setScaling(transforms[i], { 1.f, 1.f + 0.01f * value, 1.f });
+            }
+        }
+
+        template <typename Func>
+        static int MeasureUs(Func&& func)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            func();
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        }
+
+        TransformationCachedScene lazyScene;
+        TransformationCachedScene batchedScene;
+        std::vector<TransformHandle> lazyTransforms;
+        std::vector<TransformHandle> batchedTransforms;
+        NodeHandleVector lazyLeafNodes;
+        NodeHandleVector batchedLeafNodes;
+    };
+
+    TEST_F(ATransformationCachedSceneBenchmark, Benchmark_updateWorldMatricesOfAllAnimatedNodes)
+    {
+        RecordProperty("NodeCount", static_cast<int>(lazyTransforms.size()));
+
+        int lazyUs = 0;
+        int batchedUs = 0;
+        for (UInt32 round = 0u; round < UpdateRounds; ++round)
+        {
+            animate(lazyScene, lazyTransforms, round);
+            lazyUs += MeasureUs([&]
+            {
+                for (const auto leaf : lazyLeafNodes)
+                    lazyScene.updateMatrixCache(ETransformationMatrixType_World, leaf);
+            });
+
+            animate(batchedScene, batchedTransforms, round);
+            batchedUs += MeasureUs([&]
+            {
+                batchedScene.updateWorldMatrixCaches(batchedLeafNodes);
+            });
+
+            for (size_t i = 0u; i < lazyLeafNodes.size(); i += LeavesPerGroup - 1u)
+            {
+                expectMatrixFloatEqual(lazyScene.updateMatrixCache(ETransformationMatrixType_World, lazyLeafNodes[i]),
+                    batchedScene.updateMatrixCache(ETransformationMatrixType_World, batchedLeafNodes[i]));
+            }
+        }
+
+        RecordProperty("LazyUpdateUs", lazyUs / static_cast<int>(UpdateRounds));
+        RecordProperty("BatchedUpdateUs", batchedUs / static_cast<int>(UpdateRounds));
+    }
+}
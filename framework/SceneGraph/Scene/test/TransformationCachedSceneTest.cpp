@@ -102,6 +102,29 @@ namespace ramses_internal
             Matrix44f::RotationEuler(-1 * rotation, ERotationConvention::XZY));
     }
 
+    TEST_F(ATransformationCachedScene, GivesCorrectValueWhenTransformOfNodeIsTranslatedScaledAndRotated)
+    {
+        const Vector3 translation{ 1.f, -2.f, 3.f };
+        const Vector3 rotation{ 5.f, 10.0f, 150.0f };
+        const Vector3 scaling{ 0.5f, 2.f, 4.f };
+        this->scene.setTranslation(this->transform, translation);
+        this->scene.setRotation(this->transform, rotation, ERotationConvention::XYZ);
+        this->scene.setScaling(this->transform, scaling);
+
+        this->expectCorrectMatrices(this->nodeWithTransform,
+            Matrix44f::Translation(translation) * Matrix44f::Scaling(scaling) * Matrix44f::RotationEuler(rotation, ERotationConvention::XYZ),
+            Matrix44f::RotationEuler(rotation, ERotationConvention::XYZ).transpose() * Matrix44f::Scaling(scaling.inverse()) * Matrix44f::Translation(-translation));
+    }
+
+    TEST_F(ATransformationCachedScene, GivesIdentityMatricesAfterTransformOfNodeIsReleased)
+    {
+        this->scene.setTranslation(this->transform, Vector3(0.5f));
+        this->expectCorrectMatrices(this->nodeWithTransform, Matrix44f::Translation({ 0.5f, 0.5f, 0.5f }), Matrix44f::Translation({ -0.5f, -0.5f, -0.5f }));
+
+        this->scene.releaseTransform(this->transform);
+        this->expectIdentityMatrices(this->nodeWithTransform);
+    }
+
     TEST_F(ATransformationCachedScene, GivesCorrectValueWhenRotationConventionIsSetDifferentFromParent)
     {
         // add parent with transform
@@ -330,4 +353,58 @@ namespace ramses_internal
 
         this->expectCorrectMatrices(child, expectedUpdatedChildWorldMatrix, expectedUpdatedChildObjectMatrix);
     }
+
+    TEST_F(ATransformationCachedScene, UpdatesWorldMatricesOfSharedAndSeparateDirtyChainsInBatch)
+    {
+        const NodeHandle childLeft = this->scene.allocateNode();
+        const NodeHandle childRight = this->scene.allocateNode();
+        const NodeHandle grandChild = this->scene.allocateNode();
+        this->scene.addChildToNode(this->nodeWithTransform, childLeft);
+        this->scene.addChildToNode(this->nodeWithTransform, childRight);
+        this->scene.addChildToNode(childLeft, grandChild);
+        const TransformHandle childLeftTransform = this->scene.allocateTransform(childLeft);
+        const TransformHandle grandChildTransform = this->scene.allocateTransform(grandChild);
+
+        const Vector3 rotation{ 5.f, 10.0f, 150.0f };
+        this->scene.setTranslation(this->transform, Vector3(1.f, 2.f, 3.f));
+        this->scene.setRotation(this->transform, rotation, ERotationConvention::ZYX);
+        this->scene.setScaling(childLeftTransform, Vector3(0.5f, 2.f, 4.f));
+        this->scene.setTranslation(grandChildTransform, Vector3(-1.f, 0.f, 1.f));
+        this->scene.setRotation(grandChildTransform, -1 * rotation, ERotationConvention::XYZ);
+
+        // grand child first, so that chain of right child ends at already batched parent
+        this->scene.updateWorldMatrixCaches({ grandChild, childRight, this->nodeWithoutTransform });
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, childLeft));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, grandChild));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, childRight));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithoutTransform));
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_Object, grandChild));
+
+        const Matrix44f expectedParentMatrix = Matrix44f::Translation({ 1.f, 2.f, 3.f }) * Matrix44f::RotationEuler(rotation, ERotationConvention::ZYX);
+        const Matrix44f expectedChildLeftMatrix = expectedParentMatrix * Matrix44f::Scaling({ 0.5f, 2.f, 4.f });
+        expectMatrixFloatEqual(expectedChildLeftMatrix * Matrix44f::Translation({ -1.f, 0.f, 1.f }) * Matrix44f::RotationEuler(-1 * rotation, ERotationConvention::XYZ),
+            this->scene.updateMatrixCache(ETransformationMatrixType_World, grandChild));
+        expectMatrixFloatEqual(expectedChildLeftMatrix, this->scene.updateMatrixCache(ETransformationMatrixType_World, childLeft));
+        expectMatrixFloatEqual(expectedParentMatrix, this->scene.updateMatrixCache(ETransformationMatrixType_World, childRight));
+        expectMatrixFloatEqual(Matrix44f::Identity, this->scene.updateMatrixCache(ETransformationMatrixType_World, this->nodeWithoutTransform));
+    }
+
+    TEST_F(ATransformationCachedScene, UpdatesOnlyDirtyWorldMatricesInBatchAfterTransformChange)
+    {
+        const NodeHandle child = this->scene.allocateNode();
+        this->scene.addChildToNode(this->nodeWithTransform, child);
+        const TransformHandle childTransform = this->scene.allocateTransform(child);
+        this->scene.setTranslation(this->transform, Vector3(1.f, 0.f, 0.f));
+        this->scene.setTranslation(childTransform, Vector3(0.f, 1.f, 0.f));
+        this->scene.updateWorldMatrixCaches({ child });
+        expectMatrixFloatEqual(Matrix44f::Translation({ 1.f, 1.f, 0.f }), this->scene.updateMatrixCache(ETransformationMatrixType_World, child));
+
+        this->scene.setTranslation(childTransform, Vector3(0.f, 2.f, 0.f));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+        this->scene.updateWorldMatrixCaches({ child, child });
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, child));
+        expectMatrixFloatEqual(Matrix44f::Translation({ 1.f, 2.f, 0.f }), this->scene.updateMatrixCache(ETransformationMatrixType_World, child));
+        expectMatrixFloatEqual(Matrix44f::Translation({ 1.f, 0.f, 0.f }), this->scene.updateMatrixCache(ETransformationMatrixType_World, this->nodeWithTransform));
+    }
 }
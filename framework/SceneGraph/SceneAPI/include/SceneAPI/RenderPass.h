@@ -23,6 +23,7 @@ namespace ramses_internal
         Vector4                clearColor{ 0.f, 0.f, 0.f, 1.f };
         UInt32                 clearFlags = EClearFlags_All;
         bool                   isRenderOnce = false;
+        bool                   isFrustumCullingEnabled = false;
 
         RenderGroupOrderVector renderGroups;
     };
@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Collections/HashMap.h"
+#include "Collections/FlatHashMap.h"
+#include "gtest/gtest.h"
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Compares lookup heavy workloads of HashMap, FlatHashMap and std::unordered_map with key types used on hot paths.
+    // Results are recorded as test properties (microseconds), the test itself only checks that all maps behave the same.
+    class AHashMapBenchmark : public ::testing::Test
+    {
+    protected:
+        static constexpr size_t EntryCount = 50000u;
+        static constexpr size_t LookupRounds = 10u;
+
+        template <typename Key, typename T>
+        static void Put(HashMap<Key, T>& map, const Key& key, const T& value) { map.put(key, value); }
+        template <typename Key, typename T>
+        static void Put(FlatHashMap<Key, T>& map, const Key& key, const T& value) { map.put(key, value); }
+        template <typename Key, typename T>
+        static void Put(std::unordered_map<Key, T>& map, const Key& key, const T& value) { map[key] = value; }
+
+        template <typename Key, typename T>
+        static const T* Get(const HashMap<Key, T>& map, const Key& key) { return map.get(key); }
+        template <typename Key, typename T>
+        static const T* Get(const FlatHashMap<Key, T>& map, const Key& key) { return map.get(key); }
+        template <typename Key, typename T>
+        static const T* Get(const std::unordered_map<Key, T>& map, const Key& key)
+        {
+            const auto it = map.find(key);
+            return it != map.end() ? &it->second : nullptr;
+        }
+
+        template <typename Key, typename T>
+        static void Remove(HashMap<Key, T>& map, const Key& key) { map.remove(key); }
+        template <typename Key, typename T>
+        static void Remove(FlatHashMap<Key, T>& map, const Key& key) { map.remove(key); }
+        template <typename Key, typename T>
+        static void Remove(std::unordered_map<Key, T>& map, const Key& key) { map.erase(key); }
+
+        template <typename Key, typename T>
+        static T ValueOf(const typename HashMap<Key, T>::Pair& entry) { return entry.value; }
+        template <typename Key, typename T>
+        static T ValueOf(const typename FlatHashMap<Key, T>::Pair& entry) { return entry.value; }
+        template <typename Key, typename T>
+        static T ValueOf(const std::pair<const Key, T>& entry) { return entry.second; }
+
+        template <typename Func>
+        static int MeasureUs(Func&& func)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            func();
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        }
+
+        template <typename Map, typename Key>
+        void runBenchmark(const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& missingKeys)
+        {
+            // lookups do not follow insertion order, like in resource registries or scene maps
+            std::vector<Key> lookupKeys = keys;
+            std::shuffle(lookupKeys.begin(), lookupKeys.end(), std::mt19937(13u));
+
+            Map map;
+            size_t checksum = 0u;
+
+            RecordProperty(name + "_InsertUs", MeasureUs([&]
+            {
+                for (size_t i = 0u; i < keys.size(); ++i)
+                    Put(map, keys[i], i);
+            }));
+
+            RecordProperty(name + "_LookupHitUs", MeasureUs([&]
+            {
+                for (size_t round = 0u; round < LookupRounds; ++round)
+                {
+                    for (const auto& key : lookupKeys)
+                        checksum += *Get(map, key);
+                }
+            }));
+
+            RecordProperty(name + "_LookupMissUs", MeasureUs([&]
+            {
+                for (size_t round = 0u; round < LookupRounds; ++round)
+                {
+                    for (const auto& key : missingKeys)
+                        checksum += (Get(map, key) == nullptr) ? 1u : 0u;
+                }
+            }));
+
+            RecordProperty(name + "_IterateUs", MeasureUs([&]
+            {
+                for (size_t round = 0u; round < LookupRounds; ++round)
+                {
+                    for (const auto& entry : map)
+                        checksum += ValueOf<Key, size_t>(entry);
+                }
+            }));
+
+            RecordProperty(name + "_RemoveUs", MeasureUs([&]
+            {
+                for (size_t i = 0u; i < keys.size(); i += 2u)
+                    Remove(map, keys[i]);
+            }));
+
+            const size_t sumOfIndices = EntryCount * (EntryCount - 1u) / 2u;
+            EXPECT_EQ(LookupRounds * (2u * sumOfIndices + missingKeys.size()), checksum);
+            EXPECT_EQ(EntryCount / 2u, map.size());
+        }
+
+        template <typename Key>
+        void runBenchmarks(const std::string& keyName, const std::vector<Key>& keys, const std::vector<Key>& missingKeys)
+        {
+            runBenchmark<HashMap<Key, size_t>>("HashMap_" + keyName, keys, missingKeys);
+            runBenchmark<FlatHashMap<Key, size_t>>("FlatHashMap_" + keyName, keys, missingKeys);
+            runBenchmark<std::unordered_map<Key, size_t>>("StdUnorderedMap_" + keyName, keys, missingKeys);
+        }
+    };
+
+    TEST_F(AHashMapBenchmark, Benchmark_handleKeys)
+    {
+        // handles are allocated mostly sequentially
+        std::vector<NodeHandle> keys;
+        std::vector<NodeHandle> missingKeys;
+        for (UInt32 i = 0u; i < EntryCount; ++i)
+        {
+            keys.push_back(NodeHandle(i));
+            missingKeys.push_back(NodeHandle(EntryCount + i));
+        }
+
+        runBenchmarks("NodeHandle", keys, missingKeys);
+    }
+
+    TEST_F(AHashMapBenchmark, Benchmark_resourceContentHashKeys)
+    {
+        std::mt19937_64 gen(7u);
+        std::vector<ResourceContentHash> keys;
+        std::vector<ResourceContentHash> missingKeys;
+        for (size_t i = 0u; i < EntryCount; ++i)
+        {
+            keys.push_back(ResourceContentHash(gen(), gen()));
+            missingKeys.push_back(ResourceContentHash(gen(), gen()));
+        }
+
+        runBenchmarks("ResourceContentHash", keys, missingKeys);
+    }
+}
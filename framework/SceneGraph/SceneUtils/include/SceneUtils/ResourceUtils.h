@@ -138,6 +138,7 @@ namespace ramses_internal
         }
 
         void DiffResources(ResourceContentHashVector const& old, ResourceContentHashVector const& curr, ResourceChanges& changes);
+        void ApplyResourceChanges(ResourceContentHashVector const& old, ResourceChanges const& changes, ResourceContentHashVector& curr);
     }
 }
 
@@ -27,5 +27,18 @@ namespace ramses_internal
             std::set_difference(curr.begin(), curr.end(), old.begin(), old.end(), std::back_inserter(changes.m_resourcesAdded));
             std::set_difference(old.begin(), old.end(), curr.begin(), curr.end(), std::back_inserter(changes.m_resourcesRemoved));
         }
+
+        void ApplyResourceChanges(ResourceContentHashVector const& old, ResourceChanges const& changes, ResourceContentHashVector& curr)
+        {
+            assert(std::is_sorted(old.cbegin(), old.cend()));
+            assert(std::is_sorted(changes.m_resourcesAdded.cbegin(), changes.m_resourcesAdded.cend()));
+            assert(std::is_sorted(changes.m_resourcesRemoved.cbegin(), changes.m_resourcesRemoved.cend()));
+            assert(curr.empty());
+            curr.reserve(old.size() + changes.m_resourcesAdded.size());
+            std::set_difference(old.begin(), old.end(), changes.m_resourcesRemoved.begin(), changes.m_resourcesRemoved.end(), std::back_inserter(curr));
+            const auto numKept = static_cast<std::ptrdiff_t>(curr.size());
+            curr.insert(curr.end(), changes.m_resourcesAdded.begin(), changes.m_resourcesAdded.end());
+            std::inplace_merge(curr.begin(), curr.begin() + numKept, curr.end());
+        }
     }
 }
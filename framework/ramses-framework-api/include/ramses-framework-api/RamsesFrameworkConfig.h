@@ -125,6 +125,60 @@ namespace ramses
         */
         void setPeriodicLogsEnabled(bool enabled);
 
+        /**
+        * @brief Enables or disables memory mapping of scene and resource files
+        *
+        * If enabled, files with resources loaded by clients are mapped into memory and resources are read
+        * from the mapping on demand instead of through buffered file reads. This avoids keeping file content
+        * both in OS file cache and in intermediate buffers. If a file cannot be mapped, it is read as usual.
+        *
+        * The default value is disabled.
+        *
+        * @param[in] enabled If true resource files are mapped into memory
+        */
+        void setMemoryMappedResourceFilesEnabled(bool enabled);
+
+        /**
+        * @brief Enables or disables coalescing of redundant scene changes on flush
+        *
+        * If enabled, scene changes which are overwritten by a later change of the same property of the same
+        * scene object before flush (e.g. a node translation or uniform value set multiple times) are removed
+        * on flush and are not sent to renderers. Only the last value is sent.
+        *
+        * The default value is disabled.
+        *
+        * @param[in] enabled If true redundant scene changes are removed on flush
+        */
+        void setSceneActionCoalescingEnabled(bool enabled);
+
+        /**
+        * @brief Enables or disables compact encoding of scene changes sent over TCP communication
+        *
+        * If enabled, scene changes are sent in a compact, compressed encoding to every remote participant
+        * which enabled it as well. Connections to participants which did not enable it keep using the regular encoding.
+        * Compact encoding reduces network traffic of scene updates at the cost of some CPU time for encoding and decoding.
+        * The value is only evaluated if TCP communication is used.
+        *
+        * The default value is disabled.
+        *
+        * @param[in] enabled If true scene changes are sent in compact encoding where supported
+        */
+        void setCompactSceneActionEncodingEnabled(bool enabled);
+
+        /**
+        * @brief Sets a directory used by clients to cache effects compiled from GLSL sources
+        *
+        * If set, effects created by clients are stored in the given directory after compilation. Creating an effect
+        * with the same shader sources, compiler defines and semantic inputs later (also in another run) reads the
+        * effect from the directory instead of compiling the shaders again. The directory is created if it does not exist.
+        * Cached effects are only reused by the same SDK version.
+        *
+        * The default value is empty, which disables the cache.
+        *
+        * @param[in] directory Path of the cache directory, empty string to disable the cache
+        */
+        void setEffectCompilationCacheDirectory(const char* directory);
+
         /**
         * @brief Sets the IP address that is used to select the local network interface
         * The value is only evaluated if SOME/IP is not used. This communication type is intended for prototype use-cases only.
@@ -51,6 +51,10 @@ namespace ramses
         IThreadWatchdogNotification* getWatchdogNotificationCallback() const;
 
         void setPeriodicLogsEnabled(bool enabled);
+        void setMemoryMappedResourceFilesEnabled(bool enabled);
+        void setSceneActionCoalescingEnabled(bool enabled);
+        void setCompactSceneActionEncodingEnabled(bool enabled);
+        void setEffectCompilationCacheDirectory(const char* directory);
         ramses_internal::Guid getUserProvidedGuid() const;
 
         SOMEIPICConfig   m_someipICConfig;
@@ -59,6 +63,10 @@ namespace ramses
         ERamsesShellType m_shellType;
         ramses_internal::ThreadWatchdogConfig m_watchdogConfig;
         bool m_periodicLogsEnabled;
+        bool m_memoryMappedResourceFilesEnabled = false;
+        bool m_sceneActionCoalescingEnabled = false;
+        bool m_compactSceneActionEncodingEnabled = false;
+        std::string m_effectCompilationCacheDirectory;
         std::chrono::milliseconds someipKeepAliveInterval{500};
         std::chrono::milliseconds someipKeepAliveTimeout{2500};
 
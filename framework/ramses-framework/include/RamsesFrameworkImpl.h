@@ -79,6 +79,7 @@ namespace ramses
         ramses_internal::Ramsh& getRamsh();
         ramses_internal::PlatformLock& getFrameworkLock();
         const ramses_internal::ThreadWatchdogConfig& getThreadWatchdogConfig() const;
+        const std::string& getEffectCompilationCacheDirectory() const;
         ramses_internal::ITaskQueue& getTaskQueue();
         ramses_internal::PeriodicLogger& getPeriodicLogger();
         ramses_internal::StatisticCollectionFramework& getStatisticCollection();
@@ -104,6 +105,7 @@ namespace ramses
         ramses_internal::PeriodicLogger m_periodicLogger;
         bool m_connected;
         const ramses_internal::ThreadWatchdogConfig m_threadWatchdogConfig;
+        const std::string m_effectCompilationCacheDirectory;
         ramses_internal::ThreadedTaskExecutor m_threadedTaskExecutor;
         ramses_internal::ResourceComponent m_resourceComponent;
         ramses_internal::SceneGraphComponent m_scenegraphComponent;
@@ -72,6 +72,26 @@ namespace ramses
         impl.setPeriodicLogsEnabled(enabled);
     }
 
+    void RamsesFrameworkConfig::setMemoryMappedResourceFilesEnabled(bool enabled)
+    {
+        impl.setMemoryMappedResourceFilesEnabled(enabled);
+    }
+
+    void RamsesFrameworkConfig::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        impl.setSceneActionCoalescingEnabled(enabled);
+    }
+
+    void RamsesFrameworkConfig::setCompactSceneActionEncodingEnabled(bool enabled)
+    {
+        impl.setCompactSceneActionEncodingEnabled(enabled);
+    }
+
+    void RamsesFrameworkConfig::setEffectCompilationCacheDirectory(const char* directory)
+    {
+        impl.setEffectCompilationCacheDirectory(directory);
+    }
+
     void RamsesFrameworkConfig::setInterfaceSelectionIPForTCPCommunication(const char* ip)
     {
         impl.m_tcpConfig.setIPAddress(ip);
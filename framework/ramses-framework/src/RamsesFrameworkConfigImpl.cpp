@@ -245,6 +245,26 @@ namespace ramses
         m_periodicLogsEnabled = enabled;
     }
 
+    void RamsesFrameworkConfigImpl::setMemoryMappedResourceFilesEnabled(bool enabled)
+    {
+        m_memoryMappedResourceFilesEnabled = enabled;
+    }
+
+    void RamsesFrameworkConfigImpl::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        m_sceneActionCoalescingEnabled = enabled;
+    }
+
+    void RamsesFrameworkConfigImpl::setCompactSceneActionEncodingEnabled(bool enabled)
+    {
+        m_compactSceneActionEncodingEnabled = enabled;
+    }
+
+    void RamsesFrameworkConfigImpl::setEffectCompilationCacheDirectory(const char* directory)
+    {
+        m_effectCompilationCacheDirectory = directory ? directory : "";
+    }
+
     ramses_internal::Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
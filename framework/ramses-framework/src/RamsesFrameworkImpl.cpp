@@ -41,10 +41,11 @@ namespace ramses
         , m_periodicLogger(m_frameworkLock, m_statisticCollection)
         , m_connected(false)
         , m_threadWatchdogConfig(config.m_watchdogConfig)
+        , m_effectCompilationCacheDirectory(config.m_effectCompilationCacheDirectory)
         // NOTE: ThreadedTaskExecutor must always be constructed after CommunicationSystem
         , m_threadedTaskExecutor(3, config.m_watchdogConfig)
-        , m_resourceComponent(m_statisticCollection, m_frameworkLock)
-        , m_scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getRamsesConnectionStatusUpdateNotifier(), m_resourceComponent, m_frameworkLock)
+        , m_resourceComponent(m_statisticCollection, m_frameworkLock, config.m_memoryMappedResourceFilesEnabled)
+        , m_scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getRamsesConnectionStatusUpdateNotifier(), m_resourceComponent, m_frameworkLock, config.m_sceneActionCoalescingEnabled)
         , m_dcsmComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getDcsmConnectionStatusUpdateNotifier(), m_frameworkLock)
         , m_ramshCommandLogConnectionInformation(*m_communicationSystem)
         , m_ramshCommandLogDcsmInformation(m_dcsmComponent)
@@ -192,6 +193,11 @@ namespace ramses
         return m_threadWatchdogConfig;
     }
 
+    const std::string& RamsesFrameworkImpl::getEffectCompilationCacheDirectory() const
+    {
+        return m_effectCompilationCacheDirectory;
+    }
+
     ramses_internal::ITaskQueue& RamsesFrameworkImpl::getTaskQueue()
     {
         return m_threadedTaskExecutor;
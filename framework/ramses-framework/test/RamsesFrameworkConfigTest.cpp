@@ -60,3 +60,33 @@ TEST_F(ARamsesFrameworkConfig, TestSetandGetApplicationInformation)
     EXPECT_STREQ(application_id, frameworkConfig.getDLTApplicationID());
     EXPECT_STREQ(application_description, frameworkConfig.getDLTApplicationDescription());
 }
+
+TEST_F(ARamsesFrameworkConfig, CanEnableMemoryMappedResourceFiles)
+{
+    EXPECT_FALSE(frameworkConfig.impl.m_memoryMappedResourceFilesEnabled);
+    frameworkConfig.setMemoryMappedResourceFilesEnabled(true);
+    EXPECT_TRUE(frameworkConfig.impl.m_memoryMappedResourceFilesEnabled);
+}
+
+TEST_F(ARamsesFrameworkConfig, CanEnableSceneActionCoalescing)
+{
+    EXPECT_FALSE(frameworkConfig.impl.m_sceneActionCoalescingEnabled);
+    frameworkConfig.setSceneActionCoalescingEnabled(true);
+    EXPECT_TRUE(frameworkConfig.impl.m_sceneActionCoalescingEnabled);
+}
+
+TEST_F(ARamsesFrameworkConfig, CanEnableCompactSceneActionEncoding)
+{
+    EXPECT_FALSE(frameworkConfig.impl.m_compactSceneActionEncodingEnabled);
+    frameworkConfig.setCompactSceneActionEncodingEnabled(true);
+    EXPECT_TRUE(frameworkConfig.impl.m_compactSceneActionEncodingEnabled);
+}
+
+TEST_F(ARamsesFrameworkConfig, CanSetEffectCompilationCacheDirectory)
+{
+    EXPECT_TRUE(frameworkConfig.impl.m_effectCompilationCacheDirectory.empty());
+    frameworkConfig.setEffectCompilationCacheDirectory("effectCache");
+    EXPECT_EQ("effectCache", frameworkConfig.impl.m_effectCompilationCacheDirectory);
+    frameworkConfig.setEffectCompilationCacheDirectory(nullptr);
+    EXPECT_TRUE(frameworkConfig.impl.m_effectCompilationCacheDirectory.empty());
+}
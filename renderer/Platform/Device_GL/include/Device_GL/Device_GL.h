@@ -13,6 +13,7 @@
 #include "Platform_Base/DeviceResourceMapper.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
+#include "UniformBlockBuffers_GL.h"
 
 namespace ramses_internal
 {
@@ -70,11 +71,13 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle    allocateVertexBuffer  (UInt32 totalSizeInBytes) override;
         virtual void                    uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    updateVertexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) override;
         virtual void                    deleteVertexBuffer    (DeviceResourceHandle handle) override;
         virtual void                    activateVertexBuffer  (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor, UInt32 startVertex, EDataType bufferDataType, UInt16 offsetWithinElement, UInt16 stride) override;
 
         virtual DeviceResourceHandle    allocateIndexBuffer   (EDataType dataType, UInt32 sizeInBytes) override;
         virtual void                    uploadIndexBufferData (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    updateIndexBufferData (DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) override;
         virtual void                    deleteIndexBuffer     (DeviceResourceHandle handle) override;
         virtual void                    activateIndexBuffer   (DeviceResourceHandle handle) override;
 
@@ -145,8 +148,11 @@ namespace ramses_internal
         DebugOutput                 m_debugOutput;
         HashSet<String>             m_apiExtensions;
         std::vector<GLint>          m_supportedBinaryProgramFormats;
+        UniformBlockBuffers_GL      m_uniformBlockBuffers;
 
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
+        template <typename T>
+        Bool setUniformBlockMember(DataFieldHandle field, UInt32 count, const T* value, UInt32 columnCount = 1u);
         Bool getAttributeLocation(DataFieldHandle field, GLInputLocation& location) const;
 
         Bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
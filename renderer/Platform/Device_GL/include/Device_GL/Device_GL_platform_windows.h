@@ -111,6 +111,13 @@
 #define glTexSubImage3D(...)            glTexSubImage3DNative(__VA_ARGS__)
 #define glCompressedTexSubImage2D(...)  glCompressedTexSubImage2DNative(__VA_ARGS__)
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
+#define glBufferSubData(...)            glBufferSubDataNative(__VA_ARGS__)
+#define glBindBufferBase(...)           glBindBufferBaseNative(__VA_ARGS__)
+#define glGetUniformIndices(...)        glGetUniformIndicesNative(__VA_ARGS__)
+#define glGetActiveUniformsiv(...)      glGetActiveUniformsivNative(__VA_ARGS__)
+#define glGetActiveUniformBlockiv(...)  glGetActiveUniformBlockivNative(__VA_ARGS__)
+#define glGetActiveUniformBlockName(...) glGetActiveUniformBlockNameNative(__VA_ARGS__)
+#define glUniformBlockBinding(...)      glUniformBlockBindingNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -196,6 +203,13 @@ DECLARE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DECLARE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DECLARE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DECLARE_API_PROC(PFNGLBINDBUFFERBASEPROC, glBindBufferBase);                                    \
+DECLARE_API_PROC(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                              \
+DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                          \
+DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);                  \
+DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName);              \
+DECLARE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
 
 #define LOAD_ALL_API_PROCS(CONTEXT)                                                               \
 LOAD_API_PROC(CONTEXT, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -281,6 +295,13 @@ LOAD_API_PROC(CONTEXT, PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 LOAD_API_PROC(CONTEXT, PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                  \
 LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);              \
 LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
+LOAD_API_PROC(CONTEXT, PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                  \
+LOAD_API_PROC(CONTEXT, PFNGLBINDBUFFERBASEPROC, glBindBufferBase);                                \
+LOAD_API_PROC(CONTEXT, PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                          \
+LOAD_API_PROC(CONTEXT, PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                      \
+LOAD_API_PROC(CONTEXT, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);              \
+LOAD_API_PROC(CONTEXT, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName);          \
+LOAD_API_PROC(CONTEXT, PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                      \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -367,5 +388,12 @@ DEFINE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DEFINE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DEFINE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DEFINE_API_PROC(PFNGLBINDBUFFERBASEPROC, glBindBufferBase);                                    \
+DEFINE_API_PROC(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                              \
+DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                          \
+DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);                  \
+DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName);              \
+DEFINE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
 
 #endif
@@ -13,6 +13,8 @@
 #include "Device_GL/ShaderProgramInfo.h"
 #include "Resource/EffectResource.h"
 #include "Utils/LogMacros.h"
+#include <algorithm>
+#include <vector>
 
 namespace ramses_internal
 {
@@ -28,6 +30,23 @@ namespace ramses_internal
         EEffectInputTextureType textureType;
     };
 
+    struct UniformBlockInfo
+    {
+        String name;
+        UInt32 dataSize = 0u;
+        // block contains only data which are same for all renderables using same camera and display buffer
+        bool isCameraData = true;
+    };
+
+    // layout of uniform within uniform block as reported by GL (std140 or shared layout)
+    struct UniformBlockMemberInfo
+    {
+        Int32 blockIndex = -1; // -1 for uniforms declared outside of uniform block
+        UInt32 offset = 0u;
+        UInt32 arrayStride = 0u;
+        UInt32 matrixStride = 0u;
+    };
+
     class ShaderGPUResource_GL : public ShaderGPUResource
     {
     public:
@@ -38,10 +57,15 @@ namespace ramses_internal
         GLInputLocation     getAttributeLocation(DataFieldHandle) const;
         TextureSlotInfo     getTextureSlot(DataFieldHandle) const;
 
+        const std::vector<UniformBlockInfo>& getUniformBlocks() const;
+        const UniformBlockMemberInfo&        getUniformBlockMember(DataFieldHandle) const;
+
         bool                getBinaryInfo(UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
     private:
         void                preloadVariableLocations(const EffectResource& effect);
+        void                loadUniformBlocks(const EffectResource& effect);
+        static bool         IsCameraDataSemantics(EFixedSemantics semantics);
         GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
 
@@ -53,6 +77,9 @@ namespace ramses_internal
         BufferSlotMap    m_bufferSlots;
         InputLocationMap m_uniformLocationMap;
         InputLocationMap m_attributeLocationMap;
+
+        std::vector<UniformBlockInfo>       m_uniformBlocks;
+        std::vector<UniformBlockMemberInfo> m_uniformBlockMembers;
     };
 
     // inline implementation:
@@ -110,6 +137,17 @@ namespace ramses_internal
         return slot;
     }
 
+    inline const std::vector<UniformBlockInfo>& ShaderGPUResource_GL::getUniformBlocks() const
+    {
+        return m_uniformBlocks;
+    }
+
+    inline const UniformBlockMemberInfo& ShaderGPUResource_GL::getUniformBlockMember(DataFieldHandle field) const
+    {
+        assert(field.asMemoryHandle() < m_uniformBlockMembers.size());
+        return m_uniformBlockMembers[field.asMemoryHandle()];
+    }
+
     inline void ShaderGPUResource_GL::preloadVariableLocations(const EffectResource& effect)
     {
         const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
@@ -127,6 +165,8 @@ namespace ramses_internal
             m_attributeLocationMap[i] = location;
         }
 
+        loadUniformBlocks(effect);
+
         TextureSlot slotCounter = 0; // texture unit 0
         for (UInt32 i = 0; i < globalInputCount; ++i)
         {
@@ -139,8 +179,93 @@ namespace ramses_internal
                 m_bufferSlots.put(DataFieldHandle(i), bufferSlot);
             }
 
-            const GLInputLocation location = loadUniformLocation(effect, input);
-            m_uniformLocationMap[i] = location;
+            // uniforms in blocks have no location, they are set via uniform buffer
+            if (m_uniformBlockMembers[i].blockIndex < 0)
+            {
+                const GLInputLocation location = loadUniformLocation(effect, input);
+                m_uniformLocationMap[i] = location;
+            }
+        }
+    }
+
+    inline void ShaderGPUResource_GL::loadUniformBlocks(const EffectResource& effect)
+    {
+        const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
+        m_uniformBlockMembers.resize(uniformInputs.size());
+
+        const GLHandle program = m_shaderProgramInfo.shaderProgramHandle;
+        GLint blockCount = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+        if (blockCount <= 0)
+            return;
+
+        m_uniformBlocks.resize(blockCount);
+        for (GLuint blockIndex = 0u; blockIndex < static_cast<GLuint>(blockCount); ++blockIndex)
+        {
+            GLint dataSize = 0;
+            GLint nameLength = 0;
+            glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+            glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_NAME_LENGTH, &nameLength);
+
+            UniformBlockInfo& block = m_uniformBlocks[blockIndex];
+            block.dataSize = static_cast<UInt32>(dataSize);
+            block.name.resize(std::max(nameLength, 1));
+            GLsizei nameLengthWritten = 0;
+            glGetActiveUniformBlockName(program, blockIndex, static_cast<GLsizei>(block.name.size()), &nameLengthWritten, block.name.data());
+            block.name.resize(nameLengthWritten);
+
+            // binding point of block is its index, there is no other program using bindings at the same time
+            glUniformBlockBinding(program, blockIndex, blockIndex);
+        }
+
+        for (UInt32 i = 0u; i < uniformInputs.size(); ++i)
+        {
+            const EffectInputInformation& input = uniformInputs[i];
+            if (IsTextureSamplerType(input.dataType))
+                continue;
+
+            const Char* varName = input.inputName.c_str();
+            GLuint uniformIndex = GL_INVALID_INDEX;
+            glGetUniformIndices(program, 1, &varName, &uniformIndex);
+            if (uniformIndex == GL_INVALID_INDEX)
+                continue;
+
+            GLint blockIndex = -1;
+            glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+            if (blockIndex < 0 || blockIndex >= blockCount)
+                continue;
+
+            GLint offset = 0;
+            GLint arrayStride = 0;
+            GLint matrixStride = 0;
+            glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_OFFSET, &offset);
+            glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_ARRAY_STRIDE, &arrayStride);
+            glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_MATRIX_STRIDE, &matrixStride);
+
+            UniformBlockMemberInfo& member = m_uniformBlockMembers[i];
+            member.blockIndex = blockIndex;
+            member.offset = static_cast<UInt32>(offset);
+            member.arrayStride = static_cast<UInt32>(arrayStride);
+            member.matrixStride = static_cast<UInt32>(matrixStride);
+
+            if (!IsCameraDataSemantics(input.semantics))
+                m_uniformBlocks[blockIndex].isCameraData = false;
+        }
+
+        LOG_DEBUG(CONTEXT_RENDERER, "ShaderGPUResource_GL::loadUniformBlocks:  effect '" << effect.getName() << "' uses " << blockCount << " uniform block(s)");
+    }
+
+    inline bool ShaderGPUResource_GL::IsCameraDataSemantics(EFixedSemantics semantics)
+    {
+        switch (semantics)
+        {
+        case EFixedSemantics::ProjectionMatrix:
+        case EFixedSemantics::ViewMatrix:
+        case EFixedSemantics::CameraWorldPosition:
+        case EFixedSemantics::DisplayBufferResolution:
+            return true;
+        default:
+            return false;
         }
     }
 
@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UNIFORMBLOCKBUFFERS_GL_H
+#define RAMSES_UNIFORMBLOCKBUFFERS_GL_H
+
+#include "Device_GL/Types_GL.h"
+#include "Collections/String.h"
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+namespace ramses_internal
+{
+    class ShaderGPUResource_GL;
+    struct UniformBlockMemberInfo;
+
+    // Holds values of uniforms declared in uniform blocks and uploads them as uniform buffers right before draw.
+    // Every shader keeps its own copy of block data, same as GL keeps values of plain uniforms per program.
+    // Blocks with camera data only (e.g. view and projection matrix) of same name and size share a single
+    // buffer object among all shaders, it is uploaded only if content of drawn shader's block differs from
+    // content last uploaded to buffer, so switching between shaders drawn with same camera does not upload.
+    class UniformBlockBuffers_GL
+    {
+    public:
+        UniformBlockBuffers_GL() = default;
+        ~UniformBlockBuffers_GL();
+
+        UniformBlockBuffers_GL(const UniformBlockBuffers_GL&) = delete;
+        UniformBlockBuffers_GL& operator=(const UniformBlockBuffers_GL&) = delete;
+
+        void activateShader(const ShaderGPUResource_GL& shader);
+        void deleteShader(const ShaderGPUResource_GL& shader);
+
+        // writes count elements, each element consists of columnCount columns of columnSize bytes (1 column for non-matrix types)
+        void setMemberData(const UniformBlockMemberInfo& member, UInt32 count, const Byte* data, UInt32 columnCount, UInt32 columnSize);
+        void uploadAndBindForDraw();
+
+    private:
+        struct UniformBuffer
+        {
+            GLHandle handle = InvalidGLHandle;
+            // block data uploaded last to buffer
+            const void* uploadedBlockData = nullptr;
+            // copy of content uploaded last, kept only for buffer shared by multiple shaders to compare their block data with
+            bool shared = false;
+            std::vector<Byte> uploadedData;
+        };
+
+        struct BlockData
+        {
+            std::vector<Byte> data;
+            bool dirty = true;
+            UniformBuffer* buffer = nullptr;
+            std::unique_ptr<UniformBuffer> ownBuffer;
+        };
+
+        static std::unique_ptr<UniformBuffer> CreateBuffer(UInt32 dataSize);
+        static void DeleteBuffer(const UniformBuffer& buffer);
+
+        std::unordered_map<const ShaderGPUResource_GL*, std::vector<BlockData>> m_shaderBlockData;
+        std::map<std::pair<String, UInt32>, std::unique_ptr<UniformBuffer>> m_sharedBuffers;
+        std::vector<BlockData>* m_activeBlockData = nullptr;
+        std::vector<GLHandle> m_boundBuffers;
+    };
+}
+
+#endif
@@ -172,6 +172,8 @@ namespace ramses_internal
 
     void Device_GL::drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
     {
+        m_uniformBlockBuffers.uploadAndBindForDraw();
+
         const UInt startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
         const GLvoid* startOffsetAddress = reinterpret_cast<void*>(startOffsetAddressAsUInt);
 
@@ -192,6 +194,8 @@ namespace ramses_internal
 
     void Device_GL::drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
     {
+        m_uniformBlockBuffers.uploadAndBindForDraw();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         if (instanceCount > 1u)
         {
@@ -406,6 +410,20 @@ namespace ramses_internal
         return location != GLInputLocationInvalid;
     }
 
+    template <typename T>
+    Bool Device_GL::setUniformBlockMember(DataFieldHandle field, UInt32 count, const T* value, UInt32 columnCount)
+    {
+        assert(nullptr != m_activeShader);
+        const UniformBlockMemberInfo& member = m_activeShader->getUniformBlockMember(field);
+        if (member.blockIndex < 0)
+            return false;
+
+        assert(nullptr != value);
+        static_assert(sizeof(T) % sizeof(Float) == 0u, "unexpected padding in uniform type");
+        m_uniformBlockBuffers.setMemberData(member, count, reinterpret_cast<const Byte*>(value), columnCount, static_cast<UInt32>(sizeof(T)) / columnCount);
+        return true;
+    }
+
     Bool Device_GL::getAttributeLocation(DataFieldHandle field, GLInputLocation& location) const
     {
         assert(nullptr != m_activeShader);
@@ -415,6 +433,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Float* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -425,6 +446,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -435,6 +459,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -445,6 +472,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -455,6 +485,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Int32* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -465,6 +498,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2i* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -475,6 +511,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3i* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -485,6 +524,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
     {
+        if (setUniformBlockMember(field, count, value))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -495,6 +537,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
     {
+        if (setUniformBlockMember(field, count, value, 2u))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -505,6 +550,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value)
     {
+        if (setUniformBlockMember(field, count, value, 3u))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -515,6 +563,9 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value)
     {
+        if (setUniformBlockMember(field, count, value, 4u))
+            return;
+
         GLInputLocation uniformLocation;
         if (getUniformLocation(field, uniformLocation))
         {
@@ -1041,6 +1092,15 @@ namespace ramses_internal
         glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::updateVertexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize)
+    {
+        const auto& vertexBuffer = m_resourceMapper.getResource(handle);
+        assert(offsetInBytes + dataSize <= vertexBuffer.getTotalSizeInBytes());
+
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getGPUAddress());
+        glBufferSubData(GL_ARRAY_BUFFER, offsetInBytes, dataSize, data);
+    }
+
     void Device_GL::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
@@ -1092,6 +1152,15 @@ namespace ramses_internal
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::updateIndexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize)
+    {
+        const auto& indexBuffer = m_resourceMapper.getResource(handle);
+        assert(offsetInBytes + dataSize <= indexBuffer.getTotalSizeInBytes());
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offsetInBytes, dataSize, data);
+    }
+
     void Device_GL::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
@@ -1163,6 +1232,7 @@ namespace ramses_internal
         {
             m_activeShader = nullptr;
         }
+        m_uniformBlockBuffers.deleteShader(shaderProgramGL);
 
         m_resourceMapper.deleteResource(handle);
     }
@@ -1172,6 +1242,7 @@ namespace ramses_internal
         const ShaderGPUResource_GL& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
         glUseProgram(shaderProgramGL.getGPUAddress());
         m_activeShader = &shaderProgramGL;
+        m_uniformBlockBuffers.activateShader(shaderProgramGL);
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
@@ -0,0 +1,165 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Device_GL/Device_GL_platform.h"
+#include "Device_GL/UniformBlockBuffers_GL.h"
+#include "Device_GL/ShaderGPUResource_GL.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    UniformBlockBuffers_GL::~UniformBlockBuffers_GL()
+    {
+        for (const auto& shaderBlocks : m_shaderBlockData)
+            for (const auto& block : shaderBlocks.second)
+                if (block.ownBuffer)
+                    DeleteBuffer(*block.ownBuffer);
+        for (const auto& sharedBuffer : m_sharedBuffers)
+            DeleteBuffer(*sharedBuffer.second);
+    }
+
+    void UniformBlockBuffers_GL::activateShader(const ShaderGPUResource_GL& shader)
+    {
+        const auto& blocks = shader.getUniformBlocks();
+        if (blocks.empty())
+        {
+            m_activeBlockData = nullptr;
+            return;
+        }
+
+        auto it = m_shaderBlockData.find(&shader);
+        if (it == m_shaderBlockData.end())
+        {
+            std::vector<BlockData> blockData(blocks.size());
+            for (size_t i = 0u; i < blocks.size(); ++i)
+            {
+                const UniformBlockInfo& blockInfo = blocks[i];
+                BlockData& block = blockData[i];
+                block.data.resize(blockInfo.dataSize, 0u);
+                if (blockInfo.isCameraData)
+                {
+                    auto& sharedBuffer = m_sharedBuffers[{ blockInfo.name, blockInfo.dataSize }];
+                    if (!sharedBuffer)
+                    {
+                        sharedBuffer = CreateBuffer(blockInfo.dataSize);
+                        sharedBuffer->shared = true;
+                    }
+                    block.buffer = sharedBuffer.get();
+                }
+                else
+                {
+                    block.ownBuffer = CreateBuffer(blockInfo.dataSize);
+                    block.buffer = block.ownBuffer.get();
+                }
+            }
+            it = m_shaderBlockData.emplace(&shader, std::move(blockData)).first;
+        }
+
+        m_activeBlockData = &it->second;
+    }
+
+    void UniformBlockBuffers_GL::deleteShader(const ShaderGPUResource_GL& shader)
+    {
+        const auto it = m_shaderBlockData.find(&shader);
+        if (it == m_shaderBlockData.end())
+            return;
+
+        for (const auto& block : it->second)
+        {
+            // memory of deleted block data could be reused by other shader, make sure shared buffer gets uploaded again
+            if (block.buffer->uploadedBlockData == &block)
+                block.buffer->uploadedBlockData = nullptr;
+
+            if (block.ownBuffer)
+            {
+                // deleted buffer gets unbound by GL
+                for (auto& boundBuffer : m_boundBuffers)
+                {
+                    if (boundBuffer == block.ownBuffer->handle)
+                        boundBuffer = InvalidGLHandle;
+                }
+                DeleteBuffer(*block.ownBuffer);
+            }
+        }
+
+        if (m_activeBlockData == &it->second)
+            m_activeBlockData = nullptr;
+        m_shaderBlockData.erase(it);
+    }
+
+    void UniformBlockBuffers_GL::setMemberData(const UniformBlockMemberInfo& member, UInt32 count, const Byte* data, UInt32 columnCount, UInt32 columnSize)
+    {
+        assert(m_activeBlockData != nullptr);
+        assert(member.blockIndex >= 0 && static_cast<size_t>(member.blockIndex) < m_activeBlockData->size());
+        BlockData& block = (*m_activeBlockData)[member.blockIndex];
+
+        for (UInt32 element = 0u; element < count; ++element)
+        {
+            for (UInt32 column = 0u; column < columnCount; ++column)
+            {
+                const size_t dstOffset = member.offset + element * member.arrayStride + column * member.matrixStride;
+                const Byte* src = data + (element * columnCount + column) * columnSize;
+                assert(dstOffset + columnSize <= block.data.size());
+                Byte* dst = block.data.data() + dstOffset;
+                if (std::memcmp(dst, src, columnSize) != 0)
+                {
+                    std::memcpy(dst, src, columnSize);
+                    block.dirty = true;
+                }
+            }
+        }
+    }
+
+    void UniformBlockBuffers_GL::uploadAndBindForDraw()
+    {
+        if (!m_activeBlockData)
+            return;
+
+        if (m_boundBuffers.size() < m_activeBlockData->size())
+            m_boundBuffers.resize(m_activeBlockData->size(), InvalidGLHandle);
+
+        for (GLuint bindingPoint = 0u; bindingPoint < m_activeBlockData->size(); ++bindingPoint)
+        {
+            BlockData& block = (*m_activeBlockData)[bindingPoint];
+            UniformBuffer& buffer = *block.buffer;
+            if (block.dirty || buffer.uploadedBlockData != &block)
+            {
+                // shaders drawn with same camera have same camera block content, shared buffer needs no upload then
+                if (!buffer.shared || buffer.uploadedData != block.data)
+                {
+                    glBindBuffer(GL_UNIFORM_BUFFER, buffer.handle);
+                    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(block.data.size()), block.data.data());
+                    if (buffer.shared)
+                        buffer.uploadedData = block.data;
+                }
+                block.dirty = false;
+                buffer.uploadedBlockData = &block;
+            }
+
+            if (m_boundBuffers[bindingPoint] != buffer.handle)
+            {
+                glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, buffer.handle);
+                m_boundBuffers[bindingPoint] = buffer.handle;
+            }
+        }
+    }
+
+    std::unique_ptr<UniformBlockBuffers_GL::UniformBuffer> UniformBlockBuffers_GL::CreateBuffer(UInt32 dataSize)
+    {
+        auto buffer = std::make_unique<UniformBuffer>();
+        glGenBuffers(1, &buffer->handle);
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer->handle);
+        glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(dataSize), nullptr, GL_DYNAMIC_DRAW);
+        return buffer;
+    }
+
+    void UniformBlockBuffers_GL::DeleteBuffer(const UniformBuffer& buffer)
+    {
+        glDeleteBuffers(1, &buffer.handle);
+    }
+}
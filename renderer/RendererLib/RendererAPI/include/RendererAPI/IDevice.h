@@ -82,11 +82,15 @@ namespace ramses_internal
         // resources
         virtual DeviceResourceHandle    allocateVertexBuffer        (UInt32 totalSizeInBytes) = 0;
         virtual void                    uploadVertexBufferData      (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
+        // updates part of buffer whose data was uploaded before using uploadVertexBufferData
+        virtual void                    updateVertexBufferData      (DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) = 0;
         virtual void                    deleteVertexBuffer          (DeviceResourceHandle handle) = 0;
         virtual void                    activateVertexBuffer        (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor, UInt32 startVertex, EDataType bufferDataType, UInt16 offsetWithinElement, UInt16 stride) = 0;
 
         virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, UInt32 sizeInBytes) = 0;
         virtual void                    uploadIndexBufferData       (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
+        // updates part of buffer whose data was uploaded before using uploadIndexBufferData
+        virtual void                    updateIndexBufferData       (DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) = 0;
         virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) = 0;
         virtual void                    activateIndexBuffer         (DeviceResourceHandle handle) = 0;
 
@@ -24,6 +24,7 @@ namespace ramses_internal
     class WarpingMeshData;
     class ProjectionParams;
     class FrameTimer;
+    class UniformUploadCache;
 
     class IDisplayController
     {
@@ -49,6 +50,11 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
+
+        // number of uniform values uploaded and skipped (because shader had them already) since last call
+        virtual void                    getAndResetUniformUploadCounts(UInt32& numUploaded, UInt32& numSkipped) = 0;
+        // cache of uniform values uploaded per shader, resource management invalidates it for shaders it uploads or deletes
+        virtual UniformUploadCache*     getUniformUploadCache() = 0;
     };
 }
 
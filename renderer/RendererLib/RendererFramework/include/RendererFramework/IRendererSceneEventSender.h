@@ -13,6 +13,7 @@
 #include "SceneAPI/SceneVersionTag.h"
 #include "SceneAPI/DataSlot.h"
 #include "SceneAPI/SceneId.h"
+#include "SceneAPI/ResourceContentHash.h"
 
 namespace ramses_internal
 {
@@ -22,6 +23,7 @@ namespace ramses_internal
         virtual ~IRendererSceneEventSender() {}
 
         virtual void sendSubscribeScene(SceneId sceneId) = 0;
+        virtual void sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources) = 0;
         virtual void sendUnsubscribeScene(SceneId sceneId) = 0;
 
         virtual void sendSceneStateChanged(SceneId masterScene, SceneId referencedScene, RendererSceneState newState) = 0;
@@ -44,6 +44,7 @@ namespace ramses_internal
 
         // IRendererSceneEventSender
         virtual void sendSubscribeScene(SceneId sceneId) override;
+        virtual void sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources) override;
         virtual void sendUnsubscribeScene(SceneId sceneId) override;
         virtual void sendSceneStateChanged(SceneId masterScene, SceneId referencedScene, RendererSceneState newState) override;
         virtual void sendSceneFlushed(SceneId masterScene, SceneId referencedScene, SceneVersionTag tag) override;
@@ -15,6 +15,7 @@
 #include "Components/ManagedResource.h"
 #include "Components/SceneGraphComponent.h"
 #include "SceneReferencing/SceneReferenceEvent.h"
+#include "Components/ResourceAvailabilityEvent.h"
 #include "Components/SceneUpdate.h"
 
 namespace ramses_internal
@@ -82,6 +83,23 @@ namespace ramses_internal
         m_sceneGraphConsumerComponent.subscribeScene(it->value.first, sceneId);
     }
 
+    void RendererFrameworkLogic::sendResourcesAvailable(SceneId sceneId, const ResourceContentHashVector& availableResources)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        auto it = m_sceneClients.find(sceneId);
+        if (it == m_sceneClients.end())
+        {
+            LOG_WARN(CONTEXT_RENDERER, "RendererFrameworkLogic::sendResourcesAvailable: can't send available resources for scene " << sceneId << " because provider unknown");
+            return;
+        }
+
+        ResourceAvailabilityEvent event;
+        event.sceneid = sceneId;
+        event.availableResources = availableResources;
+        LOG_INFO(CONTEXT_RENDERER, "RendererFrameworkLogic::sendResourcesAvailable: sending " << availableResources.size() << " available resources for scene " << sceneId << " to " << it->value.first);
+        m_sceneGraphConsumerComponent.sendResourceAvailabilityEvent(it->value.first, event);
+    }
+
     void RendererFrameworkLogic::sendUnsubscribeScene(SceneId sceneId)
     {
         PlatformGuard guard(m_frameworkLock);
@@ -14,6 +14,7 @@
 #include "MockConnectionStatusUpdateNotifier.h"
 #include "RendererCommandVisitorMock.h"
 #include "MockResourceHash.h"
+#include "Components/ResourceAvailabilityEvent.h"
 
 using namespace testing;
 
@@ -137,6 +138,25 @@ namespace ramses_internal
         fixture.sendSubscribeScene(sceneId);
     }
 
+    TEST_F(ARendererFrameworkLogic, willNotSendResourcesAvailableWhenProviderUnknown)
+    {
+        fixture.sendResourcesAvailable(SceneId{ 123 }, { ResourceContentHash(1u, 2u) });
+    }
+
+    TEST_F(ARendererFrameworkLogic, willSendResourcesAvailableToCorrectProvider)
+    {
+        fixture.handleNewSceneAvailable(SceneInfo(sceneId, sceneName, EScenePublicationMode_LocalAndRemote), providerID);
+        fixture.handleNewSceneAvailable(SceneInfo(SceneId{ 123 }, "foo", EScenePublicationMode_LocalAndRemote), Guid{ 456 });
+
+        const ResourceContentHashVector availableResources{ ResourceContentHash(1u, 2u), ResourceContentHash(3u, 4u) };
+        EXPECT_CALL(sceneGraphConsumerComponent, sendResourceAvailabilityEvent(providerID, _)).WillOnce([&](const auto&, const ResourceAvailabilityEvent& event)
+        {
+            EXPECT_EQ(sceneId, event.sceneid);
+            EXPECT_EQ(availableResources, event.availableResources);
+        });
+        fixture.sendResourcesAvailable(sceneId, availableResources);
+    }
+
     TEST_F(ARendererFrameworkLogic, willNotSendUnsubscribeMessageWhenProviderUnknown)
     {
         fixture.sendUnsubscribeScene(SceneId{ 123 });
@@ -18,11 +18,13 @@ namespace ramses_internal
     class IDevice;
     class RendererLogContext;
     class FrameTimer;
+    class UniformUploadCache;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        // uniform upload cache is optional, if provided it is used to skip uploading of unchanged uniform values
+        RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, UniformUploadCache* uniformUploadCache = nullptr);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
 
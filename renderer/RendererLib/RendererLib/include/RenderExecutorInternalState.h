@@ -22,6 +22,7 @@ namespace ramses_internal
 {
     class IDevice;
     class RendererCachedScene;
+    class UniformUploadCache;
 
     template <typename STATETYPE>
     struct CachedState
@@ -76,7 +77,7 @@ namespace ramses_internal
     class RenderExecutorInternalState
     {
     public:
-        RenderExecutorInternalState(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        RenderExecutorInternalState(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, UniformUploadCache* uniformUploadCache = nullptr);
 
         IDevice&                   getDevice() const;
 
@@ -98,6 +99,8 @@ namespace ramses_internal
 
         Bool hasExceededTimeBudgetForRendering() const;
 
+        UniformUploadCache*        getUniformUploadCache() const;
+
         CachedState < DeviceResourceHandle >    shaderDeviceHandle;
         CachedState < DeviceResourceHandle >    indexBufferDeviceHandle;
         ScissorState                            scissorState;
@@ -127,6 +130,7 @@ namespace ramses_internal
         CachedState < CameraHandle >       m_camera;
 
         const FrameTimer* const            m_frameTimer;
+        UniformUploadCache* const          m_uniformUploadCache;
     };
 
     inline RenderableHandle RenderExecutorInternalState::getRenderable() const
@@ -185,6 +189,11 @@ namespace ramses_internal
         return m_modelViewProjectionMatrix;
     }
 
+    inline UniformUploadCache* RenderExecutorInternalState::getUniformUploadCache() const
+    {
+        return m_uniformUploadCache;
+    }
+
     inline bool RenderExecutorInternalState::hasExceededTimeBudgetForRendering() const
     {
         return m_frameTimer != nullptr ? m_frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : false;
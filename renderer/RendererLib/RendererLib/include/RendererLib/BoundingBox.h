@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGBOX_H
+#define RAMSES_BOUNDINGBOX_H
+
+#include "SceneAPI/EDataType.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Matrix44f.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    // Axis aligned box in model space of a renderable, used for frustum culling.
+    // Default constructed box is empty, infinite box stands for unknown extent and is never culled.
+    struct BoundingBox
+    {
+        Vector3 min{ std::numeric_limits<float>::max() };
+        Vector3 max{ std::numeric_limits<float>::lowest() };
+
+        static BoundingBox Infinite();
+        // computes box of vertex data with 2, 3 or 4 float components per vertex (only xyz is considered),
+        // stride of 0 means tightly packed elements
+        static BoundingBox FromVertexData(const Byte* data, UInt32 dataSize, EDataType elementType, UInt32 offset, UInt32 stride);
+
+        bool isEmpty() const;
+        bool isInfinite() const;
+        void merge(const BoundingBox& other);
+
+        // true if box lies completely outside of the clip space volume after transformation,
+        // works for perspective as well as orthographic projection
+        bool isOutsideFrustum(const Matrix44f& modelViewProjectionMatrix) const;
+    };
+}
+
+#endif
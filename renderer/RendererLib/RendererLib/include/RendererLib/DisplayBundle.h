@@ -29,6 +29,7 @@ namespace ramses_internal
 {
     class IPlatform;
     class IRendererSceneEventSender;
+    class IRendererResourceCache;
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
 
@@ -49,7 +50,7 @@ namespace ramses_internal
     class DisplayBundle : public IDisplayBundle
     {
     public:
-        DisplayBundle(IRendererSceneEventSender& rendererSceneSender, IPlatform& platform, const String& kpiFilename = {});
+        DisplayBundle(IRendererSceneEventSender& rendererSceneSender, IPlatform& platform, const String& kpiFilename = {}, UInt32 transformationUpdateThreadCount = 0u, IRendererResourceCache* rendererResourceCache = nullptr);
 
         virtual void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime) override;
 
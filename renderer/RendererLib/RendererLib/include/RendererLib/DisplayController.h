@@ -13,6 +13,7 @@
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
 #include "RendererLib/Postprocessing.h"
+#include "RendererLib/UniformUploadCache.h"
 #include "EmbeddedCompositingManager.h"
 #include <memory>
 
@@ -51,6 +52,8 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
 
         virtual void validateRenderingStatusHealthy() const override;
+        virtual void getAndResetUniformUploadCounts(UInt32& numUploaded, UInt32& numSkipped) override;
+        virtual UniformUploadCache* getUniformUploadCache() override;
 
     private:
         IRenderBackend&         m_renderBackend;
@@ -61,6 +64,7 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+        UniformUploadCache      m_uniformUploadCache;
     };
 }
 
@@ -10,6 +10,7 @@
 #define RAMSES_DISPLAYDISPATCHER_H
 
 #include "RendererLib/DisplayBundle.h"
+#include "RendererLib/DisplayThread.h"
 #include "RendererLib/RendererConfig.h"
 #include "RendererLib/SceneDisplayTracker.h"
 #include "RendererAPI/ELoopMode.h"
@@ -39,6 +40,7 @@ namespace ramses_internal
 {
     class RendererCommandBuffer;
     class IRendererSceneEventSender;
+    class IRendererResourceCache;
     class Ramsh;
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
@@ -49,11 +51,21 @@ namespace ramses_internal
         DisplayDispatcher(
             const RendererConfig& config,
             RendererCommandBuffer& commandBuffer,
-            IRendererSceneEventSender& rendererSceneSender);
-        virtual ~DisplayDispatcher() = default;
+            IRendererSceneEventSender& rendererSceneSender,
+            IRendererResourceCache* rendererResourceCache = nullptr);
+        virtual ~DisplayDispatcher();
 
         void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime = std::chrono::microseconds{0});
 
+        // only relevant if display threads are enabled in renderer config,
+        // each display is then updated and rendered in its own thread independently of doOneLoop
+        bool isUsingDisplayThreads() const;
+        void startDisplayThreadsUpdating();
+        void stopDisplayThreadsUpdating();
+        void setLoopMode(ELoopMode loopMode);
+        void setMinFrameDuration(std::chrono::microseconds minFrameDuration);
+        void setMinFrameDuration(std::chrono::microseconds minFrameDuration, DisplayHandle display);
+
         void dispatchRendererEvents(RendererEventVector& events);
         void dispatchSceneControlEvents(RendererEventVector& events);
         void injectRendererEvent(RendererEvent&& event);
@@ -74,6 +86,8 @@ namespace ramses_internal
             std::unique_ptr<IPlatform> m_platform;
             std::unique_ptr<IDisplayBundle> m_displayBundle;
             RendererCommands m_pendingCommands;
+            // must be declared last so that thread is stopped before any of the above is destroyed
+            std::unique_ptr<DisplayThread> m_displayThread;
         };
         // virtual to allow mock of display thread
         virtual Display createDisplayBundle();
@@ -81,6 +95,14 @@ namespace ramses_internal
         const RendererConfig m_rendererConfig;
         RendererCommandBuffer& m_pendingCommandsToDispatch;
         IRendererSceneEventSender& m_rendererSceneSender;
+        // shared by all displays
+        IRendererResourceCache* m_rendererResourceCache;
+
+        const bool m_useDisplayThreads;
+        bool m_displayThreadsUpdating = false;
+        ELoopMode m_displayThreadsLoopMode = ELoopMode::UpdateAndRender;
+        std::chrono::microseconds m_displayThreadsMinFrameDuration{ std::chrono::microseconds(std::chrono::seconds(1)) / 60 }; // 60fps
+        std::unordered_map<DisplayHandle, std::chrono::microseconds> m_minFrameDurationsPerDisplay;
 
         SceneDisplayTracker m_sceneDisplayTracker;
         // use map to keep displays ordered
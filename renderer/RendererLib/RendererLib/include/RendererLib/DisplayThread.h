@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DISPLAYTHREAD_H
+#define RAMSES_DISPLAYTHREAD_H
+
+#include "RendererAPI/ELoopMode.h"
+#include "RendererAPI/Types.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <chrono>
+
+namespace ramses_internal
+{
+    class IDisplayBundle;
+
+    // Drives a single display bundle in its own thread with its own loop timing,
+    // so that a slow display does not delay the other displays.
+    class DisplayThread : public Runnable
+    {
+    public:
+        DisplayThread(IDisplayBundle& displayBundle, DisplayHandle displayHandle);
+        virtual ~DisplayThread() override;
+
+        void startUpdating();
+        void stopUpdating();
+        bool isUpdating() const;
+
+        void setLoopMode(ELoopMode loopMode);
+        void setMinFrameDuration(std::chrono::microseconds minFrameDuration);
+        std::chrono::microseconds getMinFrameDuration() const;
+
+        // display bundle holds graphical resources bound to this thread, it must be therefore destroyed within it
+        void destroyDisplayBundle(std::unique_ptr<IDisplayBundle>& displayBundle);
+
+    private:
+        virtual void run() override;
+
+        static std::chrono::milliseconds SleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration);
+
+        IDisplayBundle& m_displayBundle;
+        PlatformThread m_thread;
+
+        mutable std::mutex m_lock;
+        std::condition_variable m_sleepConditionVar;
+        std::condition_variable m_bundleDestroyedCondVar;
+        bool m_doUpdate = false;
+        ELoopMode m_loopMode = ELoopMode::UpdateAndRender;
+        std::chrono::microseconds m_minFrameDuration{ std::chrono::microseconds(std::chrono::seconds(1)) / 60 }; // 60fps
+        std::unique_ptr<IDisplayBundle>* m_bundleToDestroy = nullptr;
+    };
+}
+
+#endif
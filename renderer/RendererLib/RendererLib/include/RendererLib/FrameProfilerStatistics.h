@@ -24,6 +24,7 @@ namespace ramses_internal
         enum class ERegion
         {
             ExecuteRendererCommands = 0,
+            DecompressResources,
             UpdateClientResources,
             ApplySceneActions,
             UpdateSceneResources,
@@ -156,6 +157,7 @@ namespace ramses_internal
     static const char* RegionNames[] =
     {
         "RendererCommands",
+        "DecompressResources",
         "UpdateClientResources",
         "ApplySceneActions",
         "UpdateSceneResources",
@@ -64,7 +64,7 @@ namespace ramses_internal
 
         virtual void             uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, UInt32 dataSizeInBytes, SceneId sceneId) = 0;
         virtual void             unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) = 0;
-        virtual void             updateDataBuffer(DataBufferHandle handle, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId) = 0;
+        virtual void             updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId) = 0;
 
         virtual void             uploadTextureBuffer(TextureBufferHandle textureBufferHandle, UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount,  SceneId sceneId) = 0;
         virtual void             unloadTextureBuffer(TextureBufferHandle textureBufferHandle, SceneId sceneId) = 0;
@@ -13,6 +13,7 @@
 #include "SceneAPI/Handles.h"
 #include "SceneAPI/SceneId.h"
 #include "RendererAPI/Types.h"
+#include "RendererLib/BoundingBox.h"
 
 namespace ramses_internal
 {
@@ -32,6 +33,7 @@ namespace ramses_internal
         virtual DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle textureBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getTextureSamplerDeviceHandle(TextureSamplerHandle textureSamplerHandle, SceneId sceneId) const = 0;
+        virtual BoundingBox          getVertexArrayBoundingBox(const ResourceContentHash& resourceHash) const = 0;
     };
 }
 #endif
@@ -52,10 +52,12 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle allocateVertexBuffer(UInt32 totalSizeInBytes) override;
         virtual void uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void updateVertexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) override;
         virtual void deleteVertexBuffer(DeviceResourceHandle handle) override;
         virtual void activateVertexBuffer(DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor, UInt32 startVertex, EDataType bufferDataType, UInt16 offsetWithinElement, UInt16 stride) override;
         virtual DeviceResourceHandle allocateIndexBuffer(EDataType dataType, UInt32 sizeInBytes) override;
         virtual void uploadIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void updateIndexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte* data, UInt32 dataSize) override;
         virtual void deleteIndexBuffer(DeviceResourceHandle handle) override;
         virtual void activateIndexBuffer(DeviceResourceHandle handle) override;
         virtual std::unique_ptr<const GPUResource> uploadShader(const EffectResource& effect) override;
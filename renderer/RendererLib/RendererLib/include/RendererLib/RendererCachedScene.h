@@ -11,6 +11,8 @@
 
 #include "RendererLib/TextureLinkCachedScene.h"
 #include "RenderingPassInfo.h"
+#include "RendererLib/BoundingBox.h"
+#include "Math3d/Quad.h"
 
 namespace ramses_internal
 {
@@ -29,12 +31,36 @@ namespace ramses_internal
         void markAllRenderOncePassesAsRendered() const;
 
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        virtual void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
+        virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
+        virtual void                        setDataResource                 (DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor, UInt16 offsetWithinElementInBytes, UInt16 stride) override;
+
+        virtual DataInstanceHandle          allocateDataInstance            (DataLayoutHandle handle, DataInstanceHandle instanceHandle = DataInstanceHandle::Invalid()) override;
+        virtual void                        setDataFloatArray               (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data) override;
+        virtual void                        setDataVector2fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data) override;
+        virtual void                        setDataVector3fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data) override;
+        virtual void                        setDataVector4fArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data) override;
+        virtual void                        setDataIntegerArray             (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data) override;
+        virtual void                        setDataVector2iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data) override;
+        virtual void                        setDataVector3iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data) override;
+        virtual void                        setDataVector4iArray            (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data) override;
+        virtual void                        setDataMatrix22fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data) override;
+        virtual void                        setDataMatrix33fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data) override;
+        virtual void                        setDataMatrix44fArray           (DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data) override;
+        virtual void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
+
+        virtual DataBufferHandle            allocateDataBuffer              (EDataBufferType dataBufferType, EDataType dataType, UInt32 maximumSizeInBytes, DataBufferHandle handle = DataBufferHandle::Invalid()) override;
+        virtual void                        updateDataBuffer                (DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data) override;
+        virtual TextureBufferHandle         allocateTextureBuffer           (ETextureFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle = TextureBufferHandle::Invalid()) override;
+        virtual void                        updateTextureBuffer             (TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data) override;
 
         virtual void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         virtual void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order) override;
         virtual void                        removeRenderableFromRenderGroup (RenderGroupHandle groupHandle, RenderableHandle renderableHandle) override;
 
+        virtual RenderPassHandle            allocateRenderPass              (UInt32 renderGroupCount = 0u, RenderPassHandle passHandle = RenderPassHandle::Invalid()) override;
         virtual void                        releaseRenderPass               (RenderPassHandle passHandle) override;
+        virtual void                        setRenderPassCamera             (RenderPassHandle passHandle, CameraHandle cameraHandle) override;
         virtual void                        setRenderPassRenderOrder        (RenderPassHandle passHandle, Int32 renderOrder) override;
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, Bool isEnabled) override;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, Bool enable) override;
@@ -52,20 +78,96 @@ namespace ramses_internal
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
         const Matrix44f&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
+        const BoundingBox&                  getRenderableBoundingBox        (RenderableHandle renderable) const;
+
+        // Changes whenever any uniform value of given data instance (including referenced data instances) changes.
+        // Generations are unique across all scenes, same generation therefore means same uniform values.
+        UInt64                              getUniformDataGeneration        (DataInstanceHandle uniformDataInstance) const;
+
+        virtual void                        resetResourceCache              () override;
+
+        // Parts of data/texture buffers modified since they were last uploaded, only those need to be uploaded again.
+        // Whole buffer is dirty after its allocation and after resource cache reset (device buffers are created anew then).
+        struct DirtyByteRange
+        {
+            UInt32 begin = 0u;
+            UInt32 end = 0u;
+        };
+        const DirtyByteRange&               getDataBufferDirtyRange         (DataBufferHandle handle) const;
+        const Quad&                         getTextureBufferDirtyRegion     (TextureBufferHandle handle, UInt32 mipLevel) const;
+        void                                markDataBufferUploaded          (DataBufferHandle handle) const;
+        void                                markTextureBufferUploaded       (TextureBufferHandle handle) const;
 
     private:
+        // Ordered renderables are cached per render group (flattened including nested groups) and per render pass,
+        // so that a change within a group only re-sorts that group and re-merges the lists containing it.
+        struct OrderCacheState
+        {
+            Bool needsSorting = true;
+            Bool needsRebuild = true;
+        };
+        struct RenderGroupOrderCache
+        {
+            RenderableVector orderedRenderables;
+            OrderCacheState state;
+            UInt32 lastCheckedUpdate = 0u;
+            Bool changedInLastCheckedUpdate = false;
+        };
+
         void updatePassRenderableSorting();
+        void updateSortedRenderingPasses();
         void updateRenderablesInPass(RenderPassHandle passHandle);
-        void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        Bool updateRenderGroupOrderCache(RenderGroupHandle renderGroupHandle);
         Bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
 
+        void updateRenderableBoundingBoxes(const IResourceDeviceHandleAccessor& resourceAccessor);
+        BoundingBox computeRenderableBoundingBox(RenderableHandle renderable, const IResourceDeviceHandleAccessor& resourceAccessor) const;
+        UInt64 getVertexDataChangeStamp(RenderableHandle renderable) const;
+        void stampDataInstance(DataInstanceHandle dataInstance);
+
+        RenderGroupOrderCache& getRenderGroupOrderCache(RenderGroupHandle renderGroupHandle);
+        OrderCacheState& getPassOrderCacheState(RenderPassHandle passHandle);
+        void markRenderGroupDirty(RenderGroupHandle renderGroupHandle, Bool needsSorting);
+        void markRenderGroupsOfRenderableDirty(RenderableHandle renderableHandle, Bool needsSorting);
+        void markPassDirty(RenderPassHandle passHandle);
+        void markAllRenderGroupsAndPassesDirty();
+        void removeRenderGroupParent(RenderGroupHandle groupHandle, RenderGroupHandle parentGroupHandle);
+
         RenderingPassInfoVector m_sortedRenderingPasses;
         using PassRenderableOrder = std::vector<RenderableVector>;
         PassRenderableOrder     m_passRenderableOrder;
-        mutable Bool            m_renderableOrderingDirty;
+        std::vector<OrderCacheState> m_passOrderCacheStates;
+        std::vector<RenderGroupOrderCache> m_renderGroupOrderCaches;
+        // reverse lookup of groups containing a renderable, to invalidate only those on renderable change
+        std::vector<std::vector<RenderGroupHandle>> m_renderableRenderGroups;
+        // reverse lookup of groups containing a nested group, dirty group invalidates all its parents,
+        // so that a group cached while reached only through some passes is never considered unchanged by others
+        std::vector<std::vector<RenderGroupHandle>> m_renderGroupParentGroups;
+        UInt32                  m_renderableOrderUpdateCounter = 0u;
+        mutable Bool            m_renderingPassesDirty;
+        Bool                    m_renderableOrderingDirty;
 
         using MatrixVector = std::vector<Matrix44f>;
         MatrixVector            m_renderableMatrices;
+        NodeHandleVector        m_renderableNodes;
+
+        // Bounding boxes in model space, computed only for renderables in passes with frustum culling.
+        // Box is recomputed if any of its sources has newer change stamp.
+        struct BoundingBoxCacheEntry
+        {
+            BoundingBox box = BoundingBox::Infinite();
+            UInt64 changeStamp = 0u;
+            Bool valid = false;
+        };
+        std::vector<BoundingBoxCacheEntry> m_renderableBoundingBoxes;
+
+        // Data changes are stamped with globally increasing counter
+        std::vector<UInt64>     m_dataInstanceChangeStamps;
+        std::vector<UInt64>     m_dataBufferChangeStamps;
+
+        // uploading happens on const scene, like rendering of render once passes
+        mutable std::vector<DirtyByteRange>     m_dataBufferDirtyRanges;
+        mutable std::vector<std::vector<Quad>>  m_textureBufferDirtyRegions;
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
@@ -41,6 +41,12 @@ namespace ramses_internal
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+
+        void enableDisplayThreads(bool enable);
+        Bool getDisplayThreadsEnabled() const;
+
+        void setTransformationUpdateThreadCount(UInt32 threadCount);
+        UInt32 getTransformationUpdateThreadCount() const;
     private:
         String m_waylandSocketEmbedded;
         String m_waylandSocketEmbeddedGroupName;
@@ -51,6 +57,8 @@ namespace ramses_internal
         String m_kpiFilename;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        Bool m_displayThreadsEnabled = false;
+        UInt32 m_transformationUpdateThreadCount = 0u;
     };
 }
 
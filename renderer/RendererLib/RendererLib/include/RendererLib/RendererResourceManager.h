@@ -28,6 +28,7 @@ namespace ramses_internal
     class RendererStatistics;
     class IBinaryShaderCache;
     class IResourceUploader;
+    class UniformUploadCache;
 
     class RendererResourceManager : public IRendererResourceManager
     {
@@ -40,7 +41,8 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 gpuCacheSize = 0u);
+            UInt64 gpuCacheSize = 0u,
+            UniformUploadCache* uniformUploadCache = nullptr);
         virtual ~RendererResourceManager();
 
         // Immutable resources
@@ -52,6 +54,7 @@ namespace ramses_internal
         virtual void                 uploadAndUnloadPendingResources() override;
 
         virtual DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& hash) const override;
+        virtual BoundingBox          getVertexArrayBoundingBox(const ResourceContentHash& hash) const override;
         virtual EResourceStatus      getResourceStatus(const ResourceContentHash& hash) const override;
         virtual EResourceType        getResourceType(const ResourceContentHash& hash) const override;
 
@@ -84,7 +87,7 @@ namespace ramses_internal
 
         virtual void                 uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, UInt32 dataSizeInBytes, SceneId sceneId) override;
         virtual void                 unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) override;
-        virtual void                 updateDataBuffer(DataBufferHandle handle, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId) override;
+        virtual void                 updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId) override;
         virtual DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const override;
 
         virtual void                 uploadTextureBuffer(TextureBufferHandle textureBufferHandle, UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount, SceneId sceneId) override;
@@ -32,6 +32,7 @@ namespace ramses_internal
 
         EResourceStatus            getResourceStatus    (const ResourceContentHash& hash) const;
         const ResourceDescriptor&  getResourceDescriptor(const ResourceContentHash& hash) const;
+        const BoundingBox&         getVertexArrayBoundingBox(const ResourceContentHash& hash) const;
 
         const ResourceDescriptors& getAllResourceDescriptors() const;
         const ResourceContentHashVector& getAllProvidedResources() const;
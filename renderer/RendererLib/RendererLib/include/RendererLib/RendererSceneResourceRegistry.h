@@ -61,6 +61,7 @@ namespace ramses_internal
         void                            removeDataBuffer            (DataBufferHandle handle);
         DeviceResourceHandle            getDataBufferDeviceHandle   (DataBufferHandle handle) const;
         EDataBufferType                 getDataBufferType           (DataBufferHandle handle) const;
+        UInt32                          getDataBufferByteSize       (DataBufferHandle handle) const;
         void                            getAllDataBuffers           (DataBufferHandleVector& dataBuffers) const;
 
         void                            addTextureBuffer            (TextureBufferHandle handle, DeviceResourceHandle deviceHandle, ETextureFormat format, UInt32 size);
@@ -13,6 +13,7 @@
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "SceneAPI/SceneId.h"
 #include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "RendererLib/StagingInfo.h"
 #include "RendererLib/BufferLinks.h"
@@ -22,7 +23,9 @@
 #include "RendererLib/IRendererResourceManager.h"
 #include "Scene/EScenePublicationMode.h"
 #include "AsyncEffectUploader.h"
+#include "RendererLib/ResourceDecompressor.h"
 #include <unordered_map>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -42,6 +45,7 @@ namespace ramses_internal
     class ISceneReferenceLogic;
     class IRenderBackend;
     class IPlatform;
+    class WorldMatrixUpdateExecutor;
 
     class RendererSceneUpdater : public IRendererSceneUpdater, public IRendererSceneStateControl
     {
@@ -98,6 +102,8 @@ namespace ramses_internal
         void processScreenshotResults();
         bool hasPendingFlushes(SceneId sceneId) const;
         void setSceneReferenceLogicHandler(ISceneReferenceLogic& sceneRefLogic);
+        // zero threads (default) updates scenes sequentially in renderer thread
+        void setTransformationUpdateThreadCount(UInt32 threadCount);
 
     protected:
         virtual std::unique_ptr<IRendererResourceManager> createResourceManager(
@@ -122,9 +128,12 @@ namespace ramses_internal
         bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
 
         void logTooManyFlushesAndUnsubscribeIfRemoteScene(SceneId sceneId, std::size_t numPendingFlushes);
+        bool loadResourcesNotSentWithSceneUpdate(const ResourceContentHashVector& resourcesAdded, ManagedResourceVector& resources);
+        ResourceContentHashVector getResourcesAvailableInCache();
         void consolidatePendingSceneActions(SceneId sceneID, SceneUpdate&& sceneUpdate);
         void consolidateResourceDataForMapping(SceneId sceneID);
         void referenceAndProvidePendingResourceData(SceneId sceneID, DisplayHandle display);
+        void waitForDecompressionOfResourceDataToProvide();
         void requestAndUploadAndUnloadResources(DisplayHandle& activeDisplay);
         void uploadUpdatedECStreams(DisplayHandle& activeDisplay);
         void tryToApplyPendingFlushes();
@@ -154,11 +163,14 @@ namespace ramses_internal
         SceneExpirationMonitor&                           m_expirationMonitor;
         ISceneReferenceLogic*                             m_sceneReferenceLogic = nullptr;
         IRendererResourceCache*                           m_rendererResourceCache = nullptr;
+        // resources stored in or loaded from renderer resource cache, cache cannot be queried for its content
+        HashSet<ResourceContentHash>                      m_resourcesAvailableInCache;
 
         AnimationSystemFactory                            m_animationSystemFactory;
 
         std::unordered_map<DisplayHandle, std::unique_ptr<IRendererResourceManager>> m_displayResourceManagers;
         std::unordered_map<DisplayHandle, std::unique_ptr<AsyncEffectUploader>> m_asyncEffectUploaders;
+        ResourceDecompressor                              m_resourceDecompressor;
 
         struct SceneMapRequest
         {
@@ -171,6 +183,8 @@ namespace ramses_internal
 
         // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
+        std::vector<RendererCachedScene*> m_independentScenesForTransformationCacheUpdate;
+        std::unique_ptr<WorldMatrixUpdateExecutor> m_worldMatrixUpdateExecutor;
 
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
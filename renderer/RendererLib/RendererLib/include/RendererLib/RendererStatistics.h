@@ -26,6 +26,8 @@ namespace ramses_internal
     public:
         Float  getFps() const;
         UInt32 getDrawCallsPerFrame() const;
+        UInt32 getUniformsUploadedPerFrame() const;
+        UInt32 getUniformsSkippedPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
         void trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedResources, UInt numRemovedResources, UInt numSceneResourceActions, std::chrono::milliseconds latency);
@@ -39,6 +41,7 @@ namespace ramses_internal
         void resourceUploaded(UInt byteSize);
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
         void streamTextureUpdated(WaylandIviSurfaceId sourceId, UInt numUpdates);
+        void uniformsUploaded(UInt32 numUploaded, UInt32 numSkipped);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, const String& name, SceneId sceneid);
 
         void untrackScene(SceneId sceneId);
@@ -54,6 +57,8 @@ namespace ramses_internal
         Int32 m_frameNumber = 0;
         UInt64 m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         UInt32 m_drawCalls = 0u;
+        UInt m_uniformsUploaded = 0u;
+        UInt m_uniformsSkipped = 0u;
         UInt64 m_lastFrameTick = 0u;
         UInt32 m_frameDurationMin = std::numeric_limits<UInt32>::max();
         UInt32 m_frameDurationMax = 0u;
@@ -50,7 +50,7 @@ namespace ramses_internal
         virtual RenderTargetHandle          allocateRenderTarget        (RenderTargetHandle targetHandle = RenderTargetHandle::Invalid()) override;
         virtual BlitPassHandle              allocateBlitPass            (RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle = BlitPassHandle::Invalid()) override;
 
-        void                                resetResourceCache();
+        virtual void                        resetResourceCache();
 
         Bool                                renderableResourcesDirty    (RenderableHandle handle) const;
         Bool                                renderableResourcesDirty    (const RenderableVector& handles) const;
@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEDECOMPRESSOR_H
+#define RAMSES_RESOURCEDECOMPRESSOR_H
+
+#include "Components/ManagedResource.h"
+#include "PlatformAbstraction/PlatformThread.h"
+
+#include <deque>
+#include <unordered_set>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses_internal
+{
+    // Decompresses resources received from client in a worker thread, so that render thread
+    // does not need to do it right before upload.
+    // Resource is decompressed by whichever thread gets to it first, i.e. if render thread needs
+    // resource which was not picked by worker yet, it is decompressed in render thread right away.
+    class ResourceDecompressor : private Runnable
+    {
+    public:
+        ResourceDecompressor();
+        ~ResourceDecompressor();
+
+        ResourceDecompressor(const ResourceDecompressor&) = delete;
+        ResourceDecompressor& operator=(const ResourceDecompressor&) = delete;
+
+        // resource is queued only if it has compressed data and was not decompressed yet
+        void decompressAsync(const ManagedResource& resource);
+        // blocks until resource data is decompressed, decompresses in calling thread if not started yet by worker
+        void waitForDecompression(const IResource& resource);
+
+        size_t getNumberOfQueuedResources() const;
+
+    private:
+        virtual void run() override;
+
+        PlatformThread m_thread;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_newResourceCondition;
+        std::condition_variable m_decompressionFinishedCondition;
+
+        std::deque<ManagedResource> m_resourcesToDecompress;
+        // resources from queue not taken over by other thread yet, queue entries not contained here are skipped
+        std::unordered_set<const IResource*> m_queuedResources;
+        const IResource* m_resourceInProgress = nullptr;
+    };
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "RendererAPI/Types.h"
 #include "SceneAPI/SceneId.h"
 #include "SceneAPI/ResourceContentHash.h"
+#include "RendererLib/BoundingBox.h"
 #include "Components/ManagedResource.h"
 #include "Collections/HashMap.h"
 
@@ -30,6 +31,9 @@ namespace ramses_internal
         UInt32 compressedSize = 0;
         UInt32 decompressedSize = 0;
         UInt32 vramSize = 0;
+        // extent of vertex array, computed from the vertex data kept after upload when first needed for culling
+        mutable ManagedResource boundingBoxSource;
+        mutable BoundingBox boundingBox = BoundingBox::Infinite();
     };
 
     using ResourceDescriptors = HashMap<ResourceContentHash, ResourceDescriptor>;
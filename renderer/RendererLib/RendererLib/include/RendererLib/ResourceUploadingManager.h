@@ -21,6 +21,7 @@ namespace ramses_internal
     struct RenderBuffer;
     class FrameTimer;
     class RendererStatistics;
+    class UniformUploadCache;
 
     class ResourceUploadingManager
     {
@@ -33,7 +34,8 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 gpuCacheSize);
+            UInt64 gpuCacheSize,
+            UniformUploadCache* uniformUploadCache = nullptr);
         ~ResourceUploadingManager();
 
         Bool hasAnythingToUpload() const;
@@ -68,6 +70,7 @@ namespace ramses_internal
         const UInt64  m_resourceCacheSize = 0u;
 
         RendererStatistics& m_stats;
+        UniformUploadCache* const m_uniformUploadCache;
     };
 }
 
@@ -14,6 +14,7 @@
 namespace ramses_internal
 {
     class IScene;
+    class RendererCachedScene;
     class IRendererResourceManager;
 
     class SceneResourceUploader
@@ -23,7 +24,9 @@ namespace ramses_internal
         static void UploadRenderBuffer(const IScene& scene, RenderBufferHandle renderBuffer, IRendererResourceManager& resourceManager);
         static void UploadBlitPassRenderTargets(const IScene& scene, BlitPassHandle blitPass, IRendererResourceManager& resourceManager);
         static void UploadTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
-        static void UpdateTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
+        // data and texture buffers are updated only in parts modified since their last upload
+        static void UpdateDataBuffer(const RendererCachedScene& scene, DataBufferHandle dataBuffer, IRendererResourceManager& resourceManager);
+        static void UpdateTextureBuffer(const RendererCachedScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
     };
 }
 
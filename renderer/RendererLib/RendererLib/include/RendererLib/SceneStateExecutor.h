@@ -11,6 +11,7 @@
 
 #include "RendererLib/SceneStateInfo.h"
 #include "Scene/EScenePublicationMode.h"
+#include "SceneAPI/ResourceContentHash.h"
 
 namespace ramses_internal
 {
@@ -27,7 +28,8 @@ namespace ramses_internal
 
         void setPublished                     (SceneId sceneId, EScenePublicationMode mode);
         void setUnpublished                   (SceneId sceneId);
-        void setSubscriptionRequested         (SceneId sceneId);
+        // resources available at renderer are announced to scene provider right before subscription request
+        void setSubscriptionRequested         (SceneId sceneId, const ResourceContentHashVector& availableResources = {});
         void setSubscriptionPending           (SceneId sceneId);
         void setSubscribed                    (SceneId sceneId);
         void setUnsubscribed                  (SceneId sceneId, bool indirect);
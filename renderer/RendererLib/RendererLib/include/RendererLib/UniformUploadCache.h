@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UNIFORMUPLOADCACHE_H
+#define RAMSES_UNIFORMUPLOADCACHE_H
+
+#include "SceneAPI/Handles.h"
+#include "RendererAPI/Types.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Shader programs keep their uniform values between draw calls (and frames), this remembers
+    // for each shader which uniform data were uploaded last, so that re-uploading unchanged values can be skipped.
+    // Uniform data are identified by data instance and its generation (see RendererCachedScene::getUniformDataGeneration).
+    class UniformUploadCache
+    {
+    public:
+        Bool isUploaded(DeviceResourceHandle shader, DataInstanceHandle uniformData, UInt64 generation) const;
+        void setUploaded(DeviceResourceHandle shader, DataInstanceHandle uniformData, UInt64 generation);
+        // device handles of deleted shaders get reused, must be called whenever a shader is uploaded or deleted
+        void invalidateShader(DeviceResourceHandle shader);
+
+        void countUniforms(UInt32 numUploaded, UInt32 numSkipped);
+        void getAndResetUniformCounts(UInt32& numUploaded, UInt32& numSkipped);
+
+    private:
+        struct ShaderUniformState
+        {
+            DataInstanceHandle uniformData;
+            UInt64 generation = 0u;
+        };
+        std::vector<ShaderUniformState> m_shaderUniformStates;
+
+        UInt32 m_numUploaded = 0u;
+        UInt32 m_numSkipped = 0u;
+    };
+}
+
+#endif
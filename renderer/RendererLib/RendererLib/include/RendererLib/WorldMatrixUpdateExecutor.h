@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_WORLDMATRIXUPDATEEXECUTOR_H
+#define RAMSES_WORLDMATRIXUPDATEEXECUTOR_H
+
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses_internal
+{
+    class RendererCachedScene;
+
+    // Updates renderable world matrices of multiple scenes in parallel using a pool of worker threads.
+    // Workers (and calling thread) pick scenes one by one from shared list until all are processed,
+    // so that a scene with large transformation hierarchy does not block distribution of remaining scenes.
+    // Scenes must be independent of each other, i.e. not linked via transformation links.
+    class WorldMatrixUpdateExecutor
+    {
+    public:
+        explicit WorldMatrixUpdateExecutor(UInt16 workerCount);
+        ~WorldMatrixUpdateExecutor();
+
+        WorldMatrixUpdateExecutor(const WorldMatrixUpdateExecutor&) = delete;
+        WorldMatrixUpdateExecutor& operator=(const WorldMatrixUpdateExecutor&) = delete;
+
+        // blocks until world matrices of all given scenes are updated
+        void updateRenderableWorldMatrices(const std::vector<RendererCachedScene*>& scenes);
+
+    private:
+        class UpdateTask : public ITask
+        {
+        public:
+            explicit UpdateTask(WorldMatrixUpdateExecutor& executor);
+            virtual void execute() override;
+
+        private:
+            WorldMatrixUpdateExecutor& m_executor;
+        };
+
+        void updateScenesFromQueue();
+
+        std::vector<UpdateTask*> m_tasks;
+
+        const std::vector<RendererCachedScene*>* m_scenes = nullptr;
+        std::atomic<size_t> m_nextSceneIdx{ 0u };
+
+        std::mutex m_finishedLock;
+        std::condition_variable m_finishedCondition;
+        size_t m_pendingTasks = 0u;
+
+        ThreadedTaskExecutor m_threadPool;
+    };
+}
+
+#endif
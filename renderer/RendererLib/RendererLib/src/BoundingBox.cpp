@@ -0,0 +1,115 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/BoundingBox.h"
+#include "Math3d/Vector4.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ramses_internal
+{
+    BoundingBox BoundingBox::Infinite()
+    {
+        BoundingBox box;
+        box.min = Vector3(-std::numeric_limits<float>::infinity());
+        box.max = Vector3(std::numeric_limits<float>::infinity());
+        return box;
+    }
+
+    BoundingBox BoundingBox::FromVertexData(const Byte* data, UInt32 dataSize, EDataType elementType, UInt32 offset, UInt32 stride)
+    {
+        UInt32 numComponents = 0u;
+        switch (elementType)
+        {
+        case EDataType::Vector2F:
+            numComponents = 2u;
+            break;
+        case EDataType::Vector3F:
+        case EDataType::Vector4F:
+            numComponents = 3u;
+            break;
+        default:
+            assert(false);
+            return Infinite();
+        }
+
+        const UInt32 elementSize = (stride > 0u ? stride : EnumToSize(elementType));
+        const UInt32 readSize = numComponents * sizeof(float);
+
+        BoundingBox box;
+        for (UInt32 elementOffset = offset; elementOffset + readSize <= dataSize; elementOffset += elementSize)
+        {
+            float v[3] = { 0.f, 0.f, 0.f };
+            // vertex data is not guaranteed to be float aligned (interleaved byte blobs)
+            std::memcpy(v, data + elementOffset, readSize);
+            if (!std::isfinite(v[0]) || !std::isfinite(v[1]) || !std::isfinite(v[2]))
+                return Infinite();
+
+            box.min.x = std::min(box.min.x, v[0]);
+            box.min.y = std::min(box.min.y, v[1]);
+            box.min.z = std::min(box.min.z, v[2]);
+            box.max.x = std::max(box.max.x, v[0]);
+            box.max.y = std::max(box.max.y, v[1]);
+            box.max.z = std::max(box.max.z, v[2]);
+        }
+
+        return box;
+    }
+
+    bool BoundingBox::isEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    bool BoundingBox::isInfinite() const
+    {
+        return std::isinf(min.x) || std::isinf(min.y) || std::isinf(min.z)
+            || std::isinf(max.x) || std::isinf(max.y) || std::isinf(max.z);
+    }
+
+    void BoundingBox::merge(const BoundingBox& other)
+    {
+        min.x = std::min(min.x, other.min.x);
+        min.y = std::min(min.y, other.min.y);
+        min.z = std::min(min.z, other.min.z);
+        max.x = std::max(max.x, other.max.x);
+        max.y = std::max(max.y, other.max.y);
+        max.z = std::max(max.z, other.max.z);
+    }
+
+    bool BoundingBox::isOutsideFrustum(const Matrix44f& modelViewProjectionMatrix) const
+    {
+        if (isInfinite())
+            return false;
+        if (isEmpty())
+            return true;
+
+        // box is outside if all its corners lie on the outer side of one of the clip planes
+        // (-w <= x,y,z <= w), conservative - boxes intersecting frustum only diagonally are kept
+        UInt32 outsideLeft = 0u;
+        UInt32 outsideRight = 0u;
+        UInt32 outsideBottom = 0u;
+        UInt32 outsideTop = 0u;
+        UInt32 outsideNear = 0u;
+        UInt32 outsideFar = 0u;
+        for (UInt32 i = 0u; i < 8u; ++i)
+        {
+            const Vector4 corner((i & 1u) ? max.x : min.x, (i & 2u) ? max.y : min.y, (i & 4u) ? max.z : min.z, 1.f);
+            const Vector4 clip = modelViewProjectionMatrix * corner;
+            outsideLeft   += (clip.x < -clip.w ? 1u : 0u);
+            outsideRight  += (clip.x >  clip.w ? 1u : 0u);
+            outsideBottom += (clip.y < -clip.w ? 1u : 0u);
+            outsideTop    += (clip.y >  clip.w ? 1u : 0u);
+            outsideNear   += (clip.z < -clip.w ? 1u : 0u);
+            outsideFar    += (clip.z >  clip.w ? 1u : 0u);
+        }
+
+        return outsideLeft == 8u || outsideRight == 8u || outsideBottom == 8u || outsideTop == 8u || outsideNear == 8u || outsideFar == 8u;
+    }
+}
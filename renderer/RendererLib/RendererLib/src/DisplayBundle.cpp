@@ -16,18 +16,19 @@
 
 namespace ramses_internal
 {
-    DisplayBundle::DisplayBundle(IRendererSceneEventSender& rendererSceneSender, IPlatform& platform, const String& kpiFilename)
+    DisplayBundle::DisplayBundle(IRendererSceneEventSender& rendererSceneSender, IPlatform& platform, const String& kpiFilename, UInt32 transformationUpdateThreadCount, IRendererResourceCache* rendererResourceCache)
         : m_rendererScenes(m_rendererEventCollector)
         , m_expirationMonitor(m_rendererScenes, m_rendererEventCollector)
         , m_renderer(platform, m_rendererScenes, m_rendererEventCollector, m_frameTimer, m_expirationMonitor, m_rendererStatistics)
         , m_sceneStateExecutor(m_renderer, rendererSceneSender, m_rendererEventCollector)
-        , m_rendererSceneUpdater(platform, m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_expirationMonitor)
+        , m_rendererSceneUpdater(platform, m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_expirationMonitor, rendererResourceCache)
         , m_sceneControlLogic(m_rendererSceneUpdater)
         , m_rendererCommandExecutor(m_renderer, m_pendingCommands, m_rendererSceneUpdater, m_sceneControlLogic, m_rendererEventCollector, m_frameTimer)
         , m_sceneReferenceLogic(m_rendererScenes, m_sceneControlLogic, m_rendererSceneUpdater, rendererSceneSender, m_sceneReferenceOwnership)
         , m_kpiMonitor(kpiFilename.empty() ? nullptr : new Monitor(kpiFilename))
     {
         m_rendererSceneUpdater.setSceneReferenceLogicHandler(m_sceneReferenceLogic);
+        m_rendererSceneUpdater.setTransformationUpdateThreadCount(transformationUpdateThreadCount);
     }
 
     void DisplayBundle::doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime)
@@ -90,9 +91,15 @@ namespace ramses_internal
         {
             if (m_renderer.hasDisplayController(handle))
             {
-                auto& device = m_renderer.getDisplayController(handle).getRenderBackend().getDevice();
+                auto& displayController = m_renderer.getDisplayController(handle);
+                auto& device = displayController.getRenderBackend().getDevice();
                 drawCallCount += device.getAndResetDrawCallCount();
                 usedGPUMemory += device.getTotalGpuMemoryUsageInKB();
+
+                UInt32 numUniformsUploaded = 0u;
+                UInt32 numUniformsSkipped = 0u;
+                displayController.getAndResetUniformUploadCounts(numUniformsUploaded, numUniformsSkipped);
+                m_renderer.getStatistics().uniformsUploaded(numUniformsUploaded, numUniformsSkipped);
             }
         }
 
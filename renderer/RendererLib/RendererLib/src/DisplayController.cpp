@@ -58,7 +58,7 @@ namespace ramses_internal
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
     {
         const TargetBufferInfo bufferInfo{ buffer, viewport.width, viewport.height };
-        RenderExecutor executor(m_renderBackend.getDevice(), bufferInfo, renderFrom, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), bufferInfo, renderFrom, frameTimer, &m_uniformUploadCache);
 
         return executor.executeScene(scene);
     }
@@ -131,4 +131,14 @@ namespace ramses_internal
     {
         m_renderBackend.getDevice().validateDeviceStatusHealthy();
     }
+
+    void DisplayController::getAndResetUniformUploadCounts(UInt32& numUploaded, UInt32& numSkipped)
+    {
+        m_uniformUploadCache.getAndResetUniformCounts(numUploaded, numSkipped);
+    }
+
+    UniformUploadCache* DisplayController::getUniformUploadCache()
+    {
+        return &m_uniformUploadCache;
+    }
 }
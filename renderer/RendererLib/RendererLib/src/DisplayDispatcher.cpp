@@ -17,11 +17,25 @@ namespace ramses_internal
     DisplayDispatcher::DisplayDispatcher(
         const RendererConfig& config,
         RendererCommandBuffer& commandBuffer,
-        IRendererSceneEventSender& rendererSceneSender)
+        IRendererSceneEventSender& rendererSceneSender,
+        IRendererResourceCache* rendererResourceCache)
         : m_rendererConfig{ config }
         , m_pendingCommandsToDispatch{ commandBuffer }
         , m_rendererSceneSender{ rendererSceneSender }
+        , m_rendererResourceCache{ rendererResourceCache }
+        , m_useDisplayThreads{ config.getDisplayThreadsEnabled() }
     {
+        if (m_useDisplayThreads)
+            LOG_INFO(CONTEXT_RENDERER, "DisplayDispatcher: each display will be updated and rendered in its own thread");
+    }
+
+    DisplayDispatcher::~DisplayDispatcher()
+    {
+        for (auto& display : m_displays)
+        {
+            if (display.second.m_displayThread)
+                display.second.m_displayThread->destroyDisplayBundle(display.second.m_displayBundle);
+        }
     }
 
     void DisplayDispatcher::doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime)
@@ -50,10 +64,67 @@ namespace ramses_internal
             auto& pendingCmds = display.second.m_pendingCommands;
             if (!pendingCmds.empty())
                 displayBundle.pushAndConsumeCommands(pendingCmds);
-            displayBundle.doOneLoop(loopMode, sleepTime);
+            // with display threads the commands are consumed by display's own loop
+            if (!m_useDisplayThreads)
+                displayBundle.doOneLoop(loopMode, sleepTime);
+        }
+    }
+
+    bool DisplayDispatcher::isUsingDisplayThreads() const
+    {
+        return m_useDisplayThreads;
+    }
+
+    void DisplayDispatcher::startDisplayThreadsUpdating()
+    {
+        assert(m_useDisplayThreads);
+        std::lock_guard<std::mutex> l{ m_displayCreationLock };
+        m_displayThreadsUpdating = true;
+        for (auto& display : m_displays)
+            display.second.m_displayThread->startUpdating();
+    }
+
+    void DisplayDispatcher::stopDisplayThreadsUpdating()
+    {
+        assert(m_useDisplayThreads);
+        std::lock_guard<std::mutex> l{ m_displayCreationLock };
+        m_displayThreadsUpdating = false;
+        for (auto& display : m_displays)
+            display.second.m_displayThread->stopUpdating();
+    }
+
+    void DisplayDispatcher::setLoopMode(ELoopMode loopMode)
+    {
+        std::lock_guard<std::mutex> l{ m_displayCreationLock };
+        m_displayThreadsLoopMode = loopMode;
+        for (auto& display : m_displays)
+        {
+            if (display.second.m_displayThread)
+                display.second.m_displayThread->setLoopMode(loopMode);
+        }
+    }
+
+    void DisplayDispatcher::setMinFrameDuration(std::chrono::microseconds minFrameDuration)
+    {
+        std::lock_guard<std::mutex> l{ m_displayCreationLock };
+        m_displayThreadsMinFrameDuration = minFrameDuration;
+        m_minFrameDurationsPerDisplay.clear();
+        for (auto& display : m_displays)
+        {
+            if (display.second.m_displayThread)
+                display.second.m_displayThread->setMinFrameDuration(minFrameDuration);
         }
     }
 
+    void DisplayDispatcher::setMinFrameDuration(std::chrono::microseconds minFrameDuration, DisplayHandle display)
+    {
+        std::lock_guard<std::mutex> l{ m_displayCreationLock };
+        m_minFrameDurationsPerDisplay[display] = minFrameDuration;
+        const auto it = m_displays.find(display);
+        if (it != m_displays.end() && it->second.m_displayThread)
+            it->second.m_displayThread->setMinFrameDuration(minFrameDuration);
+    }
+
     void DisplayDispatcher::preprocessCommand(const RendererCommand::Variant& cmd)
     {
         if (absl::holds_alternative<RendererCommand::CreateDisplay>(cmd))
@@ -82,6 +153,19 @@ namespace ramses_internal
             LOG_INFO_P(CONTEXT_RENDERER, "DisplayDispatcher: pushing {} stashed commands to newly created display", m_stashedCommandsForNewDisplays[displayHandle].size());
             m_displays[displayHandle].m_displayBundle->pushAndConsumeCommands(m_stashedCommandsForNewDisplays[displayHandle]);
             m_stashedCommandsForNewDisplays.erase(displayHandle);
+
+            if (m_useDisplayThreads)
+            {
+                std::lock_guard<std::mutex> l{ m_displayCreationLock };
+                auto& display = m_displays[displayHandle];
+                display.m_displayThread = std::make_unique<DisplayThread>(*display.m_displayBundle, displayHandle);
+                display.m_displayThread->setLoopMode(m_displayThreadsLoopMode);
+                const auto frameDurationIt = m_minFrameDurationsPerDisplay.find(displayHandle);
+                display.m_displayThread->setMinFrameDuration(frameDurationIt != m_minFrameDurationsPerDisplay.cend() ? frameDurationIt->second : m_displayThreadsMinFrameDuration);
+                if (m_displayThreadsUpdating)
+                    display.m_displayThread->startUpdating();
+                LOG_INFO_P(CONTEXT_RENDERER, "DisplayDispatcher: created display thread for display {}", displayHandle);
+            }
         }
         else if (absl::holds_alternative<RendererCommand::SetSceneMapping>(cmd))
         {
@@ -121,7 +205,7 @@ namespace ramses_internal
     DisplayDispatcher::Display DisplayDispatcher::createDisplayBundle()
     {
         std::unique_ptr<IPlatform> platform{ Platform_Base::CreatePlatform(m_rendererConfig) };
-        auto displayBundle = std::make_unique<DisplayBundle>(m_rendererSceneSender, *platform, m_rendererConfig.getKPIFileName());
+        auto displayBundle = std::make_unique<DisplayBundle>(m_rendererSceneSender, *platform, m_rendererConfig.getKPIFileName(), m_rendererConfig.getTransformationUpdateThreadCount(), m_rendererResourceCache);
         return { std::move(platform), std::move(displayBundle), {} };
     }
 
@@ -196,6 +280,9 @@ namespace ramses_internal
         for (const auto& display : destroyedDisplays)
         {
             std::lock_guard<std::mutex> l{ m_displayCreationLock };
+            auto& displayToDestroy = m_displays[display];
+            if (displayToDestroy.m_displayThread)
+                displayToDestroy.m_displayThread->destroyDisplayBundle(displayToDestroy.m_displayBundle);
             m_displays.erase(display);
         }
 
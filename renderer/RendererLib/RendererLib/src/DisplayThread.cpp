@@ -0,0 +1,142 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/DisplayThread.h"
+#include "RendererLib/DisplayBundle.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    DisplayThread::DisplayThread(IDisplayBundle& displayBundle, DisplayHandle displayHandle)
+        : m_displayBundle(displayBundle)
+        , m_thread(String(fmt::format("R_DispThrd{}", displayHandle.asMemoryHandle())))
+    {
+        m_thread.start(*this);
+    }
+
+    DisplayThread::~DisplayThread()
+    {
+        {
+            // cancel under lock so that the wake up cannot get lost while thread is about to sleep
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_thread.cancel();
+        }
+        m_sleepConditionVar.notify_one();
+        m_thread.join();
+    }
+
+    void DisplayThread::startUpdating()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_doUpdate = true;
+        }
+        m_sleepConditionVar.notify_one();
+    }
+
+    void DisplayThread::stopUpdating()
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_doUpdate = false;
+    }
+
+    bool DisplayThread::isUpdating() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_doUpdate;
+    }
+
+    void DisplayThread::setLoopMode(ELoopMode loopMode)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_loopMode = loopMode;
+    }
+
+    void DisplayThread::setMinFrameDuration(std::chrono::microseconds minFrameDuration)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_minFrameDuration = minFrameDuration;
+    }
+
+    std::chrono::microseconds DisplayThread::getMinFrameDuration() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_minFrameDuration;
+    }
+
+    void DisplayThread::destroyDisplayBundle(std::unique_ptr<IDisplayBundle>& displayBundle)
+    {
+        assert(displayBundle.get() == &m_displayBundle);
+        std::unique_lock<std::mutex> l(m_lock);
+        m_bundleToDestroy = &displayBundle;
+        m_sleepConditionVar.notify_one();
+        m_bundleDestroyedCondVar.wait(l, [&]() { return m_bundleToDestroy == nullptr; });
+    }
+
+    void DisplayThread::run()
+    {
+        UInt64 loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
+        std::chrono::milliseconds lastLoopSleepTime{ 0u };
+
+        while (!isCancelRequested())
+        {
+            bool doUpdate = false;
+            ELoopMode loopMode = ELoopMode::UpdateAndRender;
+            std::chrono::microseconds minFrameDuration{ 0 };
+            {
+                std::unique_lock<std::mutex> l(m_lock);
+                if (m_bundleToDestroy)
+                {
+                    m_bundleToDestroy->reset();
+                    m_bundleToDestroy = nullptr;
+                    m_bundleDestroyedCondVar.notify_one();
+                    // nothing left to update
+                    break;
+                }
+
+                if (!m_doUpdate)
+                {
+                    m_sleepConditionVar.wait(l, [&]() { return m_doUpdate || m_bundleToDestroy != nullptr || isCancelRequested(); });
+                    loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
+                    continue;
+                }
+
+                doUpdate = m_doUpdate;
+                loopMode = m_loopMode;
+                minFrameDuration = m_minFrameDuration;
+            }
+
+            if (doUpdate)
+            {
+                m_displayBundle.doOneLoop(loopMode, lastLoopSleepTime);
+
+                const UInt64 loopEndTime = PlatformTime::GetMicrosecondsMonotonic();
+                assert(loopEndTime >= loopStartTime);
+                lastLoopSleepTime = SleepToControlFramerate(std::chrono::microseconds{ loopEndTime - loopStartTime }, minFrameDuration);
+                loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
+            }
+        }
+    }
+
+    std::chrono::milliseconds DisplayThread::SleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration)
+    {
+        if (minimumFrameDuration > loopDuration)
+        {
+            // millisecond sleep precision, floor so that we do not sleep more than necessary
+            const auto neededSleepDuration = std::chrono::duration_cast<std::chrono::milliseconds>(minimumFrameDuration - loopDuration);
+            if (neededSleepDuration.count() > 0)
+            {
+                PlatformThread::Sleep(static_cast<UInt32>(neededSleepDuration.count()));
+                return neededSleepDuration;
+            }
+        }
+
+        return std::chrono::milliseconds{ 0u };
+    }
+}
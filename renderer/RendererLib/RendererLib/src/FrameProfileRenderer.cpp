@@ -42,9 +42,10 @@ namespace ramses_internal
         precision highp float;                              \n\
                                                             \n\
         flat in int colorId;                                \n\
-        const vec4 colors[16] = vec4[16](                   \n\
+        const vec4 colors[17] = vec4[17](                   \n\
             vec4(0.0, 0.0, 0.0, 1.0),                       \n\
             vec4(0.5, 1.0, 0.0, 0.5),        // RendererCommands                   \n\
+            vec4(0.5, 0.25, 0.0, 0.5),       // DecompressResources                \n\
             vec4(1.0, 0.0, 0.0, 0.5),        // UpdateClientResources              \n\
             vec4(0.0, 0.0, 1.0, 0.5),        // ApplySceneActions                  \n\
             vec4(1.0, 0.0, 1.0, 0.5),        // UpdateSceneResources               \n\
@@ -194,6 +194,11 @@ namespace ramses_internal
         m_logContext << "upload vertex buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::updateVertexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte*, UInt32 dataSize)
+    {
+        m_logContext << "update vertex buffer data [device handle: " << handle << " offset: " << offsetInBytes << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete vertex buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -231,6 +236,11 @@ namespace ramses_internal
         m_logContext << "upload index buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::updateIndexBufferData(DeviceResourceHandle handle, UInt32 offsetInBytes, const Byte*, UInt32 dataSize)
+    {
+        m_logContext << "update index buffer data [device handle: " << handle << " offset: " << offsetInBytes << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete index buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
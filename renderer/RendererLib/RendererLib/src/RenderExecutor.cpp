@@ -8,15 +8,41 @@
 
 #include "RenderExecutor.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/UniformUploadCache.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
 
 namespace ramses_internal
 {
+    // semantic value is set only if changed, so that generation of uniform data stays same if semantic values did not change
+    static void SetSemanticValue(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const Matrix44f& value)
+    {
+        if (scene.getDataSingleMatrix44f(dataInstHandle, dataFieldHandle) != value)
+            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, value);
+    }
+
+    static void SetSemanticValue(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const Matrix33f& value)
+    {
+        if (scene.getDataSingleMatrix33f(dataInstHandle, dataFieldHandle) != value)
+            scene.setDataSingleMatrix33f(dataInstHandle, dataFieldHandle, value);
+    }
+
+    static void SetSemanticValue(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const Vector3& value)
+    {
+        if (scene.getDataSingleVector3f(dataInstHandle, dataFieldHandle) != value)
+            scene.setDataSingleVector3f(dataInstHandle, dataFieldHandle, value);
+    }
+
+    static void SetSemanticValue(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const Vector2& value)
+    {
+        if (scene.getDataSingleVector2f(dataInstHandle, dataFieldHandle) != value)
+            scene.setDataSingleVector2f(dataInstHandle, dataFieldHandle, value);
+    }
+
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
-        : m_state(device, bufferInfo, renderFrom, frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, UniformUploadCache* uniformUploadCache)
+        : m_state(device, bufferInfo, renderFrom, frameTimer, uniformUploadCache)
     {
     }
 
@@ -85,11 +111,16 @@ namespace ramses_internal
             }
         }
 
+        const Bool frustumCulling = renderPass.isFrustumCullingEnabled;
+        const Matrix44f viewProjectionMatrix = (frustumCulling ? m_state.getProjectionMatrix() * m_state.getViewMatrix() : Matrix44f::Identity);
+
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
-            if (!scene.renderableResourcesDirty(renderableHandle))
+            const Bool culled = frustumCulling
+                && scene.getRenderableBoundingBox(renderableHandle).isOutsideFrustum(viewProjectionMatrix * scene.getRenderableWorldMatrix(renderableHandle));
+            if (!culled && !scene.renderableResourcesDirty(renderableHandle))
             {
                 setRenderableInternalStates(renderableHandle);
                 setSemanticDataFields();
@@ -198,24 +229,49 @@ namespace ramses_internal
             device.activateVertexBuffer(attribCache.deviceHandle, attributeField, resourceField.instancingDivisor, renderable.startVertex, attribCache.dataType, resourceField.offsetWithinElementInBytes, resourceField.stride);
         }
 
+        // uniform values are kept in shader, they do not need to be uploaded again if shader got same values last time,
+        // textures are bound to shared texture units and must be always activated
+        UniformUploadCache* uniformUploadCache = m_state.getUniformUploadCache();
+        const DeviceResourceHandle shader = m_state.shaderDeviceHandle.getState();
+        const UInt64 uniformDataGeneration = (uniformUploadCache ? renderScene.getUniformDataGeneration(uniformData) : 0u);
+        const Bool uniformValuesUploaded = (uniformUploadCache && uniformUploadCache->isUploaded(shader, uniformData, uniformDataGeneration));
+        UInt32 numUniformsUploaded = 0u;
+        UInt32 numUniformsSkipped = 0u;
+
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
         const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
         const UInt32 uniformsCount = dataLayout.getFieldCount();
         for (DataFieldHandle constantField(0u); constantField < uniformsCount; ++constantField)
         {
             const DataFieldInfo& field = dataLayout.getField(constantField);
-            if (field.dataType == EDataType::DataReference)
+            if (IsTextureSamplerType(field.dataType))
+            {
+                executeConstant(field.dataType, field.elementCount, uniformData, constantField, constantField);
+            }
+            else if (uniformValuesUploaded)
+            {
+                ++numUniformsSkipped;
+            }
+            else if (field.dataType == EDataType::DataReference)
             {
                 DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
                 const DataLayoutHandle dataRefLayout = renderScene.getLayoutOfDataInstance(dataRef);
                 const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
                 executeConstant(dataTypeRef, 1u, dataRef, DataFieldHandle(0u), constantField);
+                ++numUniformsUploaded;
             }
             else
             {
                 executeConstant(field.dataType, field.elementCount, uniformData, constantField, constantField);
+                ++numUniformsUploaded;
             }
         }
+
+        if (uniformUploadCache)
+        {
+            uniformUploadCache->setUploaded(shader, uniformData, uniformDataGeneration);
+            uniformUploadCache->countUniforms(numUniformsUploaded, numUniformsSkipped);
+        }
     }
 
     void RenderExecutor::executeConstant(EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
@@ -450,55 +506,55 @@ namespace ramses_internal
         case EFixedSemantics::ViewMatrix:
         {
             const Matrix44f& mat = m_state.getViewMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::ProjectionMatrix:
         {
             const Matrix44f& mat = m_state.getProjectionMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::ModelMatrix:
         {
             const Matrix44f& mat = m_state.getModelMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::ModelViewMatrix:
         {
             const Matrix44f& mat = m_state.getModelViewMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::ModelViewMatrix33:
         {
             const Matrix33f mat = Matrix33f(m_state.getModelViewMatrix());
-            scene.setDataSingleMatrix33f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::ModelViewProjectionMatrix:
         {
             const Matrix44f& mat = m_state.getModelViewProjectionMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::CameraWorldPosition:
         {
             const Vector3& pos = m_state.getCameraWorldPosition();
-            scene.setDataSingleVector3f(dataInstHandle, dataFieldHandle, pos);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, pos);
             break;
         }
         case EFixedSemantics::NormalMatrix:
         {
             const Matrix44f& mat = m_state.getModelViewMatrix().inverse().transpose();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, mat);
             break;
         }
         case EFixedSemantics::DisplayBufferResolution:
         {
             const Vector2 bufferRes{ float(m_state.getTargetBufferInfo().width), float(m_state.getTargetBufferInfo().height) };
-            scene.setDataSingleVector2f(dataInstHandle, dataFieldHandle, bufferRes);
+            SetSemanticValue(scene, dataInstHandle, dataFieldHandle, bufferRes);
             break;
         }
         case EFixedSemantics::TextTexture:
@@ -11,7 +11,7 @@
 
 namespace ramses_internal
 {
-    RenderExecutorInternalState::RenderExecutorInternalState(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutorInternalState::RenderExecutorInternalState(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, UniformUploadCache* uniformUploadCache)
         : viewportState(Viewport(std::numeric_limits<Int32>::max(), std::numeric_limits<Int32>::max(), std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max()))
         , m_currentRenderIterator(renderFrom)
         , m_device(device)
@@ -20,6 +20,7 @@ namespace ramses_internal
         , m_projectionMatrix(Matrix44f::Identity)
         , m_cameraWorldPosition(0.0f)
         , m_frameTimer(frameTimer)
+        , m_uniformUploadCache(uniformUploadCache)
     {
         // Currently framebuffer is default render target and invalid RT handle is used to refer to it.
         // For that reason the cached state here needs to be set to another 'invalid' so it can properly
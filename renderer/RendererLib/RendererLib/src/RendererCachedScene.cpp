@@ -9,12 +9,19 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/RenderableComparator.h"
 #include "RenderingPassOrderComparator.h"
+#include "RendererLib/IResourceDeviceHandleAccessor.h"
+#include "SceneAPI/GeometryDataBuffer.h"
+#include "SceneAPI/TextureBuffer.h"
+#include "Scene/DataLayout.h"
+#include "Collections/Vector.h"
 #include <algorithm>
+#include <atomic>
 
 namespace ramses_internal
 {
     RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : TextureLinkCachedScene(sceneLinksManager, sceneInfo)
+        , m_renderingPassesDirty(true)
         , m_renderableOrderingDirty(true)
     {
     }
@@ -22,44 +29,300 @@ namespace ramses_internal
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
         TextureLinkCachedScene::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+        // visibility does not change order, only which renderables are taken from the group
+        markRenderGroupsOfRenderableDirty(renderableHandle, false);
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        TextureLinkCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        // geometry data instance (and its effect) is used to order renderables with same order within group
+        if (slot == ERenderableDataSlotType_Geometry)
+        {
+            markRenderGroupsOfRenderableDirty(renderableHandle, true);
+            if (renderableHandle.asMemoryHandle() < m_renderableBoundingBoxes.size())
+                m_renderableBoundingBoxes[renderableHandle.asMemoryHandle()] = {};
+        }
+    }
+
+    void RendererCachedScene::setRenderableInstanceCount(RenderableHandle renderableHandle, UInt32 instanceCount)
+    {
+        TextureLinkCachedScene::setRenderableInstanceCount(renderableHandle, instanceCount);
+        // instanced renderables are never culled
+        if (renderableHandle.asMemoryHandle() < m_renderableBoundingBoxes.size())
+            m_renderableBoundingBoxes[renderableHandle.asMemoryHandle()] = {};
+    }
+
+    // stamps are unique across all scenes (which might be updated from different threads),
+    // so that they can identify state of scene data also outside of scene
+    static UInt64 NextChangeStamp()
+    {
+        static std::atomic<UInt64> changeCounter{ 0u };
+        return ++changeCounter;
+    }
+
+    template <typename T>
+    static void SetChangeStamp(std::vector<UInt64>& changeStamps, T handle)
+    {
+        if (handle.asMemoryHandle() >= changeStamps.size())
+            changeStamps.resize(handle.asMemoryHandle() + 1u, 0u);
+        changeStamps[handle.asMemoryHandle()] = NextChangeStamp();
+    }
+
+    void RendererCachedScene::stampDataInstance(DataInstanceHandle dataInstance)
+    {
+        SetChangeStamp(m_dataInstanceChangeStamps, dataInstance);
+    }
+
+    void RendererCachedScene::setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor, UInt16 offsetWithinElementInBytes, UInt16 stride)
+    {
+        TextureLinkCachedScene::setDataResource(dataInstanceHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
+        stampDataInstance(dataInstanceHandle);
+    }
+
+    DataInstanceHandle RendererCachedScene::allocateDataInstance(DataLayoutHandle handle, DataInstanceHandle instanceHandle)
+    {
+        const DataInstanceHandle dataInstance = TextureLinkCachedScene::allocateDataInstance(handle, instanceHandle);
+        stampDataInstance(dataInstance);
+        return dataInstance;
+    }
+
+    void RendererCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data)
+    {
+        TextureLinkCachedScene::setDataFloatArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data)
+    {
+        TextureLinkCachedScene::setDataVector2fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data)
+    {
+        TextureLinkCachedScene::setDataVector3fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data)
+    {
+        TextureLinkCachedScene::setDataVector4fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data)
+    {
+        TextureLinkCachedScene::setDataIntegerArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data)
+    {
+        TextureLinkCachedScene::setDataVector2iArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data)
+    {
+        TextureLinkCachedScene::setDataVector3iArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data)
+    {
+        TextureLinkCachedScene::setDataVector4iArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix22fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix33fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data)
+    {
+        TextureLinkCachedScene::setDataMatrix44fArray(containerHandle, field, elementCount, data);
+        stampDataInstance(containerHandle);
+    }
+
+    void RendererCachedScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
+    {
+        TextureLinkCachedScene::setDataReference(containerHandle, field, dataRef);
+        stampDataInstance(containerHandle);
+    }
+
+    DataBufferHandle RendererCachedScene::allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, UInt32 maximumSizeInBytes, DataBufferHandle handle)
+    {
+        const DataBufferHandle dataBuffer = TextureLinkCachedScene::allocateDataBuffer(dataBufferType, dataType, maximumSizeInBytes, handle);
+        SetChangeStamp(m_dataBufferChangeStamps, dataBuffer);
+        if (dataBuffer.asMemoryHandle() >= m_dataBufferDirtyRanges.size())
+            m_dataBufferDirtyRanges.resize(dataBuffer.asMemoryHandle() + 1u);
+        m_dataBufferDirtyRanges[dataBuffer.asMemoryHandle()] = { 0u, maximumSizeInBytes };
+        return dataBuffer;
+    }
+
+    void RendererCachedScene::updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data)
+    {
+        TextureLinkCachedScene::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+        SetChangeStamp(m_dataBufferChangeStamps, handle);
+
+        assert(handle.asMemoryHandle() < m_dataBufferDirtyRanges.size());
+        auto& dirtyRange = m_dataBufferDirtyRanges[handle.asMemoryHandle()];
+        if (dirtyRange.begin == dirtyRange.end)
+            dirtyRange = { offsetInBytes, offsetInBytes + dataSizeInBytes };
+        else
+            dirtyRange = { std::min(dirtyRange.begin, offsetInBytes), std::max(dirtyRange.end, offsetInBytes + dataSizeInBytes) };
+    }
+
+    TextureBufferHandle RendererCachedScene::allocateTextureBuffer(ETextureFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle)
+    {
+        const TextureBufferHandle textureBuffer = TextureLinkCachedScene::allocateTextureBuffer(textureFormat, mipMapDimensions, handle);
+        if (textureBuffer.asMemoryHandle() >= m_textureBufferDirtyRegions.size())
+            m_textureBufferDirtyRegions.resize(textureBuffer.asMemoryHandle() + 1u);
+        auto& dirtyRegions = m_textureBufferDirtyRegions[textureBuffer.asMemoryHandle()];
+        dirtyRegions.clear();
+        for (const auto& mipSize : mipMapDimensions)
+            dirtyRegions.push_back({ 0, 0, Int32(mipSize.width), Int32(mipSize.height) });
+        return textureBuffer;
+    }
+
+    void RendererCachedScene::updateTextureBuffer(TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data)
+    {
+        TextureLinkCachedScene::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
+
+        assert(handle.asMemoryHandle() < m_textureBufferDirtyRegions.size());
+        auto& dirtyRegion = m_textureBufferDirtyRegions[handle.asMemoryHandle()][mipLevel];
+        dirtyRegion = dirtyRegion.getBoundingQuad({ Int32(x), Int32(y), Int32(width), Int32(height) });
+    }
+
+    const RendererCachedScene::DirtyByteRange& RendererCachedScene::getDataBufferDirtyRange(DataBufferHandle handle) const
+    {
+        assert(isDataBufferAllocated(handle));
+        return m_dataBufferDirtyRanges[handle.asMemoryHandle()];
+    }
+
+    const Quad& RendererCachedScene::getTextureBufferDirtyRegion(TextureBufferHandle handle, UInt32 mipLevel) const
+    {
+        assert(isTextureBufferAllocated(handle));
+        return m_textureBufferDirtyRegions[handle.asMemoryHandle()][mipLevel];
+    }
+
+    void RendererCachedScene::markDataBufferUploaded(DataBufferHandle handle) const
+    {
+        assert(isDataBufferAllocated(handle));
+        m_dataBufferDirtyRanges[handle.asMemoryHandle()] = {};
+    }
+
+    void RendererCachedScene::markTextureBufferUploaded(TextureBufferHandle handle) const
+    {
+        assert(isTextureBufferAllocated(handle));
+        for (auto& dirtyRegion : m_textureBufferDirtyRegions[handle.asMemoryHandle()])
+            dirtyRegion = {};
+    }
+
+    void RendererCachedScene::resetResourceCache()
+    {
+        TextureLinkCachedScene::resetResourceCache();
+        // shaders get re-uploaded and lose their uniform values,
+        // all data is re-stamped so that nothing can be identified as already uploaded
+        for (auto& changeStamp : m_dataInstanceChangeStamps)
+        {
+            if (changeStamp != 0u)
+                changeStamp = NextChangeStamp();
+        }
+
+        // data and texture buffers are uploaded to newly created device buffers, their whole content needs upload
+        for (DataBufferHandle handle(0u); handle < getDataBufferCount(); ++handle)
+        {
+            if (isDataBufferAllocated(handle))
+                m_dataBufferDirtyRanges[handle.asMemoryHandle()] = { 0u, static_cast<UInt32>(getDataBuffer(handle).data.size()) };
+        }
+        for (TextureBufferHandle handle(0u); handle < getTextureBufferCount(); ++handle)
+        {
+            if (isTextureBufferAllocated(handle))
+            {
+                const auto& mipMaps = getTextureBuffer(handle).mipMaps;
+                auto& dirtyRegions = m_textureBufferDirtyRegions[handle.asMemoryHandle()];
+                for (size_t mipLevel = 0u; mipLevel < mipMaps.size(); ++mipLevel)
+                    dirtyRegions[mipLevel] = { 0, 0, Int32(mipMaps[mipLevel].width), Int32(mipMaps[mipLevel].height) };
+            }
+        }
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        for (const auto& nestedGroup : TextureLinkCachedScene::getRenderGroup(groupHandle).renderGroups)
+            removeRenderGroupParent(nestedGroup.renderGroup, groupHandle);
+        if (groupHandle.asMemoryHandle() < m_renderGroupParentGroups.size())
+            m_renderGroupParentGroups[groupHandle.asMemoryHandle()].clear();
+
         TextureLinkCachedScene::releaseRenderGroup(groupHandle);
-        m_renderableOrderingDirty = true;
+        // rare operation, no need to track all groups/passes referencing released group
+        markAllRenderGroupsAndPassesDirty();
     }
 
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+        if (renderableHandle.asMemoryHandle() >= m_renderableRenderGroups.size())
+            m_renderableRenderGroups.resize(renderableHandle.asMemoryHandle() + 1u);
+        auto& renderableGroups = m_renderableRenderGroups[renderableHandle.asMemoryHandle()];
+        if (!contains_c(renderableGroups, groupHandle))
+            renderableGroups.push_back(groupHandle);
+        markRenderGroupDirty(groupHandle, true);
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
         TextureLinkCachedScene::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+        if (renderableHandle.asMemoryHandle() < m_renderableRenderGroups.size())
+        {
+            auto& renderableGroups = m_renderableRenderGroups[renderableHandle.asMemoryHandle()];
+            renderableGroups.erase(std::remove(renderableGroups.begin(), renderableGroups.end(), groupHandle), renderableGroups.end());
+        }
+        // removal keeps the remaining renderables sorted
+        markRenderGroupDirty(groupHandle, false);
+    }
+
+    RenderPassHandle RendererCachedScene::allocateRenderPass(UInt32 renderGroupCount, RenderPassHandle passHandle)
+    {
+        const RenderPassHandle renderPass = TextureLinkCachedScene::allocateRenderPass(renderGroupCount, passHandle);
+        m_renderingPassesDirty = true;
+
+        return renderPass;
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
         m_renderOncePassesToRender.remove(passHandle);
         TextureLinkCachedScene::releaseRenderPass(passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassCamera(RenderPassHandle passHandle, CameraHandle cameraHandle)
+    {
+        TextureLinkCachedScene::setRenderPassCamera(passHandle, cameraHandle);
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOrder(RenderPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setRenderPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     BlitPassHandle RendererCachedScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle /*= BlitPassHandle::Invalid()*/)
     {
         const BlitPassHandle blitPass = TextureLinkCachedScene::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
 
         return blitPass;
     }
@@ -67,19 +330,19 @@ namespace ramses_internal
     void RendererCachedScene::releaseBlitPass(BlitPassHandle passHandle)
     {
         TextureLinkCachedScene::releaseBlitPass(passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassRenderOrder(BlitPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setBlitPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassEnabled(BlitPassHandle passHandle, Bool isEnabled)
     {
         TextureLinkCachedScene::setBlitPassEnabled(passHandle, isEnabled);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, Bool isEnabled)
@@ -93,7 +356,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOnce(RenderPassHandle passHandle, Bool enable)
@@ -107,7 +370,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::retriggerRenderPassRenderOnce(RenderPassHandle passHandle)
@@ -116,32 +379,47 @@ namespace ramses_internal
         if (TextureLinkCachedScene::getRenderPass(passHandle).isEnabled)
         {
             m_renderOncePassesToRender.put(passHandle);
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
-        m_renderableOrderingDirty = true;
+        markPassDirty(passHandle);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderPass(passHandle, groupHandle);
-        m_renderableOrderingDirty = true;
+        markPassDirty(passHandle);
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+        if (groupHandleChild.asMemoryHandle() >= m_renderGroupParentGroups.size())
+            m_renderGroupParentGroups.resize(groupHandleChild.asMemoryHandle() + 1u);
+        auto& parentGroups = m_renderGroupParentGroups[groupHandleChild.asMemoryHandle()];
+        if (!contains_c(parentGroups, groupHandleParent))
+            parentGroups.push_back(groupHandleParent);
+        markRenderGroupDirty(groupHandleParent, true);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
-        m_renderableOrderingDirty = true;
+        removeRenderGroupParent(groupHandleChild, groupHandleParent);
+        markRenderGroupDirty(groupHandleParent, false);
+    }
+
+    void RendererCachedScene::removeRenderGroupParent(RenderGroupHandle groupHandle, RenderGroupHandle parentGroupHandle)
+    {
+        if (groupHandle.asMemoryHandle() < m_renderGroupParentGroups.size())
+        {
+            auto& parentGroups = m_renderGroupParentGroups[groupHandle.asMemoryHandle()];
+            parentGroups.erase(std::remove(parentGroups.begin(), parentGroups.end(), parentGroupHandle), parentGroups.end());
+        }
     }
 
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
@@ -159,75 +437,227 @@ namespace ramses_internal
     {
         updateRenderableResources(resourceAccessor, embeddedCompositingManager);
         updatePassRenderableSorting();
+        updateRenderableBoundingBoxes(resourceAccessor);
     }
 
     void RendererCachedScene::updatePassRenderableSorting()
     {
+        if (m_renderingPassesDirty)
+        {
+            updateSortedRenderingPasses();
+            m_renderingPassesDirty = false;
+        }
+
         if (m_renderableOrderingDirty)
         {
-            m_sortedRenderingPasses.clear();
+            // each group is checked at most once per update, also if shared by multiple groups or passes
+            ++m_renderableOrderUpdateCounter;
+            m_renderGroupOrderCaches.resize(TextureLinkCachedScene::getRenderGroupCount());
+            for (const auto& pass : m_sortedRenderingPasses)
+            {
+                if (ERenderingPassType::RenderPass == pass.getType())
+                    updateRenderablesInPass(pass.getRenderPassHandle());
+            }
+
+            m_renderableOrderingDirty = false;
+        }
+    }
+
+    void RendererCachedScene::updateSortedRenderingPasses()
+    {
+        m_sortedRenderingPasses.clear();
 
-            const UInt32 totalNumberOfRenderPasses = TextureLinkCachedScene::getRenderPassCount();
-            const UInt32 totalNumberOfBlitPasses = TextureLinkCachedScene::getBlitPassCount();
+        const UInt32 totalNumberOfRenderPasses = TextureLinkCachedScene::getRenderPassCount();
+        const UInt32 totalNumberOfBlitPasses = TextureLinkCachedScene::getBlitPassCount();
 
-            //add render passes
-            m_passRenderableOrder.resize(totalNumberOfRenderPasses);
-            for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
+        //add render passes
+        m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+        for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
+        {
+            if (shouldRenderPassBeRendered(passHandle))
             {
+                m_sortedRenderingPasses.emplace_back(passHandle);
+            }
+            else
+            {
+                // keep renderables only for passes to be rendered, pass has to be rebuilt when rendered again
+                // because changes of its groups are not tracked meanwhile
                 m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
-                if (shouldRenderPassBeRendered(passHandle))
-                    m_sortedRenderingPasses.emplace_back(passHandle);
+                markPassDirty(passHandle);
             }
+        }
 
-            //add blit passes
-            for (BlitPassHandle passHandle(0); passHandle < totalNumberOfBlitPasses; ++passHandle)
+        //add blit passes
+        for (BlitPassHandle passHandle(0); passHandle < totalNumberOfBlitPasses; ++passHandle)
+        {
+            if (TextureLinkCachedScene::isBlitPassAllocated(passHandle))
             {
-                if (TextureLinkCachedScene::isBlitPassAllocated(passHandle))
+                const BlitPass& blitPass = TextureLinkCachedScene::getBlitPass(passHandle);
+                if (blitPass.isEnabled)
                 {
-                    const BlitPass& blitPass = TextureLinkCachedScene::getBlitPass(passHandle);
-                    if (blitPass.isEnabled)
-                    {
-                        assert(blitPass.sourceRenderBuffer.isValid());
-                        assert(blitPass.destinationRenderBuffer.isValid());
-                        m_sortedRenderingPasses.emplace_back(passHandle);
-                    }
+                    assert(blitPass.sourceRenderBuffer.isValid());
+                    assert(blitPass.destinationRenderBuffer.isValid());
+                    m_sortedRenderingPasses.emplace_back(passHandle);
                 }
             }
+        }
 
-            //sort
-            RenderingPassOrderComparator comparator(*this);
-            std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
+        //sort
+        RenderingPassOrderComparator comparator(*this);
+        std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
 
-            //update renderables according to sorted render passes
-            for (const auto& pass : m_sortedRenderingPasses)
+        // newly rendered passes might not have their renderables cached yet
+        m_renderableOrderingDirty = true;
+    }
+
+    const Matrix44f& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
+    {
+        assert(renderable.asMemoryHandle() < m_renderableMatrices.size());
+        return m_renderableMatrices[renderable.asMemoryHandle()];
+    }
+
+    const BoundingBox& RendererCachedScene::getRenderableBoundingBox(RenderableHandle renderable) const
+    {
+        static const BoundingBox UnknownBoundingBox = BoundingBox::Infinite();
+        if (renderable.asMemoryHandle() >= m_renderableBoundingBoxes.size())
+            return UnknownBoundingBox;
+        return m_renderableBoundingBoxes[renderable.asMemoryHandle()].box;
+    }
+
+    void RendererCachedScene::updateRenderableBoundingBoxes(const IResourceDeviceHandleAccessor& resourceAccessor)
+    {
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType() || !getRenderPass(pass.getRenderPassHandle()).isFrustumCullingEnabled)
+                continue;
+
+            m_renderableBoundingBoxes.resize(TextureLinkCachedScene::getRenderableCount());
+            for (const auto renderable : m_passRenderableOrder[pass.getRenderPassHandle().asMemoryHandle()])
             {
-                if (ERenderingPassType::RenderPass == pass.getType())
-                    updateRenderablesInPass(pass.getRenderPassHandle());
+                BoundingBoxCacheEntry& cacheEntry = m_renderableBoundingBoxes[renderable.asMemoryHandle()];
+                // vertex arrays might not be uploaded yet, renderable is not rendered until they are
+                if (renderableResourcesDirty(renderable))
+                {
+                    cacheEntry = {};
+                    continue;
+                }
+
+                const UInt64 changeStamp = getVertexDataChangeStamp(renderable);
+                if (!cacheEntry.valid || cacheEntry.changeStamp != changeStamp)
+                    cacheEntry = { computeRenderableBoundingBox(renderable, resourceAccessor), changeStamp, true };
             }
+        }
+    }
 
-            m_renderableOrderingDirty = false;
+    UInt64 RendererCachedScene::getVertexDataChangeStamp(RenderableHandle renderable) const
+    {
+        const DataInstanceHandle geometryInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        assert(geometryInstance.isValid());
+        UInt64 changeStamp = (geometryInstance.asMemoryHandle() < m_dataInstanceChangeStamps.size() ? m_dataInstanceChangeStamps[geometryInstance.asMemoryHandle()] : 0u);
+
+        const UInt32 fieldCount = getDataLayout(getLayoutOfDataInstance(geometryInstance)).getFieldCount();
+        for (DataFieldHandle field(0u); field < fieldCount; ++field)
+        {
+            const DataBufferHandle dataBuffer = getDataResource(geometryInstance, field).dataBuffer;
+            if (dataBuffer.isValid() && dataBuffer.asMemoryHandle() < m_dataBufferChangeStamps.size())
+                changeStamp = std::max(changeStamp, m_dataBufferChangeStamps[dataBuffer.asMemoryHandle()]);
         }
+
+        return changeStamp;
     }
 
-    const Matrix44f& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
+    UInt64 RendererCachedScene::getUniformDataGeneration(DataInstanceHandle uniformDataInstance) const
     {
-        assert(renderable.asMemoryHandle() < m_renderableMatrices.size());
-        return m_renderableMatrices[renderable.asMemoryHandle()];
+        assert(uniformDataInstance.asMemoryHandle() < m_dataInstanceChangeStamps.size());
+        UInt64 generation = m_dataInstanceChangeStamps[uniformDataInstance.asMemoryHandle()];
+
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(uniformDataInstance));
+        const UInt32 fieldCount = layout.getFieldCount();
+        for (DataFieldHandle field(0u); field < fieldCount; ++field)
+        {
+            if (layout.getField(field).dataType == EDataType::DataReference)
+            {
+                const DataInstanceHandle dataRef = getDataReference(uniformDataInstance, field);
+                assert(dataRef.asMemoryHandle() < m_dataInstanceChangeStamps.size());
+                generation = std::max(generation, m_dataInstanceChangeStamps[dataRef.asMemoryHandle()]);
+            }
+        }
+
+        return generation;
     }
 
-    void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
+    BoundingBox RendererCachedScene::computeRenderableBoundingBox(RenderableHandle renderable, const IResourceDeviceHandleAccessor& resourceAccessor) const
     {
-        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        const Renderable& renderableData = getRenderable(renderable);
+        if (renderableData.instanceCount > 1u)
+            return BoundingBox::Infinite();
+
+        // Vertex positions are not marked explicitly, box is therefore merged from all vector attributes.
+        // Other attributes (normals, texture coordinates) can only enlarge the box, so culling stays conservative.
+        const DataInstanceHandle geometryInstance = renderableData.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(geometryInstance));
+        BoundingBox box;
+        Bool hasVectorAttribute = false;
+        // first field is indices, vertex attributes follow
+        for (DataFieldHandle field(1u); field < layout.getFieldCount(); ++field)
+        {
+            const EDataType fieldType = layout.getField(field).dataType;
+            if (fieldType != EDataType::Vector2Buffer && fieldType != EDataType::Vector3Buffer && fieldType != EDataType::Vector4Buffer)
+                continue;
 
+            const ResourceField& resourceField = getDataResource(geometryInstance, field);
+            if (resourceField.instancingDivisor > 0u)
+                return BoundingBox::Infinite();
+
+            if (resourceField.dataBuffer.isValid())
+            {
+                const GeometryDataBuffer& dataBuffer = getDataBuffer(resourceField.dataBuffer);
+                box.merge(BoundingBox::FromVertexData(dataBuffer.data.data(), dataBuffer.usedSize, BufferTypeToElementType(fieldType), resourceField.offsetWithinElementInBytes, resourceField.stride));
+            }
+            else if (resourceField.hash.isValid() && resourceField.offsetWithinElementInBytes == 0u && resourceField.stride == 0u)
+            {
+                box.merge(resourceAccessor.getVertexArrayBoundingBox(resourceField.hash));
+            }
+            else
+            {
+                // extent of interleaved vertex arrays is not known
+                return BoundingBox::Infinite();
+            }
+            hasVectorAttribute = true;
+        }
+
+        // positions could be generated in shader
+        if (!hasVectorAttribute)
+            return BoundingBox::Infinite();
+
+        return box;
+    }
+
+    void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
+    {
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
+        OrderCacheState& passState = getPassOrderCacheState(passHandle);
+
+        Bool anyGroupChanged = false;
+        for (const auto& renderGroup : orderedRenderGroups)
+            anyGroupChanged |= updateRenderGroupOrderCache(renderGroup.renderGroup);
 
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        if (!passState.needsRebuild && !anyGroupChanged)
+            return;
 
-        for(const auto& renderGroup : orderedRenderGroups)
+        if (passState.needsSorting)
+            std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+
+        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        orderedRenderables.clear();
+        for (const auto& renderGroup : orderedRenderGroups)
         {
-            addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
+            const auto& groupRenderables = m_renderGroupOrderCaches[renderGroup.renderGroup.asMemoryHandle()].orderedRenderables;
+            orderedRenderables.insert(orderedRenderables.end(), groupRenderables.cbegin(), groupRenderables.cend());
         }
+
+        passState = { false, false };
     }
 
     static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
@@ -238,18 +668,46 @@ namespace ramses_internal
         }
     }
 
-    void RendererCachedScene::addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle)
+    Bool RendererCachedScene::updateRenderGroupOrderCache(RenderGroupHandle renderGroupHandle)
     {
         assert(isRenderGroupAllocated(renderGroupHandle));
 
+        assert(renderGroupHandle.asMemoryHandle() < m_renderGroupOrderCaches.size());
+        RenderGroupOrderCache& cache = m_renderGroupOrderCaches[renderGroupHandle.asMemoryHandle()];
+        if (cache.lastCheckedUpdate == m_renderableOrderUpdateCounter)
+            return cache.changedInLastCheckedUpdate;
+        cache.lastCheckedUpdate = m_renderableOrderUpdateCounter;
+
         RenderGroup& renderGroup = getRenderGroupInternal(renderGroupHandle);
         // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
         RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
 
-        RenderableComparator renderableComp(*this);
-        std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        Bool anyNestedGroupChanged = false;
+        for (const auto& nestedGroup : orderedRenderGroups)
+            anyNestedGroupChanged |= updateRenderGroupOrderCache(nestedGroup.renderGroup);
+
+        if (!cache.state.needsRebuild && !anyNestedGroupChanged)
+        {
+            cache.changedInLastCheckedUpdate = false;
+            return false;
+        }
+
+        if (cache.state.needsSorting)
+        {
+            RenderableComparator renderableComp(*this);
+            std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
+            std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        }
+
+        RenderableVector& orderedRenderables = cache.orderedRenderables;
+        orderedRenderables.clear();
+
+        const auto addRenderablesFromNestedGroup = [&](RenderGroupHandle nestedGroup)
+        {
+            const auto& nestedRenderables = m_renderGroupOrderCaches[nestedGroup.asMemoryHandle()].orderedRenderables;
+            orderedRenderables.insert(orderedRenderables.end(), nestedRenderables.cbegin(), nestedRenderables.cend());
+        };
 
         RenderableOrderVector::iterator renderablesIterator = orderedGroupRenderables.begin();
         RenderGroupOrderVector::iterator renderGroupIterator = orderedRenderGroups.begin();
@@ -263,7 +721,7 @@ namespace ramses_internal
             }
             else if (renderablesIterator == orderedGroupRenderables.end())
             {
-                addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                addRenderablesFromNestedGroup(renderGroupIterator->renderGroup);
                 ++renderGroupIterator;
             }
             else
@@ -275,16 +733,80 @@ namespace ramses_internal
                 }
                 else
                 {
-                    addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                    addRenderablesFromNestedGroup(renderGroupIterator->renderGroup);
                     ++renderGroupIterator;
                 }
             }
         }
+
+        cache.state = { false, false };
+        cache.changedInLastCheckedUpdate = true;
+        return true;
+    }
+
+    RendererCachedScene::RenderGroupOrderCache& RendererCachedScene::getRenderGroupOrderCache(RenderGroupHandle renderGroupHandle)
+    {
+        if (renderGroupHandle.asMemoryHandle() >= m_renderGroupOrderCaches.size())
+            m_renderGroupOrderCaches.resize(renderGroupHandle.asMemoryHandle() + 1u);
+        return m_renderGroupOrderCaches[renderGroupHandle.asMemoryHandle()];
+    }
+
+    RendererCachedScene::OrderCacheState& RendererCachedScene::getPassOrderCacheState(RenderPassHandle passHandle)
+    {
+        if (passHandle.asMemoryHandle() >= m_passOrderCacheStates.size())
+            m_passOrderCacheStates.resize(passHandle.asMemoryHandle() + 1u);
+        return m_passOrderCacheStates[passHandle.asMemoryHandle()];
+    }
+
+    void RendererCachedScene::markRenderGroupDirty(RenderGroupHandle renderGroupHandle, Bool needsSorting)
+    {
+        auto& state = getRenderGroupOrderCache(renderGroupHandle).state;
+        // parents of a group needing rebuild are already marked, this also stops on (invalid) cyclic nesting
+        const Bool parentsAlreadyMarked = state.needsRebuild;
+        state.needsRebuild = true;
+        state.needsSorting |= needsSorting;
+        m_renderableOrderingDirty = true;
+
+        if (parentsAlreadyMarked || renderGroupHandle.asMemoryHandle() >= m_renderGroupParentGroups.size())
+            return;
+        for (const auto parentGroup : m_renderGroupParentGroups[renderGroupHandle.asMemoryHandle()])
+            markRenderGroupDirty(parentGroup, false);
+    }
+
+    void RendererCachedScene::markRenderGroupsOfRenderableDirty(RenderableHandle renderableHandle, Bool needsSorting)
+    {
+        if (renderableHandle.asMemoryHandle() >= m_renderableRenderGroups.size())
+            return;
+
+        for (const auto groupHandle : m_renderableRenderGroups[renderableHandle.asMemoryHandle()])
+        {
+            // group could have been released without removing its renderables first
+            if (isRenderGroupAllocated(groupHandle))
+                markRenderGroupDirty(groupHandle, needsSorting);
+        }
+    }
+
+    void RendererCachedScene::markPassDirty(RenderPassHandle passHandle)
+    {
+        getPassOrderCacheState(passHandle) = { true, true };
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::markAllRenderGroupsAndPassesDirty()
+    {
+        for (auto& groupCache : m_renderGroupOrderCaches)
+            groupCache.state = { true, true };
+        for (auto& passState : m_passOrderCacheStates)
+            passState = { true, true };
+        m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::updateRenderableWorldMatrices()
     {
         m_renderableMatrices.resize(TextureLinkCachedScene::getRenderableCount());
+
+        // compute all dirty world matrices in one batch, afterwards matrix caches of all renderable nodes are clean
+        m_renderableNodes.clear();
         for (const auto& renderables : m_passRenderableOrder)
         {
             for (const auto renderable : renderables)
@@ -292,9 +814,17 @@ namespace ramses_internal
                 assert(renderable.isValid());
                 const NodeHandle node = getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
+                m_renderableNodes.push_back(node);
             }
         }
+        updateWorldMatrixCaches(m_renderableNodes);
+
+        size_t nodeIdx = 0u;
+        for (const auto& renderables : m_passRenderableOrder)
+        {
+            for (const auto renderable : renderables)
+                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, m_renderableNodes[nodeIdx++]);
+        }
     }
 
     void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
@@ -343,7 +873,7 @@ namespace ramses_internal
             }
         }
 
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::markAllRenderOncePassesAsRendered() const
@@ -353,7 +883,7 @@ namespace ramses_internal
             // some render once passes were rendered, remove them from list
             // and force update of cached render pass list for next update
             m_renderOncePassesToRender.clear();
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 }
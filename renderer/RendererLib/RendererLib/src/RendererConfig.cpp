@@ -103,4 +103,24 @@ namespace ramses_internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfig::enableDisplayThreads(bool enable)
+    {
+        m_displayThreadsEnabled = enable;
+    }
+
+    Bool RendererConfig::getDisplayThreadsEnabled() const
+    {
+        return m_displayThreadsEnabled;
+    }
+
+    void RendererConfig::setTransformationUpdateThreadCount(UInt32 threadCount)
+    {
+        m_transformationUpdateThreadCount = threadCount;
+    }
+
+    UInt32 RendererConfig::getTransformationUpdateThreadCount() const
+    {
+        return m_transformationUpdateThreadCount;
+    }
 }
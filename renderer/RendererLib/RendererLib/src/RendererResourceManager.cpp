@@ -34,10 +34,11 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 gpuCacheSize)
+        UInt64 gpuCacheSize,
+        UniformUploadCache* uniformUploadCache)
         : m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, keepEffects, frameTimer, stats, gpuCacheSize)
+        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, keepEffects, frameTimer, stats, gpuCacheSize, uniformUploadCache)
         , m_stats(stats)
     {
     }
@@ -197,6 +198,11 @@ namespace ramses_internal
         return m_resourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    BoundingBox RendererResourceManager::getVertexArrayBoundingBox(const ResourceContentHash& hash) const
+    {
+        return m_resourceRegistry.getVertexArrayBoundingBox(hash);
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
@@ -537,7 +543,7 @@ namespace ramses_internal
         sceneResources.removeDataBuffer(dataBufferHandle);
     }
 
-    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId)
+    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId)
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
         const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
@@ -545,15 +551,24 @@ namespace ramses_internal
         const DeviceResourceHandle deviceHandle = sceneResources.getDataBufferDeviceHandle(handle);
         assert(deviceHandle.isValid());
         const EDataBufferType dataBufferType = sceneResources.getDataBufferType(handle);
+        assert(offsetInBytes + dataSizeInBytes <= sceneResources.getDataBufferByteSize(handle));
+        // update of whole buffer (re)specifies its data store, partial update modifies data store specified before
+        const bool wholeBuffer = (offsetInBytes == 0u && dataSizeInBytes == sceneResources.getDataBufferByteSize(handle));
 
         IDevice& device = m_renderBackend.getDevice();
         switch (dataBufferType)
         {
         case EDataBufferType::IndexBuffer:
-            device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (wholeBuffer)
+                device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.updateIndexBufferData(deviceHandle, offsetInBytes, data, dataSizeInBytes);
             break;
         case EDataBufferType::VertexBuffer:
-            device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (wholeBuffer)
+                device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.updateVertexBufferData(deviceHandle, offsetInBytes, data, dataSizeInBytes);
             break;
         default:
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::updateDataBuffer: can not updata data buffer with invalid type!");
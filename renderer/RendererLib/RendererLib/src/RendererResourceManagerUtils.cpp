@@ -20,10 +20,13 @@ namespace ramses_internal
     {
         std::vector<Byte> readBuffer(resourceSize);
 
-        cache->getResourceData(resourceId, readBuffer.data(), resourceSize);
+        if (!cache->getResourceData(resourceId, readBuffer.data(), resourceSize))
+            return {};
 
         BinaryInputStream resourceStream(readBuffer.data());
         const IResource* resourceObject = SingleResourceSerialization::DeserializeResource(resourceStream, resourceId);
+        if (!resourceObject)
+            return {};
 
         static ResourceDeleterCallingCallback deleter = ResourceDeleterCallingCallback(DefaultManagedResourceDeleterCallback::GetInstance());
 
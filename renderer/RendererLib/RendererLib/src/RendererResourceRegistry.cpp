@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "RendererLib/RendererResourceRegistry.h"
+#include "Resource/ArrayResource.h"
 #include "Utils/LogMacros.h"
 
 namespace ramses_internal
@@ -121,6 +122,18 @@ namespace ramses_internal
         return *res;
     }
 
+    const BoundingBox& RendererResourceRegistry::getVertexArrayBoundingBox(const ResourceContentHash& hash) const
+    {
+        const ResourceDescriptor& rd = getResourceDescriptor(hash);
+        if (rd.boundingBoxSource)
+        {
+            const ArrayResource* vertArray = rd.boundingBoxSource->convertTo<ArrayResource>();
+            rd.boundingBox = BoundingBox::FromVertexData(vertArray->getResourceData().data(), vertArray->getDecompressedDataSize(), vertArray->getElementType(), 0u, 0u);
+            rd.boundingBoxSource.reset();
+        }
+        return rd.boundingBox;
+    }
+
     void RendererResourceRegistry::setResourceData(const ResourceContentHash& hash, const ManagedResource& resourceObject)
     {
         assert(m_resources.contains(hash));
@@ -149,6 +162,14 @@ namespace ramses_internal
         assert(!rd.deviceHandle.isValid());
         rd.deviceHandle = deviceHandle;
         rd.vramSize = vramSize;
+        if (rd.type == EResourceType_VertexArray && rd.resource)
+        {
+            const ArrayResource* vertArray = rd.resource->convertTo<ArrayResource>();
+            const EDataType elementType = vertArray->getElementType();
+            // keep vertex data until its extent is needed, most vertex arrays are never rendered with culling
+            if (vertArray->getElementCount() > 0u && (elementType == EDataType::Vector2F || elementType == EDataType::Vector3F || elementType == EDataType::Vector4F))
+                rd.boundingBoxSource = rd.resource;
+        }
         // release resource data
         rd.resource.reset();
 
@@ -170,6 +170,12 @@ namespace ramses_internal
         return m_dataBuffers.get(handle)->dataBufferType;
     }
 
+    UInt32 RendererSceneResourceRegistry::getDataBufferByteSize(DataBufferHandle handle) const
+    {
+        assert(m_dataBuffers.contains(handle));
+        return m_dataBuffers.get(handle)->size;
+    }
+
     void RendererSceneResourceRegistry::getAllDataBuffers(DataBufferHandleVector& dataBuffers) const
     {
         assert(dataBuffers.empty());
@@ -31,6 +31,7 @@
 #include "RendererLib/IntersectionUtils.h"
 #include "RendererLib/SceneReferenceLogic.h"
 #include "RendererLib/ResourceUploader.h"
+#include "RendererLib/WorldMatrixUpdateExecutor.h"
 #include "RendererEventCollector.h"
 #include "Components/FlushTimeInformation.h"
 #include "Components/SceneUpdate.h"
@@ -39,6 +40,8 @@
 #include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/Macros.h"
 #include "absl/algorithm/container.h"
+#include <algorithm>
+#include <limits>
 
 namespace ramses_internal
 {
@@ -140,7 +143,7 @@ namespace ramses_internal
         IRenderBackend& renderBackend,
         AsyncEffectUploader& asyncEffectUploader,
         IEmbeddedCompositingManager& embeddedCompositingManager,
-        DisplayHandle,
+        DisplayHandle display,
         bool keepEffectsUploaded,
         uint64_t gpuCacheSize,
         IBinaryShaderCache* binaryShaderCache)
@@ -153,7 +156,8 @@ namespace ramses_internal
             keepEffectsUploaded,
             m_frameTimer,
             m_renderer.getStatistics(),
-            gpuCacheSize);
+            gpuCacheSize,
+            m_renderer.getDisplayController(display).getUniformUploadCache());
     }
 
     void RendererSceneUpdater::destroyDisplayContext(DisplayHandle display)
@@ -216,6 +220,12 @@ namespace ramses_internal
         // Display context is activated on demand, assuming that normally at most one scene/display needs resources uploading
         DisplayHandle activeDisplay;
 
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes finish decompression of resource data to be provided to resource managers");
+            FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::DecompressResources);
+            waitForDecompressionOfResourceDataToProvide();
+        }
+
         {
             LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes request resources from network, upload used resources and unload obsolete resources");
             FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::UpdateClientResources);
@@ -315,6 +325,17 @@ namespace ramses_internal
 
     void RendererSceneUpdater::consolidatePendingSceneActions(SceneId sceneID, SceneUpdate&& sceneUpdate)
     {
+        // client does not send data of resources which were announced as available in renderer resource cache
+        if (sceneUpdate.resources.size() != sceneUpdate.flushInfos.resourceChanges.m_resourcesAdded.size()
+            && !loadResourcesNotSentWithSceneUpdate(sceneUpdate.flushInfos.resourceChanges.m_resourcesAdded, sceneUpdate.resources))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Force unsubscribing scene " << sceneID << " because data of its resources is missing!"
+                << " Scene can be re-subscribed, resources missing in cache will not be announced as available anymore.");
+            // Unsubscribe scene as 'indirect' because it is not triggered by user
+            handleSceneUnsubscriptionRequest(sceneID, true);
+            return;
+        }
+
         StagingInfo& stagingInfo = m_rendererScenes.getStagingInfo(sceneID);
         auto& pendingData = stagingInfo.pendingData;
         auto& pendingFlushes = pendingData.pendingFlushes;
@@ -370,6 +391,9 @@ namespace ramses_internal
         assert(sceneUpdate.resources.size() == resourceChanges.m_resourcesAdded.size());
         assert(std::equal(sceneUpdate.resources.cbegin(), sceneUpdate.resources.cend(), resourceChanges.m_resourcesAdded.cbegin(),
             [](const auto& mr, const auto& hash) { return mr->getHash() == hash; }));
+        // start decompression right away, it is done in worker thread until resource data is needed for upload
+        for (const auto& mr : sceneUpdate.resources)
+            m_resourceDecompressor.decompressAsync(mr);
         flushInfo.resourceDataToProvide = std::move(sceneUpdate.resources);
         flushInfo.resourcesAdded = std::move(resourceChanges.m_resourcesAdded);
         flushInfo.resourcesRemoved = std::move(resourceChanges.m_resourcesRemoved);
@@ -379,6 +403,70 @@ namespace ramses_internal
             logTooManyFlushesAndUnsubscribeIfRemoteScene(sceneID, stagingInfo.pendingData.pendingFlushes.size());
     }
 
+    bool RendererSceneUpdater::loadResourcesNotSentWithSceneUpdate(const ResourceContentHashVector& resourcesAdded, ManagedResourceVector& resources)
+    {
+        // sent resources keep order of added resources, any added resource not sent in between is loaded from cache
+        ManagedResourceVector allResources;
+        allResources.reserve(resourcesAdded.size());
+        auto sentResourceIt = resources.begin();
+        UInt32 numLoadedResources = 0u;
+        for (const auto& hash : resourcesAdded)
+        {
+            if (sentResourceIt != resources.end() && (*sentResourceIt)->getHash() == hash)
+            {
+                allResources.push_back(std::move(*sentResourceIt));
+                ++sentResourceIt;
+                continue;
+            }
+
+            UInt32 resourceSize = 0u;
+            ManagedResource loadedResource;
+            if (m_rendererResourceCache && m_rendererResourceCache->hasResource(hash, resourceSize))
+                loadedResource = RendererResourceManagerUtils::TryLoadResource(hash, resourceSize, m_rendererResourceCache);
+            if (!loadedResource)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::loadResourcesNotSentWithSceneUpdate: resource " << hash << " was not sent and could not be loaded from renderer resource cache");
+                m_resourcesAvailableInCache.remove(hash);
+                return false;
+            }
+            allResources.push_back(std::move(loadedResource));
+            ++numLoadedResources;
+        }
+
+        if (sentResourceIt != resources.end())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::loadResourcesNotSentWithSceneUpdate: sent resources do not match resources added in flush");
+            return false;
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::loadResourcesNotSentWithSceneUpdate: loaded " << numLoadedResources << " resources from renderer resource cache");
+        resources.swap(allResources);
+        return true;
+    }
+
+    ResourceContentHashVector RendererSceneUpdater::getResourcesAvailableInCache()
+    {
+        ResourceContentHashVector availableResources;
+        if (!m_rendererResourceCache)
+            return availableResources;
+
+        // cache might have dropped resources meanwhile
+        availableResources.reserve(m_resourcesAvailableInCache.size());
+        UInt32 resourceSize = 0u;
+        for (auto it = m_resourcesAvailableInCache.begin(); it != m_resourcesAvailableInCache.end();)
+        {
+            if (m_rendererResourceCache->hasResource(*it, resourceSize))
+            {
+                availableResources.push_back(*it);
+                ++it;
+            }
+            else
+                it = m_resourcesAvailableInCache.remove(it);
+        }
+
+        return availableResources;
+    }
+
     void RendererSceneUpdater::consolidateResourceDataForMapping(SceneId sceneID)
     {
         // consolidate resources from pending flushes into staging data for mapping
@@ -444,15 +532,40 @@ namespace ramses_internal
             for (const auto& mr : *resList)
             {
                 resMgr.provideResourceData(mr);
-                uint32_t dummySize = 0;
-                if (m_rendererResourceCache && !m_rendererResourceCache->hasResource(mr->getHash(), dummySize))
-                    RendererResourceManagerUtils::StoreResource(m_rendererResourceCache, mr.get(), sceneID);
+                if (m_rendererResourceCache)
+                {
+                    uint32_t dummySize = 0;
+                    if (!m_rendererResourceCache->hasResource(mr->getHash(), dummySize))
+                        RendererResourceManagerUtils::StoreResource(m_rendererResourceCache, mr.get(), sceneID);
+                    if (m_rendererResourceCache->hasResource(mr->getHash(), dummySize))
+                        m_resourcesAvailableInCache.put(mr->getHash());
+                }
             }
             // data was provided, clear shared_ptr references from list
             resList->clear();
         }
     }
 
+    void RendererSceneUpdater::waitForDecompressionOfResourceDataToProvide()
+    {
+        // resource data is provided to resource manager only for scenes assigned to display, see requestAndUploadAndUnloadResources
+        for (const auto& rendererScene : m_rendererScenes)
+        {
+            const SceneId sceneID = rendererScene.key;
+            if (!m_renderer.getDisplaySceneIsAssignedTo(sceneID).isValid())
+                continue;
+
+            const StagingInfo& stagingInfo = m_rendererScenes.getStagingInfo(sceneID);
+            for (const auto& mr : stagingInfo.resourcesToUploadOnceMapping)
+                m_resourceDecompressor.waitForDecompression(*mr);
+            for (const auto& pendingFlush : stagingInfo.pendingData.pendingFlushes)
+            {
+                for (const auto& mr : pendingFlush.resourceDataToProvide)
+                    m_resourceDecompressor.waitForDecompression(*mr);
+            }
+        }
+    }
+
     void RendererSceneUpdater::requestAndUploadAndUnloadResources(DisplayHandle& activeDisplay)
     {
         for (const auto& rendererScene : m_rendererScenes)
@@ -1018,7 +1131,7 @@ namespace ramses_internal
         if (m_sceneStateExecutor.checkIfCanBeSubscriptionRequested(sceneId))
         {
             assert(!m_rendererScenes.hasScene(sceneId));
-            m_sceneStateExecutor.setSubscriptionRequested(sceneId);
+            m_sceneStateExecutor.setSubscriptionRequested(sceneId, getResourcesAvailableInCache());
         }
     }
 
@@ -1455,6 +1568,14 @@ namespace ramses_internal
         m_maximumPendingFlushesToKillScene = limitForPendingFlushesForceUnsubscribe;
     }
 
+    void RendererSceneUpdater::setTransformationUpdateThreadCount(UInt32 threadCount)
+    {
+        if (threadCount > 0u)
+            m_worldMatrixUpdateExecutor = std::make_unique<WorldMatrixUpdateExecutor>(static_cast<UInt16>(std::min(threadCount, UInt32(std::numeric_limits<UInt16>::max()))));
+        else
+            m_worldMatrixUpdateExecutor.reset();
+    }
+
     void RendererSceneUpdater::logRendererInfo(ERendererLogTopic topic, bool verbose, NodeHandle nodeFilter) const
     {
         RendererLogger::LogTopic(*this, topic, verbose, nodeFilter);
@@ -1532,10 +1653,21 @@ namespace ramses_internal
         }
 
         // update rest of scenes that have no dependencies
-        for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+        if (m_worldMatrixUpdateExecutor)
+        {
+            // scenes are independent of each other and of linked scenes updated above, can be updated in parallel
+            m_independentScenesForTransformationCacheUpdate.clear();
+            for (const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+                m_independentScenesForTransformationCacheUpdate.push_back(&m_rendererScenes.getScene(sceneId));
+            m_worldMatrixUpdateExecutor->updateRenderableWorldMatrices(m_independentScenesForTransformationCacheUpdate);
+        }
+        else
         {
-            RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-            renderScene.updateRenderableWorldMatrices();
+            for (const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+            {
+                RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
+                renderScene.updateRenderableWorldMatrices();
+            }
         }
     }
 
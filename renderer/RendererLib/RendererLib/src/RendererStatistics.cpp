@@ -26,6 +26,16 @@ namespace ramses_internal
         return m_frameNumber <= 0 ? 0u : m_drawCalls / m_frameNumber;
     }
 
+    UInt32 RendererStatistics::getUniformsUploadedPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : static_cast<UInt32>(m_uniformsUploaded / m_frameNumber);
+    }
+
+    UInt32 RendererStatistics::getUniformsSkippedPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : static_cast<UInt32>(m_uniformsSkipped / m_frameNumber);
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
         m_sceneStatistics[sceneId].numRendered++;
@@ -75,6 +85,12 @@ namespace ramses_internal
         strTexStat.maxUpdatesPerFrame = std::max(strTexStat.maxUpdatesPerFrame, numUpdates);
     }
 
+    void RendererStatistics::uniformsUploaded(UInt32 numUploaded, UInt32 numSkipped)
+    {
+        m_uniformsUploaded += numUploaded;
+        m_uniformsSkipped += numSkipped;
+    }
+
     void RendererStatistics::shaderCompiled(std::chrono::microseconds microsecondsUsed, const String& name, SceneId sceneid)
     {
         m_shadersCompiled++;
@@ -178,6 +194,8 @@ namespace ramses_internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls = 0u;
+        m_uniformsUploaded = 0u;
+        m_uniformsSkipped = 0u;
         m_frameDurationMin = std::numeric_limits<UInt32>::max();
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
@@ -240,6 +258,7 @@ namespace ramses_internal
             " [minFrameTime " << m_frameDurationMin << "us" <<
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
+            ", uniformsPerFrame (uploaded/skipped) " << getUniformsUploadedPerFrame() << "/" << getUniformsSkippedPerFrame() <<
             ", numFrames " << m_frameNumber;
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
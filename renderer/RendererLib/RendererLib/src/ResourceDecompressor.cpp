@@ -0,0 +1,94 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ResourceDecompressor.h"
+#include "Resource/IResource.h"
+
+namespace ramses_internal
+{
+    ResourceDecompressor::ResourceDecompressor()
+        : m_thread("R_Decompress")
+    {
+        m_thread.start(*this);
+    }
+
+    ResourceDecompressor::~ResourceDecompressor()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            //call thread cancel inside critical section to avoid missing wake up in run()
+            m_thread.cancel();
+        }
+        m_newResourceCondition.notify_one();
+        m_thread.join();
+    }
+
+    void ResourceDecompressor::decompressAsync(const ManagedResource& resource)
+    {
+        if (!resource->isCompressedAvailable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            // resource data must not be checked while being decompressed by worker
+            if (m_resourceInProgress == resource.get() || m_queuedResources.count(resource.get()) != 0u || resource->isDeCompressedAvailable())
+                return;
+            m_queuedResources.insert(resource.get());
+            m_resourcesToDecompress.push_back(resource);
+        }
+        m_newResourceCondition.notify_one();
+    }
+
+    void ResourceDecompressor::waitForDecompression(const IResource& resource)
+    {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        if (m_queuedResources.erase(&resource) != 0u)
+        {
+            // not picked by worker yet, take it over
+            guard.unlock();
+            resource.decompress();
+            return;
+        }
+
+        m_decompressionFinishedCondition.wait(guard, [&]() { return m_resourceInProgress != &resource; });
+    }
+
+    size_t ResourceDecompressor::getNumberOfQueuedResources() const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        return m_queuedResources.size();
+    }
+
+    void ResourceDecompressor::run()
+    {
+        for (;;)
+        {
+            ManagedResource resource;
+            {
+                std::unique_lock<std::mutex> guard(m_mutex);
+                m_newResourceCondition.wait(guard, [&]() { return !m_resourcesToDecompress.empty() || isCancelRequested(); });
+                if (isCancelRequested())
+                    return;
+
+                resource = std::move(m_resourcesToDecompress.front());
+                m_resourcesToDecompress.pop_front();
+                if (m_queuedResources.erase(resource.get()) == 0u)
+                    continue;
+                m_resourceInProgress = resource.get();
+            }
+
+            resource->decompress();
+
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                m_resourceInProgress = nullptr;
+            }
+            m_decompressionFinishedCondition.notify_all();
+        }
+    }
+}
@@ -11,6 +11,7 @@
 #include "RendererLib/IResourceUploader.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "RendererLib/UniformUploadCache.h"
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IDevice.h"
@@ -29,7 +30,8 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 gpuCacheSize)
+        UInt64 gpuCacheSize,
+        UniformUploadCache* uniformUploadCache)
         : m_resources(resources)
         , m_uploader{ std::move(uploader) }
         , m_renderBackend(renderBackend)
@@ -38,6 +40,7 @@ namespace ramses_internal
         , m_frameTimer(frameTimer)
         , m_resourceCacheSize(gpuCacheSize)
         , m_stats(stats)
+        , m_uniformUploadCache(uniformUploadCache)
     {
         assert(m_uploader);
     }
@@ -114,6 +117,8 @@ namespace ramses_internal
             {
                 const auto& rd = m_resources.getResourceDescriptor(hash);
                 const auto deviceHandle = m_renderBackend.getDevice().registerShader(std::move(e.second));
+                if (m_uniformUploadCache)
+                    m_uniformUploadCache->invalidateShader(deviceHandle);
                 const auto resourceSize = rd.decompressedSize;
                 m_resourceSizes.put(hash, resourceSize);
                 m_resourceTotalUploadedSize += resourceSize;
@@ -182,6 +187,8 @@ namespace ramses_internal
         {
             if (deviceHandle.value().isValid())
             {
+                if (rd.type == EResourceType_Effect && m_uniformUploadCache)
+                    m_uniformUploadCache->invalidateShader(deviceHandle.value());
                 m_resourceSizes.put(rd.hash, resourceSize);
                 m_resourceTotalUploadedSize += resourceSize;
                 m_resources.setResourceUploaded(rd.hash, deviceHandle.value(), vramSize);
@@ -209,6 +216,8 @@ namespace ramses_internal
 
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::unloadResource delete resource of type " << EnumToString(rd.type));
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Unloading resource #" << rd.hash);
+        if (rd.type == EResourceType_Effect && m_uniformUploadCache)
+            m_uniformUploadCache->invalidateShader(rd.deviceHandle);
         m_uploader->unloadResource(m_renderBackend, rd.type, rd.hash, rd.deviceHandle);
 
         auto resSizeIt = m_resourceSizes.find(rd.hash);
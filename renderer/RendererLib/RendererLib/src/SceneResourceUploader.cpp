@@ -8,9 +8,12 @@
 
 #include "RendererLib/SceneResourceUploader.h"
 #include "RendererLib/IRendererResourceManager.h"
+#include "RendererLib/RendererCachedScene.h"
 #include "SceneAPI/RenderBuffer.h"
 #include "SceneAPI/IScene.h"
+#include "SceneAPI/GeometryDataBuffer.h"
 #include "SceneAPI/TextureBuffer.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 #include "SceneAPI/BlitPass.h"
 
 namespace ramses_internal
@@ -52,14 +55,51 @@ namespace ramses_internal
         resourceManager.uploadTextureBuffer(handle, mip0.width, mip0.height, texBuffer.textureFormat, static_cast<UInt32>(mipMaps.size()), scene.getSceneId());
     }
 
-    void SceneResourceUploader::UpdateTextureBuffer(const IScene& scene, TextureBufferHandle handle, IRendererResourceManager& resourceManager)
+    void SceneResourceUploader::UpdateDataBuffer(const RendererCachedScene& scene, DataBufferHandle handle, IRendererResourceManager& resourceManager)
+    {
+        const auto& dirtyRange = scene.getDataBufferDirtyRange(handle);
+        if (dirtyRange.begin == dirtyRange.end)
+            return;
+
+        const GeometryDataBuffer& dataBuffer = scene.getDataBuffer(handle);
+        assert(dirtyRange.end <= dataBuffer.data.size());
+        resourceManager.updateDataBuffer(handle, dirtyRange.begin, dirtyRange.end - dirtyRange.begin, dataBuffer.data.data() + dirtyRange.begin, scene.getSceneId());
+        scene.markDataBufferUploaded(handle);
+    }
+
+    void SceneResourceUploader::UpdateTextureBuffer(const RendererCachedScene& scene, TextureBufferHandle handle, IRendererResourceManager& resourceManager)
     {
         const TextureBuffer& texBuffer = scene.getTextureBuffer(handle);
         const auto& mipMaps = texBuffer.mipMaps;
+        const UInt32 texelSize = GetTexelSizeFromFormat(texBuffer.textureFormat);
+        std::vector<Byte> regionData;
         for (UInt32 mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipMaps.size()); ++mipLevel)
         {
             const auto& mip = mipMaps[mipLevel];
-            resourceManager.updateTextureBuffer(handle, mipLevel, 0u, 0u, mip.width, mip.height, texBuffer.mipMaps[mipLevel].data.data(), scene.getSceneId());
+            const Quad& dirtyRegion = scene.getTextureBufferDirtyRegion(handle, mipLevel);
+            if (dirtyRegion.getArea() == 0)
+                continue;
+
+            const UInt32 x = static_cast<UInt32>(dirtyRegion.x);
+            const UInt32 y = static_cast<UInt32>(dirtyRegion.y);
+            const UInt32 width = static_cast<UInt32>(dirtyRegion.width);
+            const UInt32 height = static_cast<UInt32>(dirtyRegion.height);
+            if (width == mip.width && height == mip.height)
+            {
+                resourceManager.updateTextureBuffer(handle, mipLevel, 0u, 0u, mip.width, mip.height, mip.data.data(), scene.getSceneId());
+                continue;
+            }
+
+            // region data is expected to be tightly packed, copy rows of dirty region from mip data
+            const UInt32 regionRowSize = width * texelSize;
+            const UInt32 mipRowSize = mip.width * texelSize;
+            regionData.resize(regionRowSize * height);
+            const Byte* srcPtr = mip.data.data() + y * mipRowSize + x * texelSize;
+            for (UInt32 row = 0u; row < height; ++row)
+                PlatformMemory::Copy(regionData.data() + row * regionRowSize, srcPtr + row * mipRowSize, regionRowSize);
+
+            resourceManager.updateTextureBuffer(handle, mipLevel, x, y, width, height, regionData.data(), scene.getSceneId());
         }
+        scene.markTextureBufferUploaded(handle);
     }
 }
@@ -32,9 +32,11 @@ namespace ramses_internal
         LOG_INFO(CONTEXT_RENDERER, "Scene "<< sceneId << " is in state PUBLISHED");
     }
 
-    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId)
+    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId, const ResourceContentHashVector& availableResources)
     {
         assert(checkIfCanBeSubscriptionRequested(sceneId));
+        if (!availableResources.empty())
+            m_rendererSceneEventSender.sendResourcesAvailable(sceneId, availableResources);
         m_rendererSceneEventSender.sendSubscribeScene(sceneId);
         m_scenesStateInfo.setSceneState(sceneId, ESceneState::SubscriptionRequested);
         LOG_INFO(CONTEXT_RENDERER, "Scene " << sceneId << " is in state SUBSCRIPTION REQUESTED");
@@ -113,7 +113,7 @@ namespace ramses_internal
         }
         else
         {
-            computeMatrixForNode(matrixType, node, chainMatrix);
+            computeMatrixForNode(matrixType, getMatrixCacheEntry(node), chainMatrix);
         }
     }
 
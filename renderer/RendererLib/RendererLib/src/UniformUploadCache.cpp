@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/UniformUploadCache.h"
+
+namespace ramses_internal
+{
+    Bool UniformUploadCache::isUploaded(DeviceResourceHandle shader, DataInstanceHandle uniformData, UInt64 generation) const
+    {
+        assert(shader.isValid());
+        if (shader.asMemoryHandle() >= m_shaderUniformStates.size())
+            return false;
+
+        const ShaderUniformState& state = m_shaderUniformStates[shader.asMemoryHandle()];
+        return state.uniformData == uniformData && state.generation == generation;
+    }
+
+    void UniformUploadCache::setUploaded(DeviceResourceHandle shader, DataInstanceHandle uniformData, UInt64 generation)
+    {
+        assert(shader.isValid());
+        if (shader.asMemoryHandle() >= m_shaderUniformStates.size())
+            m_shaderUniformStates.resize(shader.asMemoryHandle() + 1u);
+
+        m_shaderUniformStates[shader.asMemoryHandle()] = { uniformData, generation };
+    }
+
+    void UniformUploadCache::invalidateShader(DeviceResourceHandle shader)
+    {
+        assert(shader.isValid());
+        if (shader.asMemoryHandle() < m_shaderUniformStates.size())
+            m_shaderUniformStates[shader.asMemoryHandle()] = {};
+    }
+
+    void UniformUploadCache::countUniforms(UInt32 numUploaded, UInt32 numSkipped)
+    {
+        m_numUploaded += numUploaded;
+        m_numSkipped += numSkipped;
+    }
+
+    void UniformUploadCache::getAndResetUniformCounts(UInt32& numUploaded, UInt32& numSkipped)
+    {
+        numUploaded = m_numUploaded;
+        numSkipped = m_numSkipped;
+        m_numUploaded = 0u;
+        m_numSkipped = 0u;
+    }
+}
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/WorldMatrixUpdateExecutor.h"
+#include "RendererLib/RendererCachedScene.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    WorldMatrixUpdateExecutor::WorldMatrixUpdateExecutor(UInt16 workerCount)
+        : m_threadPool(workerCount)
+    {
+        m_tasks.reserve(workerCount);
+        for (UInt16 i = 0u; i < workerCount; ++i)
+            m_tasks.push_back(new UpdateTask(*this));
+    }
+
+    WorldMatrixUpdateExecutor::~WorldMatrixUpdateExecutor()
+    {
+        // threads must not hold tasks anymore when releasing them
+        m_threadPool.stop();
+        for (auto task : m_tasks)
+            task->release();
+    }
+
+    void WorldMatrixUpdateExecutor::updateRenderableWorldMatrices(const std::vector<RendererCachedScene*>& scenes)
+    {
+        m_scenes = &scenes;
+        m_nextSceneIdx = 0u;
+
+        // calling thread takes part in update as well, so one scene less needs worker
+        const size_t numTasksToStart = std::min(m_tasks.size(), scenes.empty() ? 0u : scenes.size() - 1u);
+        {
+            std::lock_guard<std::mutex> l{ m_finishedLock };
+            m_pendingTasks = numTasksToStart;
+        }
+        for (size_t i = 0u; i < numTasksToStart; ++i)
+            m_threadPool.enqueue(*m_tasks[i]);
+
+        updateScenesFromQueue();
+
+        std::unique_lock<std::mutex> l{ m_finishedLock };
+        m_finishedCondition.wait(l, [this] { return m_pendingTasks == 0u; });
+        m_scenes = nullptr;
+    }
+
+    void WorldMatrixUpdateExecutor::updateScenesFromQueue()
+    {
+        const auto& scenes = *m_scenes;
+        for (size_t sceneIdx = m_nextSceneIdx++; sceneIdx < scenes.size(); sceneIdx = m_nextSceneIdx++)
+            scenes[sceneIdx]->updateRenderableWorldMatrices();
+    }
+
+    WorldMatrixUpdateExecutor::UpdateTask::UpdateTask(WorldMatrixUpdateExecutor& executor)
+        : m_executor(executor)
+    {
+    }
+
+    void WorldMatrixUpdateExecutor::UpdateTask::execute()
+    {
+        m_executor.updateScenesFromQueue();
+
+        std::lock_guard<std::mutex> l{ m_executor.m_finishedLock };
+        --m_executor.m_pendingTasks;
+        m_executor.m_finishedCondition.notify_one();
+    }
+}
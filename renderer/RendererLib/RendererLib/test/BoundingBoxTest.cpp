@@ -0,0 +1,140 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/BoundingBox.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class ABoundingBox : public testing::Test
+    {
+    protected:
+        static BoundingBox CreateBox(const Vector3& min, const Vector3& max)
+        {
+            BoundingBox box;
+            box.min = min;
+            box.max = max;
+            return box;
+        }
+
+        static BoundingBox FromFloats(const std::vector<float>& data, EDataType elementType, UInt32 offset = 0u, UInt32 stride = 0u)
+        {
+            return BoundingBox::FromVertexData(reinterpret_cast<const Byte*>(data.data()), static_cast<UInt32>(data.size() * sizeof(float)), elementType, offset, stride);
+        }
+
+        // camera at origin looking to -z, frustum 90 degrees, near 1, far 100
+        const Matrix44f viewProjection = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Frustum(ECameraProjectionType::Perspective, -1.f, 1.f, -1.f, 1.f, 1.f, 100.f));
+    };
+
+    TEST_F(ABoundingBox, isEmptyByDefault)
+    {
+        const BoundingBox box;
+        EXPECT_TRUE(box.isEmpty());
+        EXPECT_FALSE(box.isInfinite());
+    }
+
+    TEST_F(ABoundingBox, infiniteBoxIsNotEmpty)
+    {
+        const BoundingBox box = BoundingBox::Infinite();
+        EXPECT_FALSE(box.isEmpty());
+        EXPECT_TRUE(box.isInfinite());
+    }
+
+    TEST_F(ABoundingBox, computesBoxFromVector3Data)
+    {
+        const BoundingBox box = FromFloats({ 1.f, -2.f, 3.f, -4.f, 5.f, -6.f, 0.f, 0.f, 0.f }, EDataType::Vector3F);
+        EXPECT_EQ(Vector3(-4.f, -2.f, -6.f), box.min);
+        EXPECT_EQ(Vector3(1.f, 5.f, 3.f), box.max);
+    }
+
+    TEST_F(ABoundingBox, computesBoxFromVector2DataWithZeroDepth)
+    {
+        const BoundingBox box = FromFloats({ 1.f, -2.f, -4.f, 5.f }, EDataType::Vector2F);
+        EXPECT_EQ(Vector3(-4.f, -2.f, 0.f), box.min);
+        EXPECT_EQ(Vector3(1.f, 5.f, 0.f), box.max);
+    }
+
+    TEST_F(ABoundingBox, computesBoxFromVector4DataIgnoringW)
+    {
+        const BoundingBox box = FromFloats({ 1.f, -2.f, 3.f, 100.f, -4.f, 5.f, -6.f, -100.f }, EDataType::Vector4F);
+        EXPECT_EQ(Vector3(-4.f, -2.f, -6.f), box.min);
+        EXPECT_EQ(Vector3(1.f, 5.f, 3.f), box.max);
+    }
+
+    TEST_F(ABoundingBox, computesBoxFromInterleavedData)
+    {
+        // position (vec3) interleaved with texture coordinates (vec2), taking positions from offset 0 and texture coordinates from offset 12
+        const std::vector<float> data{ 1.f, 2.f, 3.f, 100.f, 200.f, -1.f, -2.f, -3.f, -100.f, -200.f };
+        const BoundingBox positionsBox = FromFloats(data, EDataType::Vector3F, 0u, 5u * sizeof(float));
+        EXPECT_EQ(Vector3(-1.f, -2.f, -3.f), positionsBox.min);
+        EXPECT_EQ(Vector3(1.f, 2.f, 3.f), positionsBox.max);
+
+        const BoundingBox texCoordsBox = FromFloats(data, EDataType::Vector2F, 3u * sizeof(float), 5u * sizeof(float));
+        EXPECT_EQ(Vector3(-100.f, -200.f, 0.f), texCoordsBox.min);
+        EXPECT_EQ(Vector3(100.f, 200.f, 0.f), texCoordsBox.max);
+    }
+
+    TEST_F(ABoundingBox, isEmptyForNoData)
+    {
+        EXPECT_TRUE(FromFloats({}, EDataType::Vector3F).isEmpty());
+    }
+
+    TEST_F(ABoundingBox, isInfiniteIfDataContainsNonFiniteValues)
+    {
+        EXPECT_TRUE(FromFloats({ 1.f, 2.f, std::numeric_limits<float>::infinity() }, EDataType::Vector3F).isInfinite());
+    }
+
+    TEST_F(ABoundingBox, mergesWithOtherBox)
+    {
+        BoundingBox box = CreateBox({ 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+        box.merge(CreateBox({ -1.f, 0.5f, 0.5f }, { 0.5f, 2.f, 0.5f }));
+        EXPECT_EQ(Vector3(-1.f, 0.f, 0.f), box.min);
+        EXPECT_EQ(Vector3(1.f, 2.f, 1.f), box.max);
+
+        box.merge(BoundingBox());
+        EXPECT_EQ(Vector3(-1.f, 0.f, 0.f), box.min);
+        EXPECT_EQ(Vector3(1.f, 2.f, 1.f), box.max);
+
+        box.merge(BoundingBox::Infinite());
+        EXPECT_TRUE(box.isInfinite());
+    }
+
+    TEST_F(ABoundingBox, isInsideFrustumIfContainedOrIntersecting)
+    {
+        EXPECT_FALSE(CreateBox({ -1.f, -1.f, -11.f }, { 1.f, 1.f, -10.f }).isOutsideFrustum(viewProjection));
+        EXPECT_FALSE(CreateBox({ -100.f, -100.f, -50.f }, { 100.f, 100.f, 50.f }).isOutsideFrustum(viewProjection));
+        EXPECT_FALSE(CreateBox({ 9.f, -1.f, -11.f }, { 11.f, 1.f, -10.f }).isOutsideFrustum(viewProjection));
+    }
+
+    TEST_F(ABoundingBox, isOutsideFrustumIfCompletelyOnOuterSideOfAnyPlane)
+    {
+        EXPECT_TRUE(CreateBox({ -1.f, -1.f, 1.f }, { 1.f, 1.f, 2.f }).isOutsideFrustum(viewProjection));       // behind camera
+        EXPECT_TRUE(CreateBox({ -1.f, -1.f, -0.9f }, { 1.f, 1.f, -0.5f }).isOutsideFrustum(viewProjection));   // before near plane
+        EXPECT_TRUE(CreateBox({ -1.f, -1.f, -200.f }, { 1.f, 1.f, -101.f }).isOutsideFrustum(viewProjection)); // beyond far plane
+        EXPECT_TRUE(CreateBox({ 12.f, -1.f, -11.f }, { 14.f, 1.f, -10.f }).isOutsideFrustum(viewProjection));  // right
+        EXPECT_TRUE(CreateBox({ -14.f, -1.f, -11.f }, { -12.f, 1.f, -10.f }).isOutsideFrustum(viewProjection)); // left
+        EXPECT_TRUE(CreateBox({ -1.f, 12.f, -11.f }, { 1.f, 14.f, -10.f }).isOutsideFrustum(viewProjection));  // top
+        EXPECT_TRUE(CreateBox({ -1.f, -14.f, -11.f }, { 1.f, -12.f, -10.f }).isOutsideFrustum(viewProjection)); // bottom
+    }
+
+    TEST_F(ABoundingBox, considersModelTransformation)
+    {
+        const BoundingBox box = CreateBox({ -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f });
+        EXPECT_TRUE(box.isOutsideFrustum(viewProjection));
+        EXPECT_FALSE(box.isOutsideFrustum(viewProjection * Matrix44f::Translation({ 0.f, 0.f, -10.f })));
+        EXPECT_TRUE(box.isOutsideFrustum(viewProjection * Matrix44f::Translation({ 50.f, 0.f, -10.f })));
+    }
+
+    TEST_F(ABoundingBox, emptyBoxIsAlwaysOutsideAndInfiniteBoxNeverOutsideFrustum)
+    {
+        EXPECT_TRUE(BoundingBox().isOutsideFrustum(viewProjection));
+        EXPECT_FALSE(BoundingBox::Infinite().isOutsideFrustum(viewProjection));
+    }
+}
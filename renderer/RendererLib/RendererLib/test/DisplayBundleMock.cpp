@@ -11,5 +11,9 @@
 namespace ramses_internal
 {
     DisplayBundleMock::DisplayBundleMock() = default;
-    DisplayBundleMock::~DisplayBundleMock() = default;
+    DisplayBundleMock::~DisplayBundleMock()
+    {
+        if (m_onDestruction)
+            m_onDestruction();
+    }
 }
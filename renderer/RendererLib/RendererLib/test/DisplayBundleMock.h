@@ -13,6 +13,7 @@
 #include "RendererLib/DisplayBundle.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IEmbeddedCompositor.h"
+#include <functional>
 
 namespace ramses_internal
 {
@@ -29,6 +30,9 @@ namespace ramses_internal
         MOCK_METHOD(SceneId, findMasterSceneForReferencedScene, (SceneId refScene), (const, override));
         MOCK_METHOD(IEmbeddedCompositingManager&, getECManager, (DisplayHandle display), (override));
         MOCK_METHOD(IEmbeddedCompositor&, getEC, (DisplayHandle display), (override));
+
+        // called from destructor if set, allows tests to check where display bundle gets destroyed
+        std::function<void()> m_onDestruction;
     };
 }
 #endif
@@ -56,7 +56,9 @@ namespace ramses_internal
             EXPECT_TRUE(absl::holds_alternative<RendererCommand::CreateDisplay>(cmds.front()));
             cmds.clear();
         }));
-        EXPECT_CALL(*displayBundle, doOneLoop(_, _));
+        // display threads are not running in tests, dispatcher must not loop displays itself
+        if (!m_useDisplayThreads)
+            EXPECT_CALL(*displayBundle, doOneLoop(_, _));
 
         return { std::move(platform), std::move(displayBundle), {} };
     }
@@ -69,6 +71,14 @@ namespace ramses_internal
         return static_cast<::testing::StrictMock<DisplayBundleMock>*>(m_displays[display].m_displayBundle.get());
     }
 
+    DisplayThread* DisplayDispatcherFacade::getDisplayThread(DisplayHandle display)
+    {
+        if (m_displays.count(display) == 0)
+            return nullptr;
+
+        return m_displays[display].m_displayThread.get();
+    }
+
     DisplayHandleVector DisplayDispatcherFacade::getDisplays() const
     {
         DisplayHandleVector displays;
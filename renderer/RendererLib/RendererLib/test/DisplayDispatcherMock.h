@@ -34,6 +34,7 @@ namespace ramses_internal
         virtual Display createDisplayBundle() override;
 
         ::testing::StrictMock<DisplayBundleMock>* getDisplayBundleMock(DisplayHandle display);
+        DisplayThread* getDisplayThread(DisplayHandle display);
         DisplayHandleVector getDisplays() const;
 
         RendererCommands m_expectedBroadcastCommandsForNewDisplays;
@@ -9,6 +9,8 @@
 #include "gmock/gmock.h"
 #include "DisplayDispatcherMock.h"
 #include "RendererSceneEventSenderMock.h"
+#include <future>
+#include <thread>
 
 using namespace testing;
 
@@ -17,15 +19,18 @@ namespace ramses_internal
     class ADisplayDispatcher : public ::testing::Test
     {
     public:
-        ADisplayDispatcher()
-            : m_displayDispatcher(RendererConfig{}, m_commandBuffer, m_sceneEventSender)
+        explicit ADisplayDispatcher(const RendererConfig& config = {})
+            : m_displayDispatcher(config, m_commandBuffer, m_sceneEventSender)
         {
         }
 
         void update()
         {
-            for (const auto d : m_displayDispatcher.getDisplays())
-                EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(d), doOneLoop(ELoopMode::UpdateOnly, _));
+            if (!m_displayDispatcher.isUsingDisplayThreads())
+            {
+                for (const auto d : m_displayDispatcher.getDisplays())
+                    EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(d), doOneLoop(ELoopMode::UpdateOnly, _));
+            }
             m_displayDispatcher.doOneLoop(ELoopMode::UpdateOnly);
         }
 
@@ -560,4 +565,115 @@ namespace ramses_internal
         EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(display1), dispatchRendererEvents(_));
         dispatchAndExpectRendererEvents({});
     }
+
+    class ADisplayDispatcherWithDisplayThreads : public ADisplayDispatcher
+    {
+    public:
+        ADisplayDispatcherWithDisplayThreads()
+            : ADisplayDispatcher(CreateConfigWithDisplayThreads())
+        {
+        }
+
+        static RendererConfig CreateConfigWithDisplayThreads()
+        {
+            RendererConfig config;
+            config.enableDisplayThreads(true);
+            return config;
+        }
+    };
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, createsStoppedDisplayThreadForEachDisplay)
+    {
+        EXPECT_TRUE(m_displayDispatcher.isUsingDisplayThreads());
+        createDisplay(DisplayHandle{ 1u });
+        createDisplay(DisplayHandle{ 2u });
+
+        ASSERT_TRUE(m_displayDispatcher.getDisplayThread(DisplayHandle{ 1u }) != nullptr);
+        ASSERT_TRUE(m_displayDispatcher.getDisplayThread(DisplayHandle{ 2u }) != nullptr);
+        EXPECT_FALSE(m_displayDispatcher.getDisplayThread(DisplayHandle{ 1u })->isUpdating());
+        EXPECT_FALSE(m_displayDispatcher.getDisplayThread(DisplayHandle{ 2u })->isUpdating());
+    }
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, pushesCommandsToDisplayWithoutLoopingIt)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        createDisplay(display1);
+
+        m_commandBuffer.enqueueCommand(RendererCommand::CreateOffscreenBuffer{ display1, {}, {}, {}, {}, {} });
+        expectCommandPushed(display1, RendererCommand::CreateOffscreenBuffer{});
+        EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(display1), doOneLoop(_, _)).Times(0);
+        update();
+    }
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, displayThreadLoopsDisplayWhenStarted)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        createDisplay(display1);
+
+        struct LoopSignal
+        {
+            std::promise<void> looped;
+            std::atomic<bool> signaled{ false };
+        };
+        auto signal = std::make_shared<LoopSignal>();
+        auto loopedFuture = signal->looped.get_future();
+        EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(display1), doOneLoop(ELoopMode::UpdateOnly, _)).WillRepeatedly(InvokeWithoutArgs([signal]()
+        {
+            if (!signal->signaled.exchange(true))
+                signal->looped.set_value();
+        }));
+
+        m_displayDispatcher.setLoopMode(ELoopMode::UpdateOnly);
+        m_displayDispatcher.startDisplayThreadsUpdating();
+        EXPECT_TRUE(m_displayDispatcher.getDisplayThread(display1)->isUpdating());
+        EXPECT_EQ(std::future_status::ready, loopedFuture.wait_for(std::chrono::seconds{ 10 }));
+
+        m_displayDispatcher.stopDisplayThreadsUpdating();
+        EXPECT_FALSE(m_displayDispatcher.getDisplayThread(display1)->isUpdating());
+    }
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, appliesFrameDurationLimitPerDisplay)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        constexpr DisplayHandle display2{ 2u };
+        m_displayDispatcher.setMinFrameDuration(std::chrono::microseconds{ 20000u });
+        // can be set before display exists
+        m_displayDispatcher.setMinFrameDuration(std::chrono::microseconds{ 50000u }, display2);
+        createDisplay(display1);
+        createDisplay(display2);
+
+        EXPECT_EQ(std::chrono::microseconds{ 20000u }, m_displayDispatcher.getDisplayThread(display1)->getMinFrameDuration());
+        EXPECT_EQ(std::chrono::microseconds{ 50000u }, m_displayDispatcher.getDisplayThread(display2)->getMinFrameDuration());
+
+        m_displayDispatcher.setMinFrameDuration(std::chrono::microseconds{ 10000u }, display1);
+        EXPECT_EQ(std::chrono::microseconds{ 10000u }, m_displayDispatcher.getDisplayThread(display1)->getMinFrameDuration());
+        EXPECT_EQ(std::chrono::microseconds{ 50000u }, m_displayDispatcher.getDisplayThread(display2)->getMinFrameDuration());
+
+        // global limit overrides all
+        m_displayDispatcher.setMinFrameDuration(std::chrono::microseconds{ 30000u });
+        EXPECT_EQ(std::chrono::microseconds{ 30000u }, m_displayDispatcher.getDisplayThread(display1)->getMinFrameDuration());
+        EXPECT_EQ(std::chrono::microseconds{ 30000u }, m_displayDispatcher.getDisplayThread(display2)->getMinFrameDuration());
+    }
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, destroysDisplayThreadWhenDisplayDestroyed)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        createDisplay(display1);
+        ASSERT_TRUE(m_displayDispatcher.getDisplayThread(display1) != nullptr);
+        destroyDisplay(display1);
+        EXPECT_TRUE(m_displayDispatcher.getDisplayThread(display1) == nullptr);
+    }
+
+    TEST_F(ADisplayDispatcherWithDisplayThreads, destroysDisplayBundleInItsDisplayThreadWhenDisplayDestroyed)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        createDisplay(display1);
+
+        std::thread::id destructionThreadId;
+        m_displayDispatcher.getDisplayBundleMock(display1)->m_onDestruction = [&destructionThreadId]() { destructionThreadId = std::this_thread::get_id(); };
+        destroyDisplay(display1);
+
+        EXPECT_NE(std::thread::id{}, destructionThreadId);
+        EXPECT_NE(std::this_thread::get_id(), destructionThreadId);
+    }
 }
@@ -9,10 +9,13 @@
 #include "renderer_common_gmock_header.h"
 #include "RendererAPI/Types.h"
 #include "RendererLib/PendingSceneResourcesUtils.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
 #include "RendererResourceManagerMock.h"
-#include "Scene/Scene.h"
+#include "RendererEventCollector.h"
 #include "SceneAllocateHelper.h"
 #include "SceneUtils/ResourceUtils.h"
+#include <array>
 
 namespace ramses_internal {
 using namespace testing;
@@ -21,7 +24,8 @@ class APendingSceneResourcesUtils : public ::testing::Test
 {
 public:
     APendingSceneResourcesUtils()
-        : scene(SceneInfo(sceneID))
+        : rendererScenes(rendererEventCollector)
+        , scene(rendererScenes.createScene(SceneInfo(sceneID)))
         , allocateHelper(scene)
     {
         allocateHelper.allocateRenderTarget(renderTargetHandle);
@@ -44,7 +48,9 @@ protected:
     const MemoryHandle dummyHandle = MemoryHandle(123u);
     const MemoryHandle dummyHandle2 = MemoryHandle(124u);
 
-    Scene scene;
+    RendererEventCollector rendererEventCollector;
+    RendererScenes rendererScenes;
+    RendererCachedScene& scene;
     SceneAllocateHelper allocateHelper;
     StrictMock<RendererResourceManagerMock> resourceManager;
 };
@@ -104,7 +110,7 @@ TEST_F(APendingSceneResourcesUtils, appliesSceneResourceActions)
     EXPECT_CALL(resourceManager, uploadStreamTexture(streamTextureHandle, _, sceneID));
     EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, _, _, sceneID));
     EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, _, sceneID));
     EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
     EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, _, _, _, _, _, _, sceneID)).Times(3u); // 3 mips
     PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
@@ -144,7 +150,7 @@ TEST_F(APendingSceneResourcesUtils, getsSceneResourcesFromSceneAndApliesThem)
     EXPECT_CALL(resourceManager, uploadStreamTexture(streamTextureHandle, _, sceneID));
     EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, RenderBufferHandle(81), RenderBufferHandle(82), sceneID));
     EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 0u, 10u, _, sceneID));
 
     EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
     EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, 0u, 0u, 4u, 4u, _, sceneID));
@@ -153,6 +159,66 @@ TEST_F(APendingSceneResourcesUtils, getsSceneResourcesFromSceneAndApliesThem)
     PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
 }
 
+TEST_F(APendingSceneResourcesUtils, updatesOnlyModifiedRangeOfDataBufferAfterItWasUploaded)
+{
+    SceneResourceActionVector actions;
+    actions.push_back(SceneResourceAction(dataBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer));
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 0u, 10u, _, sceneID));
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+    const std::array<Byte, 3> data{ { 1u, 2u, 3u } };
+    scene.updateDataBuffer(dataBufferHandle, 2u, 2u, data.data());
+    scene.updateDataBuffer(dataBufferHandle, 5u, 3u, data.data());
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 2u, 6u, scene.getDataBuffer(dataBufferHandle).data.data() + 2u, sceneID));
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+    // nothing modified since last upload
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+}
+
+TEST_F(APendingSceneResourcesUtils, updatesOnlyModifiedRegionOfTextureBufferAfterItWasUploaded)
+{
+    SceneResourceActionVector actions;
+    actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, _, 0u, 0u, _, _, _, sceneID)).Times(3u); // 3 mips
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+    const std::array<Byte, 3> data{ { 1u, 2u, 3u } };
+    scene.updateTextureBuffer(textureBufferHandle, 0u, 1u, 1u, 1u, 2u, data.data());
+    scene.updateTextureBuffer(textureBufferHandle, 0u, 2u, 2u, 1u, 1u, data.data() + 2u);
+
+    // bounding region of updates in mip 0 is uploaded, tightly packed
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, 1u, 1u, 2u, 2u, _, sceneID)).WillOnce(Invoke(
+        [](TextureBufferHandle, UInt32, UInt32, UInt32, UInt32, UInt32, const Byte* regionData, SceneId)
+        {
+            EXPECT_EQ(1u, regionData[0]);
+            EXPECT_EQ(0u, regionData[1]);
+            EXPECT_EQ(2u, regionData[2]);
+            EXPECT_EQ(3u, regionData[3]);
+        }));
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+    // nothing modified since last upload
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+}
+
+TEST_F(APendingSceneResourcesUtils, updatesWholeBuffersAfterResourceCacheReset)
+{
+    SceneResourceActionVector actions;
+    actions.push_back(SceneResourceAction(dataBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer));
+    actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 0u, 10u, _, sceneID));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, _, 0u, 0u, _, _, _, sceneID)).Times(3u);
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+    scene.resetResourceCache();
+    EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 0u, 10u, _, sceneID));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, 0u, 0u, 4u, 4u, _, sceneID));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 1u, 0u, 0u, 2u, 2u, _, sceneID));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 2u, 0u, 0u, 1u, 1u, _, sceneID));
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+}
+
 TEST_F(APendingSceneResourcesUtils, cancelsOutCreateAndDeleteDuringConsolidation)
 {
     for (const auto& crateDestroyPair : TestSceneResourceActions)
@@ -11,6 +11,7 @@
 #include "RenderBackendMock.h"
 #include "EmbeddedCompositingManagerMock.h"
 #include "RenderExecutor.h"
+#include "RendererLib/UniformUploadCache.h"
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererScenes.h"
@@ -350,7 +351,8 @@ protected:
         bool expectRenderStateChanges = true,
         bool expectIndexBufferActivation = true,
         UInt32 instanceCount = 1u,
-        bool expectIndexedRendering = true)
+        bool expectIndexedRendering = true,
+        bool expectUniformValues = true)
     {
         // TODO violin this is not entirely needed, only need to check that draw call is at the end of the commands
         InSequence seq;
@@ -384,15 +386,21 @@ protected:
         }
         EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertPosField, 3u, startVertex, EDataType::Vector3Buffer, 17u, 77u)).RetiresOnSaturation();
         EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertTexcoordField, 4u, startVertex, EDataType::Vector2Buffer, 18u, 88u)).RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                       .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))                  .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedViewMatrix)))))                    .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .RetiresOnSaturation();
+        if (expectUniformValues)
+        {
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                   .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))              .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedViewMatrix)))))                .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                .RetiresOnSaturation();
+        }
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureField))                                                                         .RetiresOnSaturation();
         EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod::Clamp, EWrapMethod::Repeat, EWrapMethod::RepeatMirrored, ESamplingMethod::Nearest_MipMapNearest, ESamplingMethod::Nearest, 2u)).RetiresOnSaturation();
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureFieldMS))                                                                         .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                     .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))             .RetiresOnSaturation();
+        if (expectUniformValues)
+        {
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                 .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))         .RetiresOnSaturation();
+        }
         if (expectIndexBufferActivation)
         {
             EXPECT_CALL(device, activateIndexBuffer(FakeIndexBufferDeviceHandle))                                                                           .RetiresOnSaturation();
@@ -458,11 +466,11 @@ protected:
         Mock::VerifyAndClearExpectations(&renderer);
     }
 
-    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr)
+    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr, UniformUploadCache* uniformUploadCache = nullptr)
     {
         const Viewport vp(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight);
         const TargetBufferInfo bufferInfo{ DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, vp.width, vp.height };
-        RenderExecutor executor(device, bufferInfo, renderFrom, frameTimer);
+        RenderExecutor executor(device, bufferInfo, renderFrom, frameTimer, uniformUploadCache);
 
         return executor.executeScene(scene);
     }
@@ -523,6 +531,80 @@ TEST_F(ARenderExecutor, RenderRenderableWithoutIndexArray)
     executeScene();
 }
 
+TEST_F(ARenderExecutor, SkipsUploadOfUnchangedUniformValuesWithUniformUploadCache)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(true, false), createRenderGroup(pass));
+    scene.setRenderPassClearFlag(pass, ramses_internal::EClearFlags::EClearFlags_None);
+    const Matrix44f expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    UniformUploadCache uniformUploadCache;
+    UInt32 numUploaded = 0u;
+    UInt32 numSkipped = 0u;
+
+    updateScenes();
+    {
+        InSequence seq;
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, true, true, false, 1, false);
+    }
+    executeScene({}, nullptr, &uniformUploadCache);
+    Mock::VerifyAndClearExpectations(&device);
+    uniformUploadCache.getAndResetUniformCounts(numUploaded, numSkipped);
+    EXPECT_EQ(6u, numUploaded);
+    EXPECT_EQ(0u, numSkipped);
+
+    // textures are bound regardless, all other uniforms are still set in shader
+    updateScenes();
+    {
+        InSequence seq;
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, true, true, false, 1, false, false);
+    }
+    executeScene({}, nullptr, &uniformUploadCache);
+    Mock::VerifyAndClearExpectations(&device);
+    uniformUploadCache.getAndResetUniformCounts(numUploaded, numSkipped);
+    EXPECT_EQ(0u, numUploaded);
+    EXPECT_EQ(6u, numSkipped);
+}
+
+TEST_F(ARenderExecutor, UploadsUniformValuesAgainAfterReferencedDataChanged)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(true, false), createRenderGroup(pass));
+    scene.setRenderPassClearFlag(pass, ramses_internal::EClearFlags::EClearFlags_None);
+    const Matrix44f expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    UniformUploadCache uniformUploadCache;
+
+    updateScenes();
+    {
+        InSequence seq;
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, true, true, false, 1, false);
+    }
+    executeScene({}, nullptr, &uniformUploadCache);
+    Mock::VerifyAndClearExpectations(&device);
+
+    // set same value, change is detected by data generation and not by value
+    scene.setDataSingleFloat(dataRef1, DataFieldHandle(0u), 0.1f);
+
+    updateScenes();
+    {
+        InSequence seq;
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, true, true, false, 1, false);
+    }
+    executeScene({}, nullptr, &uniformUploadCache);
+    Mock::VerifyAndClearExpectations(&device);
+
+    UInt32 numUploaded = 0u;
+    UInt32 numSkipped = 0u;
+    uniformUploadCache.getAndResetUniformCounts(numUploaded, numSkipped);
+    EXPECT_EQ(12u, numUploaded);
+    EXPECT_EQ(0u, numSkipped);
+}
+
 TEST_F(ARenderExecutor, RenderMultipleConsecutiveRenderPassesIntoOneRenderTarget)
 {
     const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "TestSceneHelper.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererEventCollector.h"
+#include <chrono>
+#include <string>
+
+namespace ramses_internal
+{
+    // Compares cost of render queue update after a single renderable visibility flip with a full rebuild of all groups and passes.
+    // Results are recorded as test properties (microseconds), the test itself only checks that the render queue is correct.
+    class ARendererCachedSceneBenchmark : public testing::Test
+    {
+    public:
+        ARendererCachedSceneBenchmark()
+            : rendererScenes(rendererEventCollector)
+            , scene(rendererScenes.createScene(SceneInfo()))
+            , sceneHelper(scene)
+        {
+            for (UInt32 p = 0u; p < PassCount; ++p)
+                passes.push_back(sceneHelper.createRenderPassWithCamera());
+
+            for (UInt32 g = 0u; g < GroupCount; ++g)
+            {
+                const RenderGroupHandle group = sceneHelper.createRenderGroup(passes[g % PassCount]);
+                for (UInt32 r = 0u; r < RenderablesPerGroup; ++r)
+                {
+                    const RenderableHandle renderable = sceneHelper.createRenderable();
+                    scene.addRenderableToRenderGroup(group, renderable, static_cast<Int32>(RenderablesPerGroup - r));
+                    renderables.push_back(renderable);
+                }
+            }
+        }
+
+    protected:
+        static constexpr UInt32 PassCount = 4u;
+        static constexpr UInt32 GroupCount = 200u;
+        static constexpr UInt32 RenderablesPerGroup = 100u;
+        static constexpr UInt32 UpdateRounds = 50u;
+
+        void update()
+        {
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        }
+
+        size_t getNumberOfRenderablesInPasses() const
+        {
+            size_t count = 0u;
+            for (const auto pass : passes)
+                count += scene.getOrderedRenderablesForPass(pass).size();
+            return count;
+        }
+
+        template <typename Func>
+        static int MeasureUs(Func&& func)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            func();
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        }
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        RendererCachedScene& scene;
+        TestSceneHelper sceneHelper;
+        std::vector<RenderPassHandle> passes;
+        std::vector<RenderableHandle> renderables;
+    };
+
+    TEST_F(ARendererCachedSceneBenchmark, Benchmark_visibilityFlipOfSingleRenderable)
+    {
+        RecordProperty("InitialUpdateUs", MeasureUs([&] { update(); }));
+        EXPECT_EQ(renderables.size(), getNumberOfRenderablesInPasses());
+
+        const RenderableHandle flippedRenderable = renderables[renderables.size() / 2u];
+        RecordProperty("VisibilityFlipUpdateUs", MeasureUs([&]
+        {
+            for (UInt32 i = 0u; i < UpdateRounds; ++i)
+            {
+                scene.setRenderableVisibility(flippedRenderable, (i % 2u == 0u) ? EVisibilityMode::Off : EVisibilityMode::Visible);
+                update();
+            }
+        }) / static_cast<int>(UpdateRounds));
+        EXPECT_EQ(renderables.size(), getNumberOfRenderablesInPasses());
+
+        // releasing a group invalidates all cached groups and passes, this is the cost of every update without incremental caching
+        RecordProperty("FullRebuildUpdateUs", MeasureUs([&]
+        {
+            for (UInt32 i = 0u; i < UpdateRounds; ++i)
+            {
+                scene.setRenderableVisibility(flippedRenderable, (i % 2u == 0u) ? EVisibilityMode::Off : EVisibilityMode::Visible);
+                scene.releaseRenderGroup(sceneHelper.createRenderGroup());
+                update();
+            }
+        }) / static_cast<int>(UpdateRounds));
+        EXPECT_EQ(renderables.size(), getNumberOfRenderablesInPasses());
+    }
+}
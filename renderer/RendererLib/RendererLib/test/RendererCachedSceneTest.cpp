@@ -35,6 +35,32 @@ namespace ramses_internal
                 EXPECT_EQ(r, orderedRenderables[i++]);
         }
 
+        RenderableHandle createRenderableWithVertexDataBuffer(RenderGroupHandle group, DataBufferHandle vertexBuffer)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable(group);
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeTexture());
+            const DataInstanceHandle vertexData = sceneHelper.createAndAssignVertexDataInstance(renderable);
+            sceneHelper.setResourcesToRenderable(renderable, false, true);
+            scene.setDataResource(vertexData, sceneHelper.vertAttribField, ResourceContentHash::Invalid(), vertexBuffer, 0u, 0u, 0u);
+            ON_CALL(sceneHelper.resourceManager, getDataBufferDeviceHandle(vertexBuffer, _)).WillByDefault(Return(DeviceResourceHandle(123u)));
+            return renderable;
+        }
+
+        DataBufferHandle createVertexDataBuffer(const std::vector<float>& vertices)
+        {
+            const UInt32 sizeInBytes = static_cast<UInt32>(vertices.size() * sizeof(float));
+            const DataBufferHandle vertexBuffer = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, sizeInBytes);
+            scene.updateDataBuffer(vertexBuffer, 0u, sizeInBytes, reinterpret_cast<const Byte*>(vertices.data()));
+            return vertexBuffer;
+        }
+
+        void expectBoundingBox(RenderableHandle renderable, const Vector3& min, const Vector3& max)
+        {
+            const BoundingBox& box = scene.getRenderableBoundingBox(renderable);
+            EXPECT_EQ(min, box.min);
+            EXPECT_EQ(max, box.max);
+        }
+
         RendererEventCollector rendererEventCollector;
         RendererScenes rendererScenes;
         RendererCachedScene& scene;
@@ -690,6 +716,143 @@ namespace ramses_internal
         EXPECT_TRUE(contains_c(renderables2, rend3));
     }
 
+    TEST_F(ARendererCachedScene, UpdatesOnlyAffectedPassWhenRenderableVisibilityChanges)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass1);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass2);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend3 });
+
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend3 });
+
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, UpdatesParentGroupsWhenRenderableInNestedGroupChangesVisibility)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle nestedNestedGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 1);
+        scene.addRenderGroupToRenderGroup(nestedGroup, nestedNestedGroup, 1);
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 0);
+        scene.addRenderableToRenderGroup(nestedNestedGroup, rend3, 0);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Visible);
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, UpdatesReenabledPassWithChangesOfSharedGroupDoneWhilePassDisabled)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass1, pass2);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+
+        scene.setRenderPassEnabled(pass2, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1 });
+        expectOrderedRenderablesInPass(pass2, {});
+
+        // group changed and updated while only pass1 rendered
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, {});
+
+        scene.setRenderPassEnabled(pass2, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend1, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, UpdatesReenabledPassWithChangesOfNestedGroupRebuiltThroughOtherPass)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle parentGroup = sceneHelper.createRenderGroup(pass2);
+        const RenderGroupHandle nestedGroup = sceneHelper.createRenderGroup(pass1);
+        scene.addRenderGroupToRenderGroup(parentGroup, nestedGroup, 0);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(nestedGroup);
+
+        scene.setRenderPassEnabled(pass2, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1 });
+        expectOrderedRenderablesInPass(pass2, {});
+
+        // nested group changed and rebuilt through pass1 while its parent group is not rendered
+        const RenderableHandle rend2 = sceneHelper.createRenderable(nestedGroup);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, {});
+
+        scene.setRenderPassEnabled(pass2, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend1, rend2 });
+
+        // same for visibility change and render once pass
+        scene.setRenderPassEnabled(pass2, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend2 });
+
+        scene.setRenderPassRenderOnce(pass2, true);
+        scene.setRenderPassEnabled(pass2, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass2, { rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, KeepsPassRenderablesAfterNestedGroupRemovedAndReleased)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle parentGroup = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderGroup(parentGroup, nestedGroup, 1);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(parentGroup);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(nestedGroup);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        scene.removeRenderGroupFromRenderGroup(parentGroup, nestedGroup);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1 });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Off);
+        scene.releaseRenderGroup(nestedGroup);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1 });
+    }
+
     TEST_F(ARendererCachedScene, RetrievesOrderedRenderPassesBasedOnSetRenderOrder)
     {
         const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
@@ -1055,6 +1218,35 @@ namespace ramses_internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, reordersRenderablesWhenGeometryChangedAfterUpdate)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+
+        const ResourceContentHash effect1{ 1, 0 };
+        const ResourceContentHash effect2{ 2, 0 };
+        ON_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(effect1)).WillByDefault(Return(DeviceResourceHandle(1)));
+        ON_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(effect2)).WillByDefault(Return(DeviceResourceHandle(2)));
+        const DataLayoutHandle effect1layout = sceneAllocator.allocateDataLayout({}, effect1);
+        const DataLayoutHandle effect2layout = sceneAllocator.allocateDataLayout({}, effect2);
+        const DataInstanceHandle effect1geometry = sceneAllocator.allocateDataInstance(effect1layout);
+        const DataInstanceHandle effect2geometry = sceneAllocator.allocateDataInstance(effect2layout);
+
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect1geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect2geometry);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        const DataInstanceHandle effect2geometry2 = sceneAllocator.allocateDataInstance(effect2layout);
+        const DataInstanceHandle effect1geometry2 = sceneAllocator.allocateDataInstance(effect1layout);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect2geometry2);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect1geometry2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1435,4 +1627,134 @@ namespace ramses_internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    TEST_F(ARendererCachedScene, computesBoundingBoxFromVertexDataBufferForRenderableInPassWithFrustumCulling)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrustumCulling(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = createRenderableWithVertexDataBuffer(group, createVertexDataBuffer({ -1.f, 2.f, 3.f, 4.f, -5.f, 6.f }));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, -5.f, 3.f }, { 4.f, 2.f, 6.f });
+    }
+
+    TEST_F(ARendererCachedScene, doesNotComputeBoundingBoxForRenderableInPassWithoutFrustumCulling)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = createRenderableWithVertexDataBuffer(group, createVertexDataBuffer({ -1.f, 2.f, 3.f, 4.f, -5.f, 6.f }));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_TRUE(scene.getRenderableBoundingBox(renderable).isInfinite());
+    }
+
+    TEST_F(ARendererCachedScene, updatesBoundingBoxWhenVertexDataBufferIsUpdated)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrustumCulling(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const DataBufferHandle vertexBuffer = createVertexDataBuffer({ -1.f, 2.f, 3.f, 4.f, -5.f, 6.f });
+        const RenderableHandle renderable = createRenderableWithVertexDataBuffer(group, vertexBuffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, -5.f, 3.f }, { 4.f, 2.f, 6.f });
+
+        const std::vector<float> newVertex{ 10.f, 20.f, 30.f };
+        scene.updateDataBuffer(vertexBuffer, 3u * sizeof(float), 3u * sizeof(float), reinterpret_cast<const Byte*>(newVertex.data()));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, 2.f, 3.f }, { 10.f, 20.f, 30.f });
+    }
+
+    TEST_F(ARendererCachedScene, updatesBoundingBoxWhenSwitchingToOtherVertexDataBuffer)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrustumCulling(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = createRenderableWithVertexDataBuffer(group, createVertexDataBuffer({ -1.f, 2.f, 3.f, 4.f, -5.f, 6.f }));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, -5.f, 3.f }, { 4.f, 2.f, 6.f });
+
+        const DataBufferHandle otherVertexBuffer = createVertexDataBuffer({ 0.f, 0.f, 0.f, 1.f, 1.f, 1.f });
+        ON_CALL(sceneHelper.resourceManager, getDataBufferDeviceHandle(otherVertexBuffer, _)).WillByDefault(Return(DeviceResourceHandle(124u)));
+        const DataInstanceHandle vertexData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        scene.setDataResource(vertexData, sceneHelper.vertAttribField, ResourceContentHash::Invalid(), otherVertexBuffer, 0u, 0u, 0u);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+    }
+
+    TEST_F(ARendererCachedScene, usesBoundingBoxOfVertexArrayResource)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrustumCulling(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = sceneHelper.createRenderable(group);
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeTexture());
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+
+        BoundingBox vertexArrayBox;
+        vertexArrayBox.min = { -1.f, -2.f, -3.f };
+        vertexArrayBox.max = { 1.f, 2.f, 3.f };
+        EXPECT_CALL(sceneHelper.resourceManager, getVertexArrayBoundingBox(MockResourceHash::VertArrayHash)).WillOnce(Return(vertexArrayBox));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, -2.f, -3.f }, { 1.f, 2.f, 3.f });
+
+        // cached till vertex data changes
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectBoundingBox(renderable, { -1.f, -2.f, -3.f }, { 1.f, 2.f, 3.f });
+    }
+
+    TEST_F(ARendererCachedScene, hasUnknownBoundingBoxForInstancedRenderable)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrustumCulling(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = createRenderableWithVertexDataBuffer(group, createVertexDataBuffer({ -1.f, 2.f, 3.f, 4.f, -5.f, 6.f }));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.getRenderableBoundingBox(renderable).isInfinite());
+
+        scene.setRenderableInstanceCount(renderable, 2u);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_TRUE(scene.getRenderableBoundingBox(renderable).isInfinite());
+    }
+
+    TEST_F(ARendererCachedScene, changesUniformDataGenerationWhenDataOrReferencedDataChange)
+    {
+        const DataLayoutHandle refLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid());
+        const DataInstanceHandle refData = sceneAllocator.allocateDataInstance(refLayout);
+        const DataLayoutHandle uniformLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Float }, DataFieldInfo{ EDataType::DataReference } }, ResourceContentHash::Invalid());
+        const DataInstanceHandle uniformData = sceneAllocator.allocateDataInstance(uniformLayout);
+        scene.setDataReference(uniformData, DataFieldHandle(1u), refData);
+
+        const UInt64 generation1 = scene.getUniformDataGeneration(uniformData);
+        EXPECT_EQ(generation1, scene.getUniformDataGeneration(uniformData));
+
+        scene.setDataSingleFloat(uniformData, DataFieldHandle(0u), 1.f);
+        const UInt64 generation2 = scene.getUniformDataGeneration(uniformData);
+        EXPECT_NE(generation1, generation2);
+
+        scene.setDataSingleFloat(refData, DataFieldHandle(0u), 1.f);
+        const UInt64 generation3 = scene.getUniformDataGeneration(uniformData);
+        EXPECT_NE(generation2, generation3);
+
+        // shaders are uploaded again and have no uniform values set
+        scene.resetResourceCache();
+        EXPECT_NE(generation3, scene.getUniformDataGeneration(uniformData));
+    }
+
+    TEST_F(ARendererCachedScene, hasUniqueUniformDataGenerationsAcrossScenes)
+    {
+        RendererCachedScene& otherScene = rendererScenes.createScene(SceneInfo(SceneId(666u)));
+        SceneAllocateHelper otherSceneAllocator(otherScene);
+
+        const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid());
+        const DataInstanceHandle uniformData = sceneAllocator.allocateDataInstance(layout);
+        const DataLayoutHandle otherLayout = otherSceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid(), layout);
+        const DataInstanceHandle otherUniformData = otherSceneAllocator.allocateDataInstance(otherLayout, uniformData);
+
+        EXPECT_NE(scene.getUniformDataGeneration(uniformData), otherScene.getUniformDataGeneration(otherUniformData));
+    }
 }
@@ -22,6 +22,8 @@ TEST(AInternalRendererConfig, hasDefaultValues)
     EXPECT_STREQ("", config.getKPIFileName().c_str());
     EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
     EXPECT_STREQ("", config.getWaylandDisplayForSystemCompositorController().c_str());
+    EXPECT_FALSE(config.getDisplayThreadsEnabled());
+    EXPECT_EQ(0u, config.getTransformationUpdateThreadCount());
 }
 
 TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
@@ -31,6 +33,22 @@ TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
     EXPECT_TRUE(config.getSystemCompositorControlEnabled());
 }
 
+TEST(AInternalRendererConfig, canEnableDisplayThreads)
+{
+    ramses_internal::RendererConfig config;
+    config.enableDisplayThreads(true);
+    EXPECT_TRUE(config.getDisplayThreadsEnabled());
+    config.enableDisplayThreads(false);
+    EXPECT_FALSE(config.getDisplayThreadsEnabled());
+}
+
+TEST(AInternalRendererConfig, canSetTransformationUpdateThreadCount)
+{
+    ramses_internal::RendererConfig config;
+    config.setTransformationUpdateThreadCount(4u);
+    EXPECT_EQ(4u, config.getTransformationUpdateThreadCount());
+}
+
 TEST(AInternalRendererConfig, canGetSetWaylandSocketEmbedded)
 {
     ramses_internal::RendererConfig config;
@@ -390,9 +390,12 @@ TEST_F(ARendererResourceManager, canUploadAndUpdateAndUnloadDataBuffer_IndexBuff
 
     EXPECT_EQ(DeviceMock::FakeIndexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-    const Byte dummyData[10] = {};
-    EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, 7u));
-    resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+    const Byte dummyData[sizeInBytes] = {};
+    EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, sizeInBytes));
+    resourceManager.updateDataBuffer(dataBuffer, 0u, sizeInBytes, dummyData, fakeSceneId);
+
+    EXPECT_CALL(platform.renderBackendMock.deviceMock, updateIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, 3u, dummyData, 7u));
+    resourceManager.updateDataBuffer(dataBuffer, 3u, 7u, dummyData, fakeSceneId);
 
     EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle));
     resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
@@ -409,9 +412,12 @@ TEST_F(ARendererResourceManager, canUploadAndUpdateAndUnloadDataBuffer_VertexBuf
 
     EXPECT_EQ(DeviceMock::FakeVertexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-    const Byte dummyData[10] = {};
-    EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
-    resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+    const Byte dummyData[sizeInBytes] = {};
+    EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, sizeInBytes));
+    resourceManager.updateDataBuffer(dataBuffer, 0u, sizeInBytes, dummyData, fakeSceneId);
+
+    EXPECT_CALL(platform.renderBackendMock.deviceMock, updateVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, 3u, dummyData, 7u));
+    resourceManager.updateDataBuffer(dataBuffer, 3u, 7u, dummyData, fakeSceneId);
 
     EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle));
     resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
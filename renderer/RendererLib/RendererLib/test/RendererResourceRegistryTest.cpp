@@ -159,6 +159,40 @@ TEST_F(ARendererResourceRegistry, canSetResourceFromProvidedToUploaded_willRelea
     EXPECT_TRUE(registry.getAllResourcesNotInUseByScenes().empty());
 }
 
+TEST_F(ARendererResourceRegistry, computesVertexArrayBoundingBoxFromUploadedVertexDataWhenFirstRequested)
+{
+    const float vertices[] = { -1.f, 2.f, 3.f, 4.f, -5.f, 6.f };
+    const auto vertexArray = std::make_shared<const ArrayResource>(EResourceType_VertexArray, 2u, EDataType::Vector3F, vertices, ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    registry.setResourceData(resource, vertexArray);
+    registry.setResourceUploaded(resource, DeviceResourceHandle{ 123u }, 666u);
+
+    const ResourceDescriptor& rd = registry.getResourceDescriptor(resource);
+    EXPECT_FALSE(rd.resource);
+    EXPECT_TRUE(rd.boundingBoxSource);
+
+    const BoundingBox& box = registry.getVertexArrayBoundingBox(resource);
+    EXPECT_EQ(Vector3(-1.f, -5.f, 3.f), box.min);
+    EXPECT_EQ(Vector3(4.f, 2.f, 6.f), box.max);
+    // vertex data released once box is computed
+    EXPECT_FALSE(rd.boundingBoxSource);
+    EXPECT_EQ(1, vertexArray.use_count());
+
+    EXPECT_EQ(Vector3(4.f, 2.f, 6.f), registry.getVertexArrayBoundingBox(resource).max);
+}
+
+TEST_F(ARendererResourceRegistry, hasInfiniteBoundingBoxForResourceOtherThanVertexArray)
+{
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    registry.setResourceData(resource, testManagedResource);
+    registry.setResourceUploaded(resource, DeviceResourceHandle{ 123u }, 666u);
+
+    EXPECT_FALSE(registry.getResourceDescriptor(resource).boundingBoxSource);
+    EXPECT_TRUE(registry.getVertexArrayBoundingBox(resource).isInfinite());
+}
+
 TEST_F(ARendererResourceRegistry, canSetResourceProvidedToBroken_willReleaseResourceData)
 {
     const ResourceContentHash resource(123u, 0u);
@@ -3407,6 +3407,50 @@ TEST_F(ARendererSceneUpdater, resetsInterruptedRenderingIfAnotherSceneUnlinkedFr
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, updatesWorldMatricesOfIndependentScenesUsingWorkerThreads)
+{
+    rendererSceneUpdater->setTransformationUpdateThreadCount(2u);
+    createDisplayAndExpectSuccess();
+
+    constexpr UInt32 NumScenes = 4u;
+    std::vector<TransformHandle> transforms;
+    for (UInt32 i = 0u; i < NumScenes; ++i)
+    {
+        createPublishAndSubscribeScene();
+        mapScene(i);
+        showScene(i);
+
+        expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash }, i);
+        createRenderableNoFlush(i);
+        transforms.push_back(stagingScene[i]->allocateTransform(NodeHandle{ 1u }));
+        setRenderableResources(i);
+
+        expectModifiedScenesReportedToRenderer({ i });
+        update();
+    }
+
+    for (UInt32 i = 0u; i < NumScenes; ++i)
+    {
+        stagingScene[i]->setTranslation(transforms[i], { static_cast<float>(i + 1u), 0.f, 0.f });
+        performFlush(i);
+    }
+    expectModifiedScenesReportedToRenderer({ 0u, 1u, 2u, 3u });
+    update();
+
+    for (UInt32 i = 0u; i < NumScenes; ++i)
+    {
+        const auto& rendererScene = rendererScenes.getScene(getSceneId(i));
+        EXPECT_EQ(Matrix44f::Translation({ static_cast<float>(i + 1u), 0.f, 0.f }), rendererScene.getRenderableWorldMatrix(renderableHandle));
+    }
+
+    for (UInt32 i = 0u; i < NumScenes; ++i)
+    {
+        hideScene(i);
+        unmapScene(i);
+    }
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, resetsInterruptedRenderingIfTransformationLinked)
 {
     createDisplayAndExpectSuccess();
@@ -4832,7 +4876,7 @@ TEST_F(ARendererSceneUpdater, reportsPickedObjects)
 
     expectContextEnable();
     EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[display], uploadDataBuffer(_, _, _, _, _));
-    EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[display], updateDataBuffer(_, _, _, _));
+    EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[display], updateDataBuffer(_, _, _, _, _));
     update();
 
     EXPECT_CALL(*rendererSceneUpdater, handlePickEvent(_, _));
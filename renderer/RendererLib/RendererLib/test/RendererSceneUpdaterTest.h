@@ -63,6 +63,8 @@ public:
         EXPECT_CALL(*rendererSceneUpdater, handleSceneUpdate(_, _)).Times(AnyNumber());
         // resource cache exists but reports it has all resources already - only specific tests cases test further
         EXPECT_CALL(rendererResourceCacheMock, hasResource(_, _)).Times(AnyNumber()).WillRepeatedly(Return(true));
+        // resources reported in cache are announced to scene provider when subscribing - only specific test cases test further
+        EXPECT_CALL(sceneEventSender, sendResourcesAvailable(_, _)).Times(AnyNumber());
     }
 
     virtual void TearDown() override
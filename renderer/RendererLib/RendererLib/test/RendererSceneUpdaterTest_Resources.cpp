@@ -9,6 +9,9 @@
 #include "RendererSceneUpdaterTest.h"
 #include "TestRandom.h"
 #include "Resource/EffectResource.h"
+#include "Resource/ArrayResource.h"
+#include "Components/SingleResourceSerialization.h"
+#include "Utils/BinaryOutputStream.h"
 #include <memory>
 
 namespace ramses_internal {
@@ -235,8 +238,9 @@ TEST_F(ARendererSceneUpdater, offersProvidedResourceToResourceCacheAndStoresOnly
     createRenderable();
     setRenderableResources();
 
-    EXPECT_CALL(rendererResourceCacheMock, hasResource(MockResourceHash::EffectHash, _)).WillOnce(Return(false));
-    EXPECT_CALL(rendererResourceCacheMock, hasResource(MockResourceHash::IndexArrayHash, _)).WillOnce(Return(false));
+    // queried before offering resource and after to know if it was stored
+    EXPECT_CALL(rendererResourceCacheMock, hasResource(MockResourceHash::EffectHash, _)).WillOnce(Return(false)).WillOnce(Return(true));
+    EXPECT_CALL(rendererResourceCacheMock, hasResource(MockResourceHash::IndexArrayHash, _)).Times(2).WillRepeatedly(Return(false));
 
     // wants effect
     EXPECT_CALL(rendererResourceCacheMock, shouldResourceBeCached(MockResourceHash::EffectHash, _, ResourceCacheFlag_DoNotCache, getSceneId())).WillOnce(Return(true));
@@ -252,6 +256,70 @@ TEST_F(ARendererSceneUpdater, offersProvidedResourceToResourceCacheAndStoresOnly
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, announcesResourcesFromResourceCacheWhenRequestingSubscription)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+
+    expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+    createRenderable();
+    setRenderableResources();
+    // cache reports to have both resources after they were provided
+    update();
+
+    const UInt32 sceneIdx = createStagingScene();
+    publishScene(sceneIdx);
+    // cache dropped indices meanwhile
+    EXPECT_CALL(rendererResourceCacheMock, hasResource(MockResourceHash::IndexArrayHash, _)).WillOnce(Return(false));
+    EXPECT_CALL(sceneEventSender, sendResourcesAvailable(getSceneId(sceneIdx), ResourceContentHashVector{ MockResourceHash::EffectHash }));
+    requestSceneSubscription(sceneIdx);
+
+    unmapScene();
+    destroyDisplay();
+}
+
+static SceneUpdate CreateSceneUpdateWithResourceNotSent(ResourceContentHash resource)
+{
+    SceneUpdate update;
+    update.flushInfos.flushCounter = 2u;
+    update.flushInfos.containsValidInformation = true;
+    update.flushInfos.resourceChanges.m_resourcesAdded.push_back(resource);
+    return update;
+}
+
+TEST_F(ARendererSceneUpdater, loadsResourceNotSentWithSceneUpdateFromResourceCache)
+{
+    createPublishAndSubscribeScene();
+
+    const float data[] = { 1.f, 2.f, 3.f };
+    const ArrayResource resource(EResourceType_VertexArray, 3, EDataType::Float, data, ResourceCacheFlag_DoNotCache, "res");
+    BinaryOutputStream serializedResource;
+    SingleResourceSerialization::SerializeResource(serializedResource, resource);
+    const UInt32 serializedSize = static_cast<UInt32>(serializedResource.getSize());
+
+    EXPECT_CALL(rendererResourceCacheMock, hasResource(resource.getHash(), _)).WillOnce(DoAll(SetArgReferee<1>(serializedSize), Return(true)));
+    EXPECT_CALL(rendererResourceCacheMock, getResourceData(resource.getHash(), _, serializedSize)).WillOnce([&](ResourceContentHash, UInt8* buffer, UInt32 size)
+    {
+        PlatformMemory::Copy(buffer, serializedResource.getData(), size);
+        return true;
+    });
+    rendererSceneUpdater->handleSceneUpdate(getSceneId(), CreateSceneUpdateWithResourceNotSent(resource.getHash()));
+    EXPECT_EQ(ESceneState::Subscribed, sceneStateExecutor.getSceneState(getSceneId()));
+}
+
+TEST_F(ARendererSceneUpdater, unsubscribesSceneIfResourceNotSentWithSceneUpdateIsNotInResourceCache)
+{
+    createPublishAndSubscribeScene();
+
+    const ResourceContentHash resource(1234u, 0u);
+    EXPECT_CALL(rendererResourceCacheMock, hasResource(resource, _)).WillOnce(Return(false));
+    EXPECT_CALL(sceneEventSender, sendUnsubscribeScene(getSceneId()));
+    rendererSceneUpdater->handleSceneUpdate(getSceneId(), CreateSceneUpdateWithResourceNotSent(resource));
+    EXPECT_EQ(ESceneState::Published, sceneStateExecutor.getSceneState(getSceneId()));
+    expectInternalSceneStateEvent(ERendererEventType::SceneUnsubscribedIndirect);
+}
+
 TEST_F(ARendererSceneUpdater, triggersResourceUploadAndUnloadWhenResourceProvided)
 {
     createDisplayAndExpectSuccess();
@@ -51,6 +51,21 @@ TEST_F(ARendererStatistics, tracksDrawCallsPerFrame)
     EXPECT_EQ(3u, stats.getDrawCallsPerFrame());
 }
 
+TEST_F(ARendererStatistics, tracksUploadedAndSkippedUniformsPerFrame)
+{
+    stats.uniformsUploaded(10u, 2u);
+    stats.frameFinished(0u);
+    stats.uniformsUploaded(2u, 10u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(6u, stats.getUniformsUploadedPerFrame());
+    EXPECT_EQ(6u, stats.getUniformsSkippedPerFrame());
+    EXPECT_THAT(logOutput(), HasSubstr("uniformsPerFrame (uploaded/skipped) 6/6"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getUniformsUploadedPerFrame());
+    EXPECT_EQ(0u, stats.getUniformsSkippedPerFrame());
+}
+
 TEST_F(ARendererStatistics, tracksFrameCount)
 {
     stats.frameFinished(0u);
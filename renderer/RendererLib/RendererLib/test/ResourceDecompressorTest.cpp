@@ -0,0 +1,115 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/ResourceDecompressor.h"
+#include "Resource/ArrayResource.h"
+#include <numeric>
+
+namespace ramses_internal
+{
+    class AResourceDecompressor : public ::testing::Test
+    {
+    protected:
+        static ManagedResource CreateResource(UInt32 elementCount, bool compressedDataOnly)
+        {
+            std::vector<float> data(elementCount);
+            std::iota(data.begin(), data.end(), 0.f);
+            auto source = std::make_shared<ArrayResource>(EResourceType_VertexArray, elementCount, EDataType::Float, data.data(), ResourceCacheFlag_DoNotCache, "");
+            source->compress(IResource::CompressionLevel::Realtime);
+            if (!compressedDataOnly)
+                return source;
+
+            // simulates resource as received from network, having compressed data only
+            const auto& compressedData = source->getCompressedResourceData();
+            auto resource = std::make_shared<ArrayResource>(EResourceType_VertexArray, elementCount, EDataType::Float, nullptr, ResourceCacheFlag_DoNotCache, "");
+            resource->setCompressedResourceData(CompressedResourceBlob(compressedData.size(), compressedData.data()), IResource::CompressionLevel::Realtime, source->getDecompressedDataSize(), source->getHash());
+            return resource;
+        }
+
+        static void ExpectDecompressedData(const IResource& resource, UInt32 elementCount)
+        {
+            ASSERT_TRUE(resource.isDeCompressedAvailable());
+            ASSERT_EQ(elementCount * sizeof(float), resource.getResourceData().size());
+            const float* data = reinterpret_cast<const float*>(resource.getResourceData().data());
+            for (UInt32 i = 0u; i < elementCount; ++i)
+                EXPECT_EQ(static_cast<float>(i), data[i]);
+        }
+
+        ResourceDecompressor decompressor;
+    };
+
+    TEST_F(AResourceDecompressor, decompressesCompressedResource)
+    {
+        const auto resource = CreateResource(10000u, true);
+        ASSERT_FALSE(resource->isDeCompressedAvailable());
+
+        decompressor.decompressAsync(resource);
+        decompressor.waitForDecompression(*resource);
+        EXPECT_EQ(0u, decompressor.getNumberOfQueuedResources());
+        ExpectDecompressedData(*resource, 10000u);
+    }
+
+    TEST_F(AResourceDecompressor, decompressesAllQueuedResourcesWhenWaitedForInReverseOrder)
+    {
+        std::vector<ManagedResource> resources;
+        for (UInt32 i = 0u; i < 20u; ++i)
+        {
+            resources.push_back(CreateResource(5000u + i, true));
+            decompressor.decompressAsync(resources.back());
+        }
+
+        for (auto it = resources.crbegin(); it != resources.crend(); ++it)
+            decompressor.waitForDecompression(**it);
+
+        EXPECT_EQ(0u, decompressor.getNumberOfQueuedResources());
+        for (UInt32 i = 0u; i < 20u; ++i)
+            ExpectDecompressedData(*resources[i], 5000u + i);
+    }
+
+    TEST_F(AResourceDecompressor, handlesSameResourceQueuedMultipleTimes)
+    {
+        const auto resource = CreateResource(10000u, true);
+        decompressor.decompressAsync(resource);
+        decompressor.decompressAsync(resource);
+        decompressor.waitForDecompression(*resource);
+        decompressor.decompressAsync(resource);
+
+        EXPECT_EQ(0u, decompressor.getNumberOfQueuedResources());
+        ExpectDecompressedData(*resource, 10000u);
+    }
+
+    TEST_F(AResourceDecompressor, doesNotQueueResourceWhichIsAlreadyDecompressed)
+    {
+        const auto resource = CreateResource(10000u, false);
+        ASSERT_TRUE(resource->isDeCompressedAvailable());
+
+        decompressor.decompressAsync(resource);
+        EXPECT_EQ(0u, decompressor.getNumberOfQueuedResources());
+        decompressor.waitForDecompression(*resource);
+        ExpectDecompressedData(*resource, 10000u);
+    }
+
+    TEST_F(AResourceDecompressor, doesNotQueueResourceWithoutCompressedData)
+    {
+        const ManagedResource resource = std::make_shared<ArrayResource>(EResourceType_VertexArray, 10u, EDataType::Float, nullptr, ResourceCacheFlag_DoNotCache, "");
+        ASSERT_FALSE(resource->isCompressedAvailable());
+
+        decompressor.decompressAsync(resource);
+        EXPECT_EQ(0u, decompressor.getNumberOfQueuedResources());
+        decompressor.waitForDecompression(*resource);
+    }
+
+    TEST_F(AResourceDecompressor, canBeDestroyedWithResourcesStillQueued)
+    {
+        auto otherDecompressor = std::make_unique<ResourceDecompressor>();
+        for (UInt32 i = 0u; i < 20u; ++i)
+            otherDecompressor->decompressAsync(CreateResource(5000u, true));
+        otherDecompressor.reset();
+    }
+}
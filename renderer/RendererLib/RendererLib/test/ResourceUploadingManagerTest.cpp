@@ -11,6 +11,7 @@
 #include "RendererLib/RendererResourceRegistry.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "RendererLib/UniformUploadCache.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
 #include "ResourceUploaderMock.h"
@@ -33,7 +34,7 @@ public:
         , sceneId(66u)
         , uploader{ new StrictMock<ResourceUploaderMock> }
         , asyncEffectUploader(platformMock, platformMock.renderBackendMock)
-        , rendererResourceUploader(resourceRegistry, std::unique_ptr<IResourceUploader>{ uploader }, platformMock.renderBackendMock, asyncEffectUploader, keepEffects, frameTimer, stats, ResourceCacheSize)
+        , rendererResourceUploader(resourceRegistry, std::unique_ptr<IResourceUploader>{ uploader }, platformMock.renderBackendMock, asyncEffectUploader, keepEffects, frameTimer, stats, ResourceCacheSize, &uniformUploadCache)
     {
 
         InSequence s;
@@ -146,6 +147,7 @@ protected:
 
     FrameTimer frameTimer;
     RendererStatistics stats;
+    UniformUploadCache uniformUploadCache;
     StrictMock<ResourceUploaderMock>* uploader;
     AsyncEffectUploader asyncEffectUploader;
     ResourceUploadingManager rendererResourceUploader;
@@ -263,6 +265,40 @@ TEST_F(AResourceUploadingManager, uploadEffectAndStoreInBinaryShaderCacheIfResou
     makeResourceUnused(resHash);
 }
 
+TEST_F(AResourceUploadingManager, invalidatesUniformUploadCacheForUploadedAndUnloadedEffect)
+{
+    const auto resHash = dummyEffectResource.getHash();
+    registerAndProvideResource(resHash, true);
+
+    // device handle might have been used by previously deleted shader
+    uniformUploadCache.setUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(1u), 1u);
+    uploadShader(resHash);
+    expectResourceUploaded(resHash, DeviceMock::FakeShaderDeviceHandle);
+    EXPECT_FALSE(uniformUploadCache.isUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(1u), 1u));
+
+    uniformUploadCache.setUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(2u), 1u);
+    makeResourceUnused(resHash);
+    EXPECT_CALL(*uploader, unloadResource(_, EResourceType_Effect, resHash, DeviceMock::FakeShaderDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(resHash);
+    EXPECT_FALSE(uniformUploadCache.isUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(2u), 1u));
+}
+
+TEST_F(AResourceUploadingManager, invalidatesUniformUploadCacheForEffectUploadedFromBinaryShaderCache)
+{
+    const auto resHash = dummyEffectResource.getHash();
+    registerAndProvideResource(resHash, true);
+
+    uniformUploadCache.setUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(1u), 1u);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(Return(DeviceMock::FakeShaderDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(resHash, DeviceMock::FakeShaderDeviceHandle);
+    EXPECT_FALSE(uniformUploadCache.isUploaded(DeviceMock::FakeShaderDeviceHandle, DataInstanceHandle(1u), 1u));
+
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    makeResourceUnused(resHash);
+}
+
 TEST_F(AResourceUploadingManager, setsBrokenStatusForEffectIfUploadFailed)
 {
     const auto resHash = dummyEffectResource.getHash();
@@ -949,6 +949,17 @@ namespace ramses_internal
         expectNoRendererEvent();
     }
 
+    TEST_F(ASceneStateExecutor, announcesAvailableResourcesBeforeRequestingSubscription)
+    {
+        publishScene();
+        const ResourceContentHashVector availableResources{ ResourceContentHash(1u, 2u), ResourceContentHash(3u, 4u) };
+        InSequence seq;
+        EXPECT_CALL(rendererSceneSender, sendResourcesAvailable(sceneId, availableResources));
+        EXPECT_CALL(rendererSceneSender, sendSubscribeScene(sceneId));
+        sceneStateExecutor.setSubscriptionRequested(sceneId, availableResources);
+        expectNoRendererEvent();
+    }
+
     TEST_F(ASceneStateExecutor, receivesSubscribedScene)
     {
         publishScene();
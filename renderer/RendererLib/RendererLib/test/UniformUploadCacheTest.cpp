@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/UniformUploadCache.h"
+
+namespace ramses_internal
+{
+    class AUniformUploadCache : public testing::Test
+    {
+    protected:
+        UniformUploadCache cache;
+        const DeviceResourceHandle shader1{ 1u };
+        const DeviceResourceHandle shader2{ 5u };
+        const DataInstanceHandle uniformData1{ 3u };
+        const DataInstanceHandle uniformData2{ 4u };
+    };
+
+    TEST_F(AUniformUploadCache, hasNothingUploadedInitially)
+    {
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData1, 0u));
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData1, 1u));
+        EXPECT_FALSE(cache.isUploaded(shader2, uniformData2, 1u));
+    }
+
+    TEST_F(AUniformUploadCache, remembersUploadedUniformDataPerShader)
+    {
+        cache.setUploaded(shader1, uniformData1, 7u);
+        cache.setUploaded(shader2, uniformData2, 8u);
+
+        EXPECT_TRUE(cache.isUploaded(shader1, uniformData1, 7u));
+        EXPECT_TRUE(cache.isUploaded(shader2, uniformData2, 8u));
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData2, 8u));
+        EXPECT_FALSE(cache.isUploaded(shader2, uniformData1, 7u));
+    }
+
+    TEST_F(AUniformUploadCache, isNotUploadedForOtherGeneration)
+    {
+        cache.setUploaded(shader1, uniformData1, 7u);
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData1, 8u));
+    }
+
+    TEST_F(AUniformUploadCache, keepsOnlyLastUploadedUniformDataForShader)
+    {
+        cache.setUploaded(shader1, uniformData1, 7u);
+        cache.setUploaded(shader1, uniformData2, 8u);
+
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData1, 7u));
+        EXPECT_TRUE(cache.isUploaded(shader1, uniformData2, 8u));
+    }
+
+    TEST_F(AUniformUploadCache, forgetsUploadedUniformDataOfInvalidatedShaderOnly)
+    {
+        cache.setUploaded(shader1, uniformData1, 7u);
+        cache.setUploaded(shader2, uniformData2, 8u);
+        cache.invalidateShader(shader1);
+
+        EXPECT_FALSE(cache.isUploaded(shader1, uniformData1, 7u));
+        EXPECT_TRUE(cache.isUploaded(shader2, uniformData2, 8u));
+    }
+
+    TEST_F(AUniformUploadCache, canInvalidateShaderWithNothingUploaded)
+    {
+        cache.invalidateShader(shader2);
+        EXPECT_FALSE(cache.isUploaded(shader2, uniformData2, 0u));
+    }
+
+    TEST_F(AUniformUploadCache, accumulatesUniformCountsUntilReset)
+    {
+        cache.countUniforms(3u, 1u);
+        cache.countUniforms(2u, 4u);
+
+        UInt32 numUploaded = 0u;
+        UInt32 numSkipped = 0u;
+        cache.getAndResetUniformCounts(numUploaded, numSkipped);
+        EXPECT_EQ(5u, numUploaded);
+        EXPECT_EQ(5u, numSkipped);
+
+        cache.getAndResetUniformCounts(numUploaded, numSkipped);
+        EXPECT_EQ(0u, numUploaded);
+        EXPECT_EQ(0u, numSkipped);
+    }
+}
@@ -0,0 +1,131 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "TestSceneHelper.h"
+#include "SceneAllocateHelper.h"
+#include "RendererLib/WorldMatrixUpdateExecutor.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererEventCollector.h"
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace ramses_internal
+{
+    // Compares world matrix update of multiple independent scenes done serially with updates using increasing number of workers.
+    // Results are recorded as test properties (microseconds per update), the test itself only checks that matrices are correct.
+    class AWorldMatrixUpdateExecutorBenchmark : public testing::Test
+    {
+    public:
+        AWorldMatrixUpdateExecutorBenchmark()
+            : rendererScenes(rendererEventCollector)
+        {
+            for (UInt32 s = 0u; s < SceneCount; ++s)
+            {
+                RendererCachedScene& scene = rendererScenes.createScene(SceneInfo(SceneId(s + 1u)));
+                sceneHelpers.push_back(std::make_unique<TestSceneHelper>(scene));
+                TestSceneHelper& sceneHelper = *sceneHelpers.back();
+                sceneAllocators.push_back(std::make_unique<SceneAllocateHelper>(scene));
+                SceneAllocateHelper& sceneAllocator = *sceneAllocators.back();
+
+                const RenderGroupHandle group = sceneHelper.createRenderGroup(sceneHelper.createRenderPassWithCamera());
+                const NodeHandle rootNode = sceneAllocator.allocateNode();
+                rootTransforms.push_back(sceneAllocator.allocateTransform(rootNode));
+
+                // every renderable has its own chain of transformed nodes below common root node
+                for (UInt32 r = 0u; r < RenderablesPerScene; ++r)
+                {
+                    NodeHandle parentNode = rootNode;
+                    for (UInt32 d = 0u; d < HierarchyDepth; ++d)
+                    {
+                        const NodeHandle node = sceneAllocator.allocateNode();
+                        scene.setTranslation(sceneAllocator.allocateTransform(node), { 1.f, 0.f, 0.f });
+                        scene.addChildToNode(parentNode, node);
+                        parentNode = node;
+                    }
+                    const RenderableHandle renderable = sceneAllocator.allocateRenderable(parentNode);
+                    scene.addRenderableToRenderGroup(group, renderable, 0);
+                    renderables.push_back(renderable);
+                }
+
+                scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+                scenes.push_back(&scene);
+            }
+        }
+
+    protected:
+        static constexpr UInt32 SceneCount = 8u;
+        static constexpr UInt32 RenderablesPerScene = 2000u;
+        static constexpr UInt32 HierarchyDepth = 4u;
+        static constexpr UInt32 UpdateRounds = 20u;
+
+        // root transformation change invalidates world matrices of all renderables in scene
+        void invalidateWorldMatrices(UInt32 updateRound)
+        {
+            for (UInt32 s = 0u; s < SceneCount; ++s)
+                scenes[s]->setTranslation(rootTransforms[s], { 0.f, static_cast<float>(updateRound), 0.f });
+        }
+
+        void expectWorldMatricesUpdated(UInt32 updateRound) const
+        {
+            const Matrix44f expectedMatrix = Matrix44f::Translation({ static_cast<float>(HierarchyDepth), static_cast<float>(updateRound), 0.f });
+            for (UInt32 s = 0u; s < SceneCount; ++s)
+                EXPECT_EQ(expectedMatrix, scenes[s]->getRenderableWorldMatrix(renderables[(s + 1u) * RenderablesPerScene - 1u]));
+        }
+
+        template <typename Func>
+        int measureUsPerUpdate(Func&& updateAllScenes)
+        {
+            std::chrono::steady_clock::duration duration{ 0 };
+            for (UInt32 i = 0u; i < UpdateRounds; ++i)
+            {
+                invalidateWorldMatrices(++round);
+                const auto startTime = std::chrono::steady_clock::now();
+                updateAllScenes();
+                duration += std::chrono::steady_clock::now() - startTime;
+                expectWorldMatricesUpdated(round);
+            }
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / UpdateRounds);
+        }
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        std::vector<std::unique_ptr<TestSceneHelper>> sceneHelpers;
+        std::vector<std::unique_ptr<SceneAllocateHelper>> sceneAllocators;
+        std::vector<RendererCachedScene*> scenes;
+        std::vector<TransformHandle> rootTransforms;
+        std::vector<RenderableHandle> renderables;
+        UInt32 round = 0u;
+    };
+
+    TEST_F(AWorldMatrixUpdateExecutorBenchmark, Benchmark_scalingWithNumberOfWorkers)
+    {
+        RecordProperty("HardwareThreads", static_cast<int>(std::thread::hardware_concurrency()));
+
+        RecordProperty("SerialUpdateUs", measureUsPerUpdate([&]
+        {
+            for (auto scene : scenes)
+                scene->updateRenderableWorldMatrices();
+        }));
+
+        // calling thread takes part in update, so workers + 1 threads are updating scenes
+        const std::array<UInt16, 3> workerCounts = { 1u, 3u, 7u };
+        for (const auto workerCount : workerCounts)
+        {
+            WorldMatrixUpdateExecutor executor(workerCount);
+            RecordProperty("Threads" + std::to_string(workerCount + 1u) + "UpdateUs", measureUsPerUpdate([&]
+            {
+                executor.updateRenderableWorldMatrices(scenes);
+            }));
+        }
+    }
+}
@@ -67,10 +67,12 @@ namespace ramses_internal
 
         MOCK_METHOD(DeviceResourceHandle, allocateVertexBuffer, (UInt32), (override));
         MOCK_METHOD(void, uploadVertexBufferData, (DeviceResourceHandle, const Byte*, UInt32), (override));
+        MOCK_METHOD(void, updateVertexBufferData, (DeviceResourceHandle, UInt32, const Byte*, UInt32), (override));
         MOCK_METHOD(void, deleteVertexBuffer, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, activateVertexBuffer, (DeviceResourceHandle, DataFieldHandle, UInt32, UInt32, EDataType, UInt16, UInt16), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateIndexBuffer, (EDataType, UInt32), (override));
         MOCK_METHOD(void, uploadIndexBufferData, (DeviceResourceHandle, const Byte*, UInt32), (override));
+        MOCK_METHOD(void, updateIndexBufferData, (DeviceResourceHandle, UInt32, const Byte*, UInt32), (override));
         MOCK_METHOD(void, deleteIndexBuffer, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, activateIndexBuffer, (DeviceResourceHandle), (override));
 
@@ -46,6 +46,8 @@ public:
     MOCK_METHOD(IRenderBackend&, getRenderBackend, (), (const, override));
     MOCK_METHOD(IEmbeddedCompositingManager&, getEmbeddedCompositingManager, (), (override));
     MOCK_METHOD(void, validateRenderingStatusHealthy, (), (const, override));
+    MOCK_METHOD(void, getAndResetUniformUploadCounts, (UInt32& numUploaded, UInt32& numSkipped), (override));
+    MOCK_METHOD(UniformUploadCache*, getUniformUploadCache, (), (override));
 };
 }
 #endif
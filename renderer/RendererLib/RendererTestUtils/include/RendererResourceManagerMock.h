@@ -38,6 +38,7 @@ public:
     MOCK_METHOD(DeviceResourceHandle, getDataBufferDeviceHandle, (DataBufferHandle, SceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getTextureBufferDeviceHandle, (TextureBufferHandle, SceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getTextureSamplerDeviceHandle, (TextureSamplerHandle, SceneId), (const, override));
+    MOCK_METHOD(BoundingBox, getVertexArrayBoundingBox, (const ResourceContentHash&), (const, override));
     // IRendererResourceManager
     MOCK_METHOD(EResourceStatus, getResourceStatus, (const ResourceContentHash& hash), (const, override));
     MOCK_METHOD(EResourceType, getResourceType, (const ResourceContentHash& hash), (const, override));
@@ -65,7 +66,7 @@ public:
     MOCK_METHOD(void, unloadBlitPassRenderTargets, (BlitPassHandle, SceneId), (override));
     MOCK_METHOD(void, uploadDataBuffer, (DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, UInt32 elementCount, SceneId sceneId), (override));
     MOCK_METHOD(void, unloadDataBuffer, (DataBufferHandle dataBufferHandle, SceneId sceneId), (override));
-    MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId), (override));
+    MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId), (override));
 
     MOCK_METHOD(void, uploadTextureBuffer, (TextureBufferHandle textureBufferHandle, UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount, SceneId sceneId), (override));
     MOCK_METHOD(void, unloadTextureBuffer, (TextureBufferHandle textureBufferHandle, SceneId sceneId), (override));
@@ -30,6 +30,7 @@ public:
     MOCK_METHOD(DeviceResourceHandle, getDataBufferDeviceHandle, (DataBufferHandle dataBufferHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getTextureBufferDeviceHandle, (TextureBufferHandle textureBufferHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getTextureSamplerDeviceHandle, (TextureSamplerHandle textureSamplerHandle, SceneId sceneId), (const, override));
+    MOCK_METHOD(BoundingBox, getVertexArrayBoundingBox, (const ResourceContentHash& resourceHash), (const, override));
 };
 
 }
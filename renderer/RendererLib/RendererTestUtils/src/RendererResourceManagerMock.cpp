@@ -54,6 +54,8 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     ON_CALL(*this, getStreamBufferDeviceHandle(_)).WillByDefault(Return(DeviceMock::FakeRenderTargetDeviceHandle));
 
     ON_CALL(*this, getBlitPassRenderTargetsDeviceHandle(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<2>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle), SetArgReferee<3>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle)));
+    // fake resources have no data, extent is unknown
+    ON_CALL(*this, getVertexArrayBoundingBox(_)).WillByDefault(Return(BoundingBox::Infinite()));
 
     // no need to strictly test getters
     EXPECT_CALL(*this, getResourceDeviceHandle(_)).Times(AnyNumber());
@@ -64,6 +66,7 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     EXPECT_CALL(*this, getBlitPassRenderTargetsDeviceHandle(_, _, _, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getOffscreenBufferColorBufferDeviceHandle(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getStreamBufferDeviceHandle(_)).Times(AnyNumber());
+    EXPECT_CALL(*this, getVertexArrayBoundingBox(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getResourcesInUseByScene(_)).Times(AnyNumber());
 }
 
@@ -84,6 +84,21 @@ namespace ramses
         */
         status_t setMaximumFramerate(float maximumFramerate);
 
+        /**
+        * @brief Sets the maximum frame rate per second for the render loop of a single display.
+        *        Can only be used if display threads were enabled using #ramses::RendererConfig::enableDisplayThreads,
+        *        in that case every display runs its own render loop with its own frame rate limit.
+        *        Limit set for a specific display overrides the limit set using #setMaximumFramerate(float)
+        *        until #setMaximumFramerate(float) is called again.
+        *
+        * @param maximumFramerate The maximum frame rate per second to set for the display's render loop.
+        * @param displayId The display to set the frame rate limit for, the display does not need to exist yet.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setMaximumFramerate(float maximumFramerate, displayId_t displayId);
+
         /**
         * @brief Get the current value for maximum frame rate per second set by the user.
         *        if the user did not set a value then it returs the default value.
@@ -227,6 +227,46 @@ namespace ramses
         */
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief Enable or disable updating and rendering of each display in its own thread.
+        *        When enabled each display runs its own render loop with its own frame rate limit
+        *        (see #ramses::RamsesRenderer::setMaximumFramerate), so that a slow display does not
+        *        delay the others. This mode can only be used with #ramses::RamsesRenderer::startThread,
+        *        not with #ramses::RamsesRenderer::doOneLoop. Disabled by default.
+        *
+        * @param[in] enable Flag to enable or disable display threads
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableDisplayThreads(bool enable);
+
+        /**
+        * @brief Get the current setting of display threads
+        *
+        * @return True if each display is to be run in its own thread
+        */
+        bool getDisplayThreadsEnabled() const;
+
+        /**
+        * @brief Set number of worker threads used to update transformations of scenes.
+        *        World matrices of scenes which are not linked to other scenes via transformation links
+        *        are then computed in parallel, which can reduce frame time when many scenes with large
+        *        transformation hierarchies are rendered. Each display has its own set of worker threads.
+        *        Zero (default) updates all scenes sequentially in the render thread.
+        *
+        * @param[in] threadCount Number of worker threads per display
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setTransformationUpdateThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Get the number of worker threads used to update transformations of scenes
+        *
+        * @return Number of worker threads per display
+        */
+        uint32_t getTransformationUpdateThreadCount() const;
+
         /**
         * Stores internal data for implementation specifics of RendererConfig.
         */
@@ -83,6 +83,7 @@ namespace ramses
         bool isThreadRunning() const;
         bool isThreaded() const;
         status_t setMaximumFramerate(float maximumFramerate);
+        status_t setMaximumFramerate(float maximumFramerate, displayId_t displayId);
         float getMaximumFramerate() const;
         status_t setLoopMode(ELoopMode loopMode);
         ELoopMode getLoopMode() const;
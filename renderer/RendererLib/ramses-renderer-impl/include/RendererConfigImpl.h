@@ -53,6 +53,12 @@ namespace ramses
         status_t setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        status_t enableDisplayThreads(bool enable);
+        bool getDisplayThreadsEnabled() const;
+
+        status_t setTransformationUpdateThreadCount(uint32_t threadCount);
+        uint32_t getTransformationUpdateThreadCount() const;
+
         //impl methods
         const ramses_internal::RendererConfig& getInternalRendererConfig() const;
 
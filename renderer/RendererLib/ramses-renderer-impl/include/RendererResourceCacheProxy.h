@@ -13,6 +13,7 @@
 #include "SceneAPI/SceneId.h"
 #include "SceneAPI/ResourceContentHash.h"
 #include "ramses-renderer-api/Types.h"
+#include <mutex>
 
 namespace ramses
 {
@@ -35,6 +36,8 @@ namespace ramses
         static ramses::sceneId_t ConvertInternalTypeToPublic(ramses_internal::SceneId input);
 
         ramses::IRendererResourceCache& m_cache;
+        // cache is shared by all displays, which can be updated in their own threads
+        mutable std::mutex m_cacheLock;
     };
 }
 
@@ -57,6 +57,13 @@ namespace ramses
         return status;
     }
 
+    ramses::status_t RamsesRenderer::setMaximumFramerate(float maximumFramerate, displayId_t displayId)
+    {
+        const status_t status = impl.setMaximumFramerate(maximumFramerate, displayId);
+        LOG_HL_RENDERER_API2(status, maximumFramerate, displayId);
+        return status;
+    }
+
     float RamsesRenderer::getMaximumFramerate() const
     {
         return impl.getMaximumFramerate();
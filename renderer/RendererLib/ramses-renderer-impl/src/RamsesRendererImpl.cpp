@@ -44,7 +44,7 @@ namespace ramses
         , m_rendererResourceCache(config.impl.getRendererResourceCache() ? new RendererResourceCacheProxy(*(config.impl.getRendererResourceCache())) : nullptr)
         , m_pendingRendererCommands()
         , m_rendererFrameworkLogic(framework.getScenegraphComponent(), m_rendererCommandBuffer, framework.getFrameworkLock())
-        , m_displayDispatcher{ std::make_unique<ramses_internal::DisplayDispatcher>(config.impl.getInternalRendererConfig(), m_rendererCommandBuffer, m_rendererFrameworkLogic) }
+        , m_displayDispatcher{ std::make_unique<ramses_internal::DisplayDispatcher>(config.impl.getInternalRendererConfig(), m_rendererCommandBuffer, m_rendererFrameworkLogic, m_rendererResourceCache.get()) }
         , m_systemCompositorEnabled(config.impl.getInternalRendererConfig().getSystemCompositorControlEnabled())
         , m_loopMode(ramses_internal::ELoopMode::UpdateAndRender)
         , m_rendererLoopThreadWatchdog(framework.getThreadWatchdogConfig().getWatchdogNotificationInterval(ERamsesThreadIdentifier_Renderer), ERamsesThreadIdentifier_Renderer, framework.getThreadWatchdogConfig().getCallBack())
@@ -82,6 +82,11 @@ namespace ramses
             return addErrorEntry("Can not call doOneLoop explicitly if renderer is (or was) running in its own thread!");
         }
 
+        if (m_displayDispatcher->isUsingDisplayThreads())
+        {
+            return addErrorEntry("Can not call doOneLoop explicitly if display threads are enabled, use startThread instead!");
+        }
+
         m_rendererLoopThreadType = ERendererLoopThreadType_UsingDoOneLoop;
         m_displayDispatcher->doOneLoop(m_loopMode);
         return StatusOK;
@@ -462,6 +467,8 @@ namespace ramses
         m_rendererLoopThreadType = ERendererLoopThreadType_InRendererOwnThread;
         if (m_rendererLoopThreadController.startRendering())
         {
+            if (m_displayDispatcher->isUsingDisplayThreads())
+                m_displayDispatcher->startDisplayThreadsUpdating();
             return StatusOK;
         }
 
@@ -477,6 +484,8 @@ namespace ramses
 
         if (m_rendererLoopThreadController.stopRendering())
         {
+            if (m_displayDispatcher->isUsingDisplayThreads())
+                m_displayDispatcher->stopDisplayThreadsUpdating();
             return StatusOK;
         }
 
@@ -506,6 +515,24 @@ namespace ramses
         }
 
         m_rendererLoopThreadController.setMaximumFramerate(maximumFramerate);
+        if (m_displayDispatcher->isUsingDisplayThreads())
+            m_displayDispatcher->setMinFrameDuration(std::chrono::microseconds(static_cast<uint64_t>(1e6f / maximumFramerate)));
+        return StatusOK;
+    }
+
+    status_t RamsesRendererImpl::setMaximumFramerate(float maximumFramerate, displayId_t displayId)
+    {
+        if (maximumFramerate <= 0.0f)
+        {
+            return addErrorEntry("RamsesRenderer::setMaximumFramerate must specify a positive maximumFramerate!");
+        }
+
+        if (!m_displayDispatcher->isUsingDisplayThreads())
+        {
+            return addErrorEntry("RamsesRenderer::setMaximumFramerate Can not set maximum framerate for a single display if display threads are not enabled!");
+        }
+
+        m_displayDispatcher->setMinFrameDuration(std::chrono::microseconds(static_cast<uint64_t>(1e6f / maximumFramerate)), ramses_internal::DisplayHandle(displayId.getValue()));
         return StatusOK;
     }
 
@@ -527,6 +554,7 @@ namespace ramses
         }
 
         m_rendererLoopThreadController.setLoopMode(m_loopMode);
+        m_displayDispatcher->setLoopMode(m_loopMode);
 
         return StatusOK;
     }
@@ -121,4 +121,28 @@ namespace ramses
         return impl.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfig::enableDisplayThreads(bool enable)
+    {
+        const status_t status = impl.enableDisplayThreads(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
+    bool RendererConfig::getDisplayThreadsEnabled() const
+    {
+        return impl.getDisplayThreadsEnabled();
+    }
+
+    status_t RendererConfig::setTransformationUpdateThreadCount(uint32_t threadCount)
+    {
+        const status_t status = impl.setTransformationUpdateThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    uint32_t RendererConfig::getTransformationUpdateThreadCount() const
+    {
+        return impl.getTransformationUpdateThreadCount();
+    }
+
 }
@@ -11,6 +11,8 @@
 
 namespace ramses
 {
+    static const uint32_t MaxTransformationUpdateThreadCount = 64u;
+
     RendererConfigImpl::RendererConfigImpl(int argc, char const* const* argv)
         : StatusObjectImpl()
         , m_binaryShaderCache(nullptr)
@@ -121,6 +123,31 @@ namespace ramses
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfigImpl::enableDisplayThreads(bool enable)
+    {
+        m_internalConfig.enableDisplayThreads(enable);
+        return StatusOK;
+    }
+
+    bool RendererConfigImpl::getDisplayThreadsEnabled() const
+    {
+        return m_internalConfig.getDisplayThreadsEnabled();
+    }
+
+    status_t RendererConfigImpl::setTransformationUpdateThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > MaxTransformationUpdateThreadCount)
+            return addErrorEntry("RendererConfig::setTransformationUpdateThreadCount: thread count exceeds supported maximum");
+
+        m_internalConfig.setTransformationUpdateThreadCount(threadCount);
+        return StatusOK;
+    }
+
+    uint32_t RendererConfigImpl::getTransformationUpdateThreadCount() const
+    {
+        return m_internalConfig.getTransformationUpdateThreadCount();
+    }
+
     const ramses_internal::RendererConfig& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
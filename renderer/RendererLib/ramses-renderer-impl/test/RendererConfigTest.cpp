@@ -119,3 +119,28 @@ TEST(ARendererConfig, setsAndGetsLoopCountPeriod)
     EXPECT_EQ(ramses::StatusOK, config.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds(1234)));
     EXPECT_EQ(std::chrono::milliseconds(1234), config.getRenderThreadLoopTimingReportingPeriod());
 }
+
+TEST(ARendererConfig, canEnableDisplayThreads)
+{
+    ramses::RendererConfig config;
+    EXPECT_FALSE(config.getDisplayThreadsEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableDisplayThreads(true));
+    EXPECT_TRUE(config.getDisplayThreadsEnabled());
+    EXPECT_TRUE(config.impl.getInternalRendererConfig().getDisplayThreadsEnabled());
+}
+
+TEST(ARendererConfig, canSetTransformationUpdateThreadCount)
+{
+    ramses::RendererConfig config;
+    EXPECT_EQ(0u, config.getTransformationUpdateThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setTransformationUpdateThreadCount(4u));
+    EXPECT_EQ(4u, config.getTransformationUpdateThreadCount());
+    EXPECT_EQ(4u, config.impl.getInternalRendererConfig().getTransformationUpdateThreadCount());
+}
+
+TEST(ARendererConfig, failsToSetTooManyTransformationUpdateThreads)
+{
+    ramses::RendererConfig config;
+    EXPECT_NE(ramses::StatusOK, config.setTransformationUpdateThreadCount(1000u));
+    EXPECT_EQ(0u, config.getTransformationUpdateThreadCount());
+}